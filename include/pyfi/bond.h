@@ -6,8 +6,12 @@
 #define BOND_H
 
 #include <concepts>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "memory.h"
+
 namespace pyfi::bond {
 
     /**
@@ -226,6 +230,58 @@ namespace pyfi::bond {
         double years_to_maturity,
         int m);
 
+
+    /**
+     * Column-oriented view over a book of coupon bonds priced from their time to maturity. Every column must have the
+     * same length; element i of each column describes bond i. The view does not own the memory.
+     */
+    struct bond_batch {
+        std::span<const double> par_value;
+        std::span<const double> coupon_rate;
+        std::span<const double> annual_yield;
+        std::span<const double> years_to_maturity;
+        std::span<const int> m;
+
+        /**
+         * @return number of bonds in the batch
+         * @throw std::invalid_argument if the columns differ in length
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * @param offset index of the first bond
+         * @param count number of bonds
+         * @return a view over bonds [offset, offset + count)
+         */
+        [[nodiscard]] bond_batch slice(std::size_t offset, std::size_t count) const;
+    };
+
+    /**
+     * Batched dirty_coupon_price_from_T over every bond of the batch. With hints.lanes of 4, 8 or 16 the bonds are
+     * priced that many at a time by a simd pack form of the closed form, which takes the powers of 1 + y / m as
+     * exp(x log(1 + y / m)) and agrees with the scalar pricer to a few ulp.
+     *
+     * @param batch the bonds to price
+     * @param out receives the dirty prices, must have batch.size() elements
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a bond has m <= 0 or hints.lanes is not 1, 4, 8 or 16
+     */
+    void dirty_coupon_price_from_T_batch(const bond_batch& batch,
+        std::span<double> out,
+        const memory::access_hints& hints = {});
+
+    /**
+     * Batched clean_coupon_price_from_T over every bond of the batch.
+     *
+     * @param batch the bonds to price
+     * @param out receives the clean prices, must have batch.size() elements
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a bond has m <= 0 or hints.lanes is not 1, 4, 8 or 16
+     */
+    void clean_coupon_price_from_T_batch(const bond_batch& batch,
+        std::span<double> out,
+        const memory::access_hints& hints = {});
+
 } // namespace pyfi::bond
 
 
@@ -0,0 +1,153 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef BOOK_H
+#define BOOK_H
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+
+#include "bond.h"
+#include "memory.h"
+#include "option.h"
+
+namespace pyfi::book {
+
+    /**
+     * Columns of the option part of a shared_book. The first six are inputs in the order of option_batch, the last
+     * two are outputs written by the workers.
+     */
+    enum class option_column { stock_price, strike_price, volatility, risk_free_rate, time, yield_curve, call, put };
+
+    /**
+     * Columns of the bond part of a shared_book. The compounding frequency m is an int column and is reached
+     * through shared_book::compounding instead.
+     */
+    enum class bond_column { par_value, coupon_rate, annual_yield, years_to_maturity, dirty_price, clean_price };
+
+    /**
+     * An option and bond book stored in a POSIX shared memory segment.
+     *
+     * The parent process creates the segment, fills the input columns and forks (or spawns) N workers. Each worker
+     * either inherits the mapping or attaches by name, then prices its own contiguous slice of the book with the
+     * batch pricers, reading the inputs in place and writing straight into its slice of the output columns. Nothing
+     * is copied or serialised between processes.
+     *
+     * Every column starts on a 64 byte boundary and worker slices are rounded to whole cache lines, so two workers
+     * never write to the same line.
+     */
+    class shared_book {
+    public:
+        /**
+         * Creates and maps a new segment. Fails if a segment with that name already exists.
+         *
+         * @param name shared memory object name, e.g. "/pyfi_book"
+         * @param options number of option contracts
+         * @param bonds number of bonds
+         * @param workers number of workers the outputs are partitioned between
+         * @return the mapped book, zero initialised
+         * @throw std::invalid_argument if workers == 0
+         * @throw std::runtime_error if the segment cannot be created or mapped
+         */
+        static shared_book create(const std::string& name, std::size_t options, std::size_t bonds, std::size_t workers);
+
+        /**
+         * Maps an existing segment created by shared_book::create.
+         *
+         * @param name shared memory object name
+         * @return the mapped book
+         * @throw std::runtime_error if the segment does not exist or is not a pyfi book
+         */
+        static shared_book attach(const std::string& name);
+
+        shared_book(const shared_book&) = delete;
+        shared_book& operator=(const shared_book&) = delete;
+        shared_book(shared_book&& other) noexcept;
+        shared_book& operator=(shared_book&& other) noexcept;
+
+        /**
+         * Unmaps the segment. The shared memory object itself stays alive until unlink is called.
+         */
+        ~shared_book();
+
+        /**
+         * Removes the shared memory object name. Processes that already mapped it keep their mapping.
+         */
+        void unlink() const;
+
+        [[nodiscard]] const std::string& name() const;
+        [[nodiscard]] std::size_t options() const;
+        [[nodiscard]] std::size_t bonds() const;
+        [[nodiscard]] std::size_t workers() const;
+
+        [[nodiscard]] std::span<double> column(option_column column) const;
+        [[nodiscard]] std::span<double> column(bond_column column) const;
+        [[nodiscard]] std::span<int> compounding() const;
+
+        /**
+         * @return a batch view over the option input columns
+         */
+        [[nodiscard]] option::option_batch option_inputs() const;
+
+        /**
+         * @return a batch view over the bond input columns
+         */
+        [[nodiscard]] bond::bond_batch bond_inputs() const;
+
+        /**
+         * @param worker worker index in [0, workers)
+         * @return the [begin, end) range of options owned by the worker
+         */
+        [[nodiscard]] std::pair<std::size_t, std::size_t> option_range(std::size_t worker) const;
+
+        /**
+         * @param worker worker index in [0, workers)
+         * @return the [begin, end) range of bonds owned by the worker
+         */
+        [[nodiscard]] std::pair<std::size_t, std::size_t> bond_range(std::size_t worker) const;
+
+        /**
+         * Applies huge page and NUMA options to this process' mapping of the book, see memory::advise. Call it before
+         * the pages are first written; placement.first_touch is ignored, use first_touch(worker) instead.
+         *
+         * @throw std::runtime_error if the mapping cannot be bound to the requested node
+         */
+        void advise(const memory::placement& placement) const;
+
+        /**
+         * Faults in the pages of the worker's slice of every option and bond column from the calling process, so
+         * that under the default NUMA policy they are allocated on the node the worker runs on. Each worker calls it
+         * once after it is pinned and before the parent fills the inputs.
+         *
+         * @param worker worker index in [0, workers)
+         */
+        void first_touch(std::size_t worker) const;
+
+        /**
+         * Prices the worker's option slice, writing calls and puts into the output columns.
+         *
+         * @param worker worker index in [0, workers)
+         */
+        void price_options(std::size_t worker) const;
+
+        /**
+         * Prices the worker's bond slice, writing dirty and clean prices into the output columns.
+         *
+         * @param worker worker index in [0, workers)
+         */
+        void price_bonds(std::size_t worker) const;
+
+    private:
+        shared_book(std::string name, void* base, std::size_t bytes);
+
+        std::string name_;
+        void* base_ = nullptr;
+        std::size_t bytes_ = 0;
+    };
+
+} // namespace pyfi::book
+
+#endif // BOOK_H
@@ -0,0 +1,115 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef BUMP_H
+#define BUMP_H
+
+#include <functional>
+#include <span>
+
+#include "monte_carlo.h"
+#include "option.h"
+
+namespace pyfi::bump {
+
+    /**
+     * Finite difference step sizes. The spot bump is relative to the spot, the others are absolute. The volatility
+     * and time bumps are capped at half the contract's volatility and time to maturity, so the down scenario stays
+     * positive.
+     */
+    struct bump_sizes {
+        double spot = 0.01;
+        double volatility = 0.01;
+        double rate = 1e-4;
+        double time = 1.0 / 365.0;
+    };
+
+    /**
+     * Finite difference Greeks of one contract. Vega and rho are per unit change, theta is per year of calendar time.
+     */
+    struct greeks {
+        double price;
+        double delta;
+        double gamma;
+        double vega;
+        double theta;
+        double rho;
+    };
+
+    /**
+     * Prices a batch of scenarios into out, which has scenarios.size() elements.
+     */
+    using scenario_pricer = std::function<void(const option::option_batch& scenarios, std::span<double> out)>;
+
+    /**
+     * Greeks by bump and reprice for any batch pricer. The base and the eight bumped copies (spot, volatility, rate
+     * and time, each up and down) of every contract are laid out in one scenario batch and priced in a single call,
+     * so a Monte Carlo pricer sees all of them on common random numbers and a vectorised pricer sees one long batch.
+     * Delta, gamma, vega and rho are central differences; rho holds the dividend yield fixed.
+     *
+     * @param contracts the contracts to risk
+     * @param pricer prices the scenario batch, called exactly once
+     * @param out receives the Greeks, must have contracts.size() elements
+     * @param bumps the finite difference step sizes
+     * @throw std::invalid_argument if the sizes do not match
+     */
+    void bump_and_reprice(const option::option_batch& contracts,
+        const scenario_pricer& pricer,
+        std::span<greeks> out,
+        const bump_sizes& bumps = {});
+
+    /**
+     * Closed form pricer over black_scholes_call_batch or black_scholes_put_batch.
+     *
+     * @param type call or put
+     * @param hints prefetch, streaming store and simd width options of the batch kernel
+     */
+    scenario_pricer black_scholes_pricer(option::option_type type, const memory::access_hints& hints = {});
+
+    /**
+     * Cox-Ross-Rubinstein pricer that rolls every scenario of the batch back through its own lattice in lockstep, so
+     * the inner loop runs across scenarios. Honours the dividend yield.
+     *
+     * @param type call or put
+     * @param american allow early exercise
+     * @param steps number of time steps
+     * @throw std::invalid_argument if steps is not positive
+     */
+    scenario_pricer binomial_pricer(option::option_type type, bool american, int steps);
+
+    /**
+     * Monte Carlo pricer. Every scenario of a batch is priced on the same paths.
+     *
+     * @param type call or put
+     * @param style european or asian payoff
+     * @param config number of paths, monitoring dates and seed
+     */
+    scenario_pricer monte_carlo_pricer(option::option_type type,
+        monte_carlo::payoff_style style,
+        const monte_carlo::mc_config& config);
+
+    /**
+     * Lattice Greeks that reuse the base tree. The tree is started two steps before today with the same step size, so
+     * the three nodes at today give price, delta and gamma and the extra root gives theta, all from one induction.
+     * Only the volatility and rate bumps need repricing, and they are batched through the lockstep lattice, so the
+     * whole set costs five lattices per contract instead of nine.
+     *
+     * @param contracts the contracts to risk
+     * @param type call or put
+     * @param american allow early exercise
+     * @param steps number of time steps between today and maturity
+     * @param out receives the Greeks, must have contracts.size() elements
+     * @param bumps only the volatility and rate sizes are used
+     * @throw std::invalid_argument if the sizes do not match or steps is not positive
+     */
+    void binomial_greeks(const option::option_batch& contracts,
+        option::option_type type,
+        bool american,
+        int steps,
+        std::span<greeks> out,
+        const bump_sizes& bumps = {});
+
+} // namespace pyfi::bump
+
+#endif // BUMP_H
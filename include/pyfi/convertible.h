@@ -0,0 +1,82 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef CONVERTIBLE_H
+#define CONVERTIBLE_H
+
+#include <vector>
+
+namespace pyfi::convertible {
+
+    /**
+     * A call or put window: the issuer may call, or the holder put, the bond at price (per bond, cash) at any lattice
+     * step whose time is within half a step of [start, end]. start == end gives a single date.
+     */
+    struct provision {
+        double start; // in years from today
+        double end;
+        double price;
+    };
+
+    /**
+     * A coupon paying convertible bond. Coupons of par_value * coupon_rate / m fall at maturity - j / m, the
+     * dirty_coupon_price_from_T schedule, and the holder may convert into conversion_ratio shares at any step up to
+     * maturity.
+     */
+    struct convertible_bond {
+        double par_value = 100.0;
+        double coupon_rate;
+        double maturity; // in years from today
+        double conversion_ratio; // shares per bond
+        int m = 2;
+        std::vector<provision> calls{}; // issuer calls, the holder may still convert when called
+        std::vector<provision> puts{}; // holder puts
+    };
+
+    /**
+     * The equity and the issuer's credit. Cash the issuer owes is discounted at risk_free_rate + credit_spread, the
+     * value held as shares at risk_free_rate.
+     */
+    struct market_data {
+        double stock_price;
+        double volatility;
+        double risk_free_rate; // continuous
+        double credit_spread = 0.0; // continuous, over risk_free_rate
+        double yield_curve = 0.0; // continuous dividend yield q
+    };
+
+    struct convertible_result {
+        double price;
+        double equity_part; // the part of price that ends up in shares
+        double debt_part; // the part paid in cash, exposed to the issuer's credit
+        double bond_floor; // the same coupons and redemption without conversion, calls or puts
+        double conversion_value; // conversion_ratio * stock_price
+        double delta; // d price / d stock_price, from the first two steps of the lattice
+        double gamma;
+    };
+
+    /**
+     * Prices a convertible on the Cox-Ross-Rubinstein lattice of option::binomial_tree_setup with the
+     * Tsiveriotis-Fernandes split: at each node the value is an equity part, discounted at the risk free rate, and a
+     * cash part, discounted at the risky rate. Going back through the tree each node takes, in order, the issuer's call
+     * (the holder gets the larger of the call price and conversion), the holder's put, voluntary conversion and then
+     * any coupon paid at that step. Coupons are paid on the nearest step to their date.
+     *
+     * Only the current column of the tree is kept: total value, cash part, bond floor and stock price in four rolling
+     * arrays of steps + 1 nodes updated in place, so memory is O(steps) and the time O(steps^2) whatever the maturity.
+     * Like any barrier on a lattice, the conversion and call boundaries make the price oscillate with the step count;
+     * averaging the prices at steps and steps + 1 smooths it.
+     *
+     * @param bond the contract
+     * @param market the stock and the issuer's credit
+     * @param steps lattice steps to maturity
+     * @return price, its split and lattice delta and gamma
+     * @throw std::invalid_argument if steps < 2, the maturity, volatility or stock price is not positive, m <= 0, the
+     * conversion ratio is negative or the lattice has no risk neutral probability at this step size
+     */
+    convertible_result price(const convertible_bond& bond, const market_data& market, int steps);
+
+} // namespace pyfi::convertible
+
+#endif // CONVERTIBLE_H
@@ -0,0 +1,146 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef CREDIT_H
+#define CREDIT_H
+
+#include <span>
+#include <vector>
+
+#include "bond.h"
+#include "curve.h"
+#include "memory.h"
+
+namespace pyfi::credit {
+
+    /**
+     * Piecewise constant hazard rate curve of one issuer: hazards[i] is the default intensity on (times[i - 1],
+     * times[i]], starting from 0, and the last one is held flat after the last pillar. Survival to t is
+     * exp(-integral of the hazard from 0 to t).
+     */
+    class hazard_curve {
+    public:
+        /**
+         * @param times pillar times, positive and increasing
+         * @param hazards hazard rate up to each pillar, continuous
+         * @throw std::invalid_argument if the sizes differ, there are no pillars, the times are not positive and
+         * increasing or a hazard is negative
+         */
+        hazard_curve(std::vector<double> times, std::vector<double> hazards);
+
+        [[nodiscard]] double hazard(double time) const;
+
+        [[nodiscard]] double survival(double time) const;
+
+        [[nodiscard]] const std::vector<double>& times() const;
+
+        [[nodiscard]] const std::vector<double>& hazards() const;
+
+    private:
+        std::vector<double> times_;
+        std::vector<double> hazards_;
+        std::vector<double> cumulative_; // integral of the hazard from 0 to each pillar
+    };
+
+    /**
+     * A credit default swap per unit of notional. The premium is paid m times a year at maturity - j / m, as the
+     * coupons of dirty_coupon_price_from_T, each period accruing spread / m from the previous date or from today for
+     * the first, short, period. On default the buyer pays the premium accrued since the last date and receives
+     * 1 - recovery.
+     */
+    struct cds {
+        double maturity; // in years from today
+        double spread; // running premium per year
+        int m = 4;
+    };
+
+    struct cds_value {
+        double premium_leg; // spread * risky_annuity
+        double protection_leg;
+        double risky_annuity; // the premium leg per 1.0 of spread, with the premium accrued on default (RPV01)
+        double pv; // to the protection buyer: protection_leg - premium_leg
+        double par_spread; // protection_leg / risky_annuity
+    };
+
+    /**
+     * Values both legs of a CDS off a zero curve and a hazard curve. Between the knots of the two curves and the
+     * premium dates the forward rate and the hazard are both constant, so the default time integrals of the protection
+     * and accrued premium are summed in closed form over those pieces, with no time grid.
+     *
+     * @param discount the risk free curve
+     * @param hazard the reference entity's hazard curve
+     * @param contract the swap
+     * @param recovery recovery rate on default, in [0, 1)
+     * @return the legs per unit of notional
+     * @throw std::invalid_argument if the maturity is not positive, m <= 0 or the recovery is outside [0, 1)
+     */
+    cds_value price_cds(const curve::zero_curve& discount,
+        const hazard_curve& hazard,
+        const cds& contract,
+        double recovery);
+
+    /**
+     * Bootstraps one hazard pillar per quote at its maturity so that each CDS prices at zero at its quoted spread,
+     * given the pillars before it. The legs of the premium periods that end by the previous pillar do not depend on
+     * the new hazard and are summed once; each secant step then only revalues the periods after it, so the bootstrap
+     * costs the same as pricing every quote a few times.
+     *
+     * @param discount the risk free curve
+     * @param quotes par CDS quotes sorted by maturity
+     * @param recovery recovery rate on default, in [0, 1)
+     * @return the hazard curve with a pillar at each quote's maturity
+     * @throw std::invalid_argument if there are no quotes, the maturities are not positive and increasing, a quote
+     * has m <= 0, the recovery is outside [0, 1) or a pillar has no non negative hazard that reprices its quote
+     */
+    hazard_curve bootstrap(const curve::zero_curve& discount, std::span<const cds> quotes, double recovery);
+
+    /**
+     * Dirty price of a defaultable coupon bond off a zero curve and the issuer's hazard curve: the coupons and
+     * redemption of the dirty_coupon_price_from_T schedule, each weighted by the survival to its date, plus recovery
+     * * par_value paid at default (recovery of par). The recovery integral is the protection leg of price_cds.
+     *
+     * @param discount the risk free curve
+     * @param hazard the issuer's hazard curve
+     * @param par_value face value
+     * @param coupon_rate annual coupon rate
+     * @param years_to_maturity time to maturity in years
+     * @param m coupon payments per year
+     * @param recovery fraction of par_value recovered on default, in [0, 1)
+     * @return dirty price
+     * @throw std::invalid_argument if m <= 0, the maturity is not positive or the recovery is outside [0, 1)
+     */
+    double risky_bond_price(const curve::zero_curve& discount,
+        const hazard_curve& hazard,
+        double par_value,
+        double coupon_rate,
+        double years_to_maturity,
+        int m,
+        double recovery);
+
+    /**
+     * Batched dirty prices of defaultable bonds, each with a flat hazard rate, e.g. -log(survival(T)) / T off its
+     * issuer's curve. With a flat hazard lambda the survival to every coupon date multiplies the discount factor per
+     * period, so the surviving cash flows are exactly a dirty_coupon_price_from_T at the yield with
+     * 1 + y' / m = (1 + y / m) exp(lambda / m), and the book goes through dirty_coupon_price_from_T_batch, simd packs,
+     * prefetches and all, on those yields. The recovery of par is added in closed form:
+     * recovery * par_value * lambda / (r + lambda) * (1 - exp(-(r + lambda) T)) with r = m log(1 + y / m).
+     * Rows go through the kernel a chunk at a time, so the risky yields it reads are still in cache.
+     *
+     * @param batch the bonds, annual_yield the risk free yield of each
+     * @param hazard_rate flat hazard rate of each bond's issuer, continuous
+     * @param recovery fraction of par_value recovered on default of each bond
+     * @param out receives the dirty prices, must have batch.size() elements
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a bond has m <= 0, a hazard rate is negative, a recovery
+     * is outside [0, 1) or hints.lanes is not 1, 4, 8 or 16
+     */
+    void risky_dirty_price_batch(const bond::bond_batch& batch,
+        std::span<const double> hazard_rate,
+        std::span<const double> recovery,
+        std::span<double> out,
+        const memory::access_hints& hints = {});
+
+} // namespace pyfi::credit
+
+#endif // CREDIT_H
@@ -0,0 +1,123 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef CSV_H
+#define CSV_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pyfi::csv {
+
+    /**
+     * Type a projected column is parsed into.
+     */
+    enum class column_type { real, integer };
+
+    /**
+     * A column to read from the file. Columns that are not asked for are skipped without being parsed.
+     */
+    struct column_spec {
+        std::string name;
+        column_type type = column_type::real;
+        bool required = true;
+        double fill = 0.0; // value of an optional column that is missing from the header
+    };
+
+    /**
+     * Streaming reader for headed, unquoted CSV files of numbers, e.g. market data and quote dumps.
+     *
+     * The input is read in fixed size blocks. Field boundaries are found 64 bytes at a time with SIMD compares
+     * (SSE2 on x86, a scalar loop elsewhere) into a bitmask of separator positions. Each separator is then taken
+     * off the mask with a count trailing zeros and a clear lowest bit, so a skipped column costs one step per
+     * separator rather than one per character. Projected fields are converted with std::from_chars. Rows come out in
+     * chunks as typed columns that can be handed straight to the batch pricers as spans.
+     *
+     * Lines that are empty or hold only spaces, tabs or a carriage return are skipped wherever they appear, including
+     * before the header and at the end of the file.
+     */
+    class reader {
+    public:
+        /**
+         * @param from input stream, read from its current position; the reader does not close it
+         * @param columns columns to project, in the order they should be returned
+         * @param delimiter field separator
+         * @throw std::invalid_argument if no columns are requested or a name repeats
+         */
+        reader(std::FILE* from, std::vector<column_spec> columns, char delimiter = ',');
+
+        /**
+         * Parses up to max_rows rows, replacing the previous chunk. The header is consumed by the first call.
+         *
+         * @return number of rows in the chunk, 0 at end of input
+         * @throw std::runtime_error on a missing required column, a malformed number, a short row or a quote
+         */
+        std::size_t read(std::size_t max_rows);
+
+        /**
+         * @param column index into the columns passed to the constructor, which must be of type real
+         * @return the values of the current chunk
+         */
+        [[nodiscard]] std::span<const double> real(std::size_t column) const;
+
+        /**
+         * @param column index into the columns passed to the constructor, which must be of type integer
+         * @return the values of the current chunk
+         */
+        [[nodiscard]] std::span<const int> integer(std::size_t column) const;
+
+        /**
+         * @return bytes consumed from the input so far
+         */
+        [[nodiscard]] std::size_t bytes() const;
+
+    private:
+        bool refill();
+        std::size_t parse(const char* begin, const char* end, std::size_t max_rows);
+        void parse_header(const char* begin, const char* end);
+        void finish_row();
+        void store(std::size_t column, std::string_view text, std::size_t line);
+
+        std::FILE* from_;
+        std::vector<column_spec> columns_;
+        char delimiter_;
+
+        std::vector<char> buffer_;
+        std::size_t offset_ = 0;
+        std::size_t bytes_ = 0;
+        std::size_t line_ = 0;
+        bool eof_ = false;
+        bool header_done_ = false;
+
+        std::vector<int> field_to_column_; // -1 for skipped fields
+        std::vector<std::size_t> slot_;    // column -> index into reals_ or integers_
+        std::vector<std::vector<double>> reals_;
+        std::vector<std::vector<int>> integers_;
+        std::vector<std::uint8_t> seen_;
+        std::size_t rows_ = 0;
+    };
+
+    /**
+     * Reads a whole file through reader.
+     *
+     * @param path file to read
+     * @param columns columns to project
+     * @param reals receives one vector per real column, in projection order
+     * @param integers receives one vector per integer column, in projection order
+     * @return number of rows
+     */
+    std::size_t read_file(const std::string& path,
+        const std::vector<column_spec>& columns,
+        std::vector<std::vector<double>>& reals,
+        std::vector<std::vector<int>>& integers,
+        char delimiter = ',');
+
+} // namespace pyfi::csv
+
+#endif // CSV_H
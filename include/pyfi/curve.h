@@ -0,0 +1,125 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef CURVE_H
+#define CURVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace pyfi::curve {
+
+    /**
+     * A coupon bond or swap fixed leg quoted at par: it pays par_rate / m per unit of par m times a year on the
+     * dirty_coupon_price_from_T schedule and its clean price is exactly par.
+     */
+    struct par_instrument {
+        double maturity; // in years
+        double par_rate;
+        int m = 2;
+    };
+
+    /**
+     * Continuously compounded zero curve on pillar times. Between pillars the total rate z * t (minus the log discount
+     * factor) is interpolated linearly, so forwards are flat between pillars; before the first and after the last
+     * pillar the zero rate is held flat.
+     */
+    class zero_curve {
+    public:
+        /**
+         * @param times pillar times, positive and increasing
+         * @param zero_rates zero rate at each pillar
+         * @throw std::invalid_argument if the sizes differ, there are no pillars or the times are not positive and
+         * increasing
+         */
+        zero_curve(std::vector<double> times, std::vector<double> zero_rates);
+
+        [[nodiscard]] double zero_rate(double time) const;
+
+        [[nodiscard]] double discount(double time) const;
+
+        [[nodiscard]] const std::vector<double>& times() const;
+
+        [[nodiscard]] const std::vector<double>& zero_rates() const;
+
+    private:
+        std::vector<double> times_;
+        std::vector<double> zero_rates_;
+    };
+
+    /**
+     * A bootstrapped curve together with its Jacobian.
+     */
+    struct bootstrap_result {
+        zero_curve curve;
+        // d zero_rate_i / d par_rate_k, row major pillars x pillars. Pillar i only depends on the instruments up to
+        // i, so it is lower triangular.
+        std::vector<double> jacobian;
+    };
+
+    /**
+     * Bootstraps one zero pillar per instrument at its maturity, each solved by Newton's method so the instrument
+     * prices at par given the pillars before it. The Jacobian is built along the way: differentiating the par
+     * condition of instrument i gives row i of the Jacobian from the rows before it by forward substitution, so it
+     * costs O(n^2) per pillar and no bumped re-bootstraps.
+     *
+     * @param instruments sorted by maturity
+     * @return the curve and d zero / d par
+     * @throw std::invalid_argument if there are no instruments, the maturities are not positive and increasing, an
+     * instrument has m <= 0 or a pillar cannot be solved for
+     */
+    bootstrap_result bootstrap(std::span<const par_instrument> instruments);
+
+    /**
+     * Compressed sparse row matrix: the entries of row r are column[i], value[i] for i in
+     * [row_start[r], row_start[r + 1]), by increasing column.
+     */
+    struct sparse_matrix {
+        std::size_t rows = 0;
+        std::size_t columns = 0;
+        std::vector<std::size_t> row_start{0};
+        std::vector<std::uint32_t> column;
+        std::vector<double> value;
+    };
+
+    /**
+     * Zero rate risk of coupon bonds priced off the curve on the dirty_coupon_price_from_T schedule: row i holds
+     * d dirty price / d zero_rate_k of bond i, per 1.0 of rate. Each cash flow touches at most two adjacent pillars,
+     * so a bond has entries only on the pillars around its cash flows. Rows are computed in parallel on the default
+     * pool.
+     *
+     * @param curve the discount curve
+     * @param par_value face value of each bond
+     * @param coupon_rate annual coupon rate of each bond
+     * @param years_to_maturity time to maturity of each bond
+     * @param m coupon payments per year of each bond
+     * @param price receives the dirty prices if not empty, same length as the bonds
+     * @return bonds x pillars sensitivities
+     * @throw std::invalid_argument if the sizes differ, a bond has m <= 0 or a non positive maturity
+     */
+    sparse_matrix zero_sensitivities(const zero_curve& curve,
+        std::span<const double> par_value,
+        std::span<const double> coupon_rate,
+        std::span<const double> years_to_maturity,
+        std::span<const int> m,
+        std::span<double> price = {});
+
+    /**
+     * Moves zero rate risk onto the par instruments of the bootstrap: the product zero_risk x jacobian, so row i holds
+     * d price_i / d par_rate_k. With a lower triangular Jacobian, a row whose last entry is on pillar j has entries on
+     * pillars 0 to j only, and the whole book is one pass of sparse row times triangular matrix products, run in
+     * parallel on the default pool.
+     *
+     * @param zero_risk sensitivities to the zero pillars, e.g. from zero_sensitivities
+     * @param curve the bootstrap the pillars come from
+     * @return rows x instruments sensitivities
+     * @throw std::invalid_argument if zero_risk does not have one column per pillar
+     */
+    sparse_matrix par_sensitivities(const sparse_matrix& zero_risk, const bootstrap_result& curve);
+
+} // namespace pyfi::curve
+
+#endif // CURVE_H
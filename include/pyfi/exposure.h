@@ -0,0 +1,164 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef EXPOSURE_H
+#define EXPOSURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "option.h"
+#include "proxy.h"
+
+namespace pyfi::exposure {
+
+    /**
+     * Risk neutral dynamics of the simulated risk factors: the spot follows geometric Brownian motion with drift
+     * r(t) - q, and the short rate r(t) follows a Vasicek process, dr = a (b - r) dt + sigma_r dW, whose zero curve at
+     * each date reprices the rate dependent positions.
+     */
+    struct market_model {
+        double spot;
+        double volatility;
+        double yield_curve = 0.0; // continuous dividend yield q
+        double short_rate; // r(0)
+        double mean_reversion = 0.1; // a, 0 for a Brownian short rate
+        double long_rate; // b
+        double rate_volatility = 0.01; // sigma_r, absolute
+        double correlation = 0.0; // between the spot and short rate drivers
+    };
+
+    /**
+     * quantity European options on the spot, repriced by Black-Scholes with the model volatility and the simulated
+     * zero rate to expiry. Settled at expiry, so it adds nothing from then on.
+     */
+    struct option_position {
+        double strike_price;
+        double maturity; // in years from today
+        option::option_type type;
+        double quantity = 1.0; // negative for a sold option
+    };
+
+    /**
+     * quantity coupon bonds, repriced by dirty_coupon_price_from_T at the simulated zero rate to maturity converted to
+     * the bond's compounding. Redeemed at maturity, so it adds nothing from then on.
+     */
+    struct bond_position {
+        double par_value;
+        double coupon_rate;
+        double maturity; // in years from today
+        int m = 2;
+        double quantity = 1.0;
+    };
+
+    /**
+     * quantity contracts priced by a proxy built over (spot, volatility, time to expiry), for example an American put
+     * whose lattice is too slow to run at every date of every path. The proxy is evaluated at the model volatility;
+     * spots and times outside its box are clamped to the box, so the box should cover the simulated spot range. The
+     * proxy is not owned and must outlive the simulation.
+     */
+    struct proxy_position {
+        const proxy::chebyshev_proxy* proxy;
+        double maturity; // in years from today
+        double quantity = 1.0;
+    };
+
+    /**
+     * One netting set: the exposure at a date is max(sum of the position values, 0).
+     */
+    struct portfolio {
+        std::vector<option_position> options;
+        std::vector<bond_position> bonds;
+        std::vector<proxy_position> proxies;
+    };
+
+    struct exposure_config {
+        std::vector<double> dates; // exposure dates in years, increasing and positive
+        std::vector<double> quantiles = {0.95}; // PFE levels
+        std::size_t paths = 10'000;
+        std::uint64_t seed = 42;
+        double relative_accuracy = 0.005; // of the PFE quantiles
+        std::size_t block = 1024; // paths simulated and repriced together
+    };
+
+    /**
+     * Exposure profile of a netting set, undiscounted.
+     */
+    struct exposure_profile {
+        std::vector<double> dates;
+        std::vector<double> expected_exposure; // EE(t), the mean of max(V(t), 0)
+        std::vector<std::vector<double>> potential_future_exposure; // PFE(t), one row per quantile
+        double expected_positive_exposure; // EPE, EE averaged over (0, last date] weighted by the date spacing
+        std::vector<double> peak_exposure; // the maximum of each PFE row
+    };
+
+    /**
+     * Streaming quantiles of non negative values with a relative accuracy guarantee: values are counted in
+     * logarithmically spaced buckets (the DDSketch scheme), so any quantile is within relative_accuracy of a value of
+     * the right rank and two sketches merge exactly by adding their counts, which makes the result independent of the
+     * order values arrive in. Memory is at most 2048 buckets whatever the number of values; past that range the lowest
+     * buckets are merged, which only coarsens the smallest quantiles.
+     */
+    class quantile_sketch {
+    public:
+        /**
+         * @param relative_accuracy in (0, 1)
+         * @throw std::invalid_argument if relative_accuracy is outside (0, 1)
+         */
+        explicit quantile_sketch(double relative_accuracy = 0.005);
+
+        /**
+         * Adds a value; values at or below 0 are counted as 0.
+         */
+        void add(double value);
+
+        /**
+         * Adds every value counted by other.
+         *
+         * @throw std::invalid_argument if the sketches have different accuracies
+         */
+        void merge(const quantile_sketch& other);
+
+        /**
+         * @param q level in [0, 1]
+         * @return a value within the relative accuracy of the q quantile, 0 if the sketch is empty
+         * @throw std::invalid_argument if q is outside [0, 1]
+         */
+        [[nodiscard]] double quantile(double q) const;
+
+        [[nodiscard]] std::uint64_t count() const;
+
+    private:
+        void add_to_bucket(int index, std::uint64_t count);
+
+        double accuracy_;
+        double log_gamma_;
+        std::uint64_t zeros_ = 0;
+        std::uint64_t count_ = 0;
+        int offset_ = 0; // bucket index of counts_[0]
+        std::vector<std::uint64_t> counts_;
+    };
+
+    /**
+     * Simulates the risk factors on the exposure dates, reprices the portfolio on every path at every date and
+     * aggregates EE and PFE as it goes. Paths are simulated in blocks in parallel on the default pool, each block from
+     * its own generator seeded with (seed, block), so the result does not depend on the number of threads. Each block
+     * is repriced with the batch pricers over its paths and then folded into per date means and quantile sketches, so
+     * memory is a few blocks of scenarios instead of the paths x dates exposure cube. Called from inside a
+     * parallel_for body on the default pool the blocks run inline on that thread.
+     *
+     * @param model the risk factor dynamics
+     * @param netting_set the positions
+     * @param config dates, quantiles, paths and seed
+     * @return the exposure profile
+     * @throw std::invalid_argument if the dates are empty, not increasing or not positive, a quantile is outside
+     * [0, 1], paths or block is 0, relative_accuracy is outside (0, 1), the spot or volatility is not positive, the
+     * correlation is outside [-1, 1], a proxy position has no proxy or a bond has m <= 0
+     */
+    exposure_profile simulate(const market_model& model, const portfolio& netting_set, const exposure_config& config);
+
+} // namespace pyfi::exposure
+
+#endif // EXPOSURE_H
@@ -0,0 +1,408 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef EXPR_H
+#define EXPR_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "option.h"
+
+/*
+ * Lazily evaluated array arithmetic for composing batch formulas. Operators and functions on views and arrays build
+ * an expression tree instead of a temporary vector per step; evaluate() or assigning to an array then runs the whole
+ * formula in one loop over the data with no intermediate allocations:
+ *
+ *      const expr::view S(batch.stock_price), K(batch.strike_price), sigma(batch.volatility), r(batch.risk_free_rate),
+ *          T(batch.time), q(batch.yield_curve);
+ *      const auto d1 = (log(S / K) + (r - q + 0.5 * sigma * sigma) * T) / (sigma * sqrt(T));
+ *      const auto d2 = d1 - sigma * sqrt(T);
+ *      expr::evaluate(S * exp(-q * T) * Phi(d1) - K * exp(-r * T) * Phi(d2), out);
+ *
+ * Expressions hold their operands by view, so the arrays and columns they read must outlive them; building one from
+ * a temporary array does not compile. A named sub expression such as d1 above is recomputed wherever it is used.
+ */
+namespace pyfi::expr {
+
+    /**
+     * Length of an expression that adapts to any length, such as a scalar.
+     */
+    inline constexpr std::size_t any_size = static_cast<std::size_t>(-1);
+
+    /**
+     * Base of every expression node. A node E provides double operator[](std::size_t) and std::size_t size().
+     */
+    template <class E>
+    struct expression {};
+
+    template <class E>
+    concept expression_type = std::is_base_of_v<expression<E>, E>;
+
+    /**
+     * @return the length of an expression over operands of lengths a and b
+     * @throw std::invalid_argument if the lengths differ
+     */
+    inline std::size_t common_size(const std::size_t a, const std::size_t b) {
+        if (a == any_size) {
+            return b;
+        }
+        if (b != any_size && a != b) {
+            throw std::invalid_argument("array expression operands must have the same length");
+        }
+        return a;
+    }
+
+    /**
+     * Non owning leaf over a column, e.g. one of an option_batch or a NumPy array.
+     */
+    class view : public expression<view> {
+    public:
+        explicit view(const std::span<const double> data) : data_(data) {}
+
+        double operator[](const std::size_t i) const {
+            return data_[i];
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return data_.size();
+        }
+
+    private:
+        std::span<const double> data_;
+    };
+
+    /**
+     * Leaf that broadcasts one value to every element.
+     */
+    class scalar : public expression<scalar> {
+    public:
+        explicit scalar(const double value) : value_(value) {}
+
+        double operator[](std::size_t) const {
+            return value_;
+        }
+
+        [[nodiscard]] static std::size_t size() {
+            return any_size;
+        }
+
+    private:
+        double value_;
+    };
+
+    template <class Op, expression_type E>
+    class unary : public expression<unary<Op, E>> {
+    public:
+        explicit unary(E operand) : operand_(std::move(operand)) {}
+
+        double operator[](const std::size_t i) const {
+            return Op{}(operand_[i]);
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return operand_.size();
+        }
+
+    private:
+        E operand_;
+    };
+
+    template <class Op, expression_type L, expression_type R>
+    class binary : public expression<binary<Op, L, R>> {
+    public:
+        binary(L left, R right)
+            : left_(std::move(left)), right_(std::move(right)), size_(common_size(left_.size(), right_.size())) {}
+
+        double operator[](const std::size_t i) const {
+            return Op{}(left_[i], right_[i]);
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return size_;
+        }
+
+    private:
+        L left_;
+        R right_;
+        std::size_t size_;
+    };
+
+    /**
+     * An owning array, the usual destination of an expression. Assigning an expression evaluates it in one loop.
+     */
+    class array {
+    public:
+        array() = default;
+
+        explicit array(const std::size_t n, const double value = 0.0) : data_(n, value) {}
+
+        explicit array(std::vector<double> data) : data_(std::move(data)) {}
+
+        /**
+         * @throw std::invalid_argument if the expression has no length of its own, e.g. a scalar expression
+         */
+        template <expression_type E>
+        array(const E& e) {
+            *this = e;
+        }
+
+        template <expression_type E>
+        array& operator=(const E& e) {
+            const auto n = e.size();
+            if (n == any_size) {
+                throw std::invalid_argument("a scalar expression has no length to evaluate into");
+            }
+            if (n == data_.size()) {
+                // element i only reads element i, so the expression may read this array
+                for (std::size_t i = 0; i < n; ++i) {
+                    data_[i] = e[i];
+                }
+                return *this;
+            }
+            std::vector<double> result(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                result[i] = e[i];
+            }
+            data_ = std::move(result);
+            return *this;
+        }
+
+        double& operator[](const std::size_t i) {
+            return data_[i];
+        }
+
+        double operator[](const std::size_t i) const {
+            return data_[i];
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return data_.size();
+        }
+
+        [[nodiscard]] double* data() {
+            return data_.data();
+        }
+
+        [[nodiscard]] const double* data() const {
+            return data_.data();
+        }
+
+        [[nodiscard]] auto begin() const {
+            return data_.begin();
+        }
+
+        [[nodiscard]] auto end() const {
+            return data_.end();
+        }
+
+        [[nodiscard]] expr::view view() const {
+            return expr::view(data_);
+        }
+
+        operator std::span<const double>() const {
+            return data_;
+        }
+
+        operator std::span<double>() {
+            return data_;
+        }
+
+    private:
+        std::vector<double> data_;
+    };
+
+    /**
+     * Evaluates the expression into out in one pass.
+     *
+     * @throw std::invalid_argument if out is not as long as the expression
+     */
+    template <expression_type E>
+    void evaluate(const E& e, const std::span<double> out) {
+        const auto n = e.size();
+        if (n != any_size && n != out.size()) {
+            throw std::invalid_argument("output size must match the expression size");
+        }
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = e[i];
+        }
+    }
+
+    // leaves of the operators: expressions by value, arrays as views, numbers as scalars. Only named arrays are
+    // operands, an expression over a temporary array would outlive it
+    template <expression_type E>
+    E operand(const E& e) {
+        return e;
+    }
+
+    inline view operand(const array& a) {
+        return a.view();
+    }
+
+    template <class T>
+        requires std::is_arithmetic_v<T>
+    scalar operand(const T value) {
+        return scalar(static_cast<double>(value));
+    }
+
+    template <class T>
+    concept array_operand = expression_type<std::remove_cvref_t<T>> ||
+        (std::is_lvalue_reference_v<T> && std::same_as<std::remove_cvref_t<T>, array>);
+
+    template <class T>
+    concept any_operand = array_operand<T> || std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+    template <class Op, array_operand E>
+    auto make_unary(E&& e) {
+        auto leaf = operand(std::forward<E>(e));
+        return unary<Op, decltype(leaf)>(std::move(leaf));
+    }
+
+    template <class Op, any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto make_binary(L&& left, R&& right) {
+        auto l = operand(std::forward<L>(left));
+        auto r = operand(std::forward<R>(right));
+        return binary<Op, decltype(l), decltype(r)>(std::move(l), std::move(r));
+    }
+
+    struct exp_op {
+        double operator()(const double x) const {
+            return std::exp(x);
+        }
+    };
+
+    struct log_op {
+        double operator()(const double x) const {
+            return std::log(x);
+        }
+    };
+
+    struct sqrt_op {
+        double operator()(const double x) const {
+            return std::sqrt(x);
+        }
+    };
+
+    struct abs_op {
+        double operator()(const double x) const {
+            return std::abs(x);
+        }
+    };
+
+    struct cdf_op {
+        double operator()(const double x) const {
+            return option::Phi(x);
+        }
+    };
+
+    struct pdf_op {
+        double operator()(const double x) const {
+            return option::norm_pdf(x);
+        }
+    };
+
+    struct max_op {
+        double operator()(const double a, const double b) const {
+            return std::max(a, b);
+        }
+    };
+
+    struct min_op {
+        double operator()(const double a, const double b) const {
+            return std::min(a, b);
+        }
+    };
+
+    template <array_operand E>
+    auto operator-(E&& e) {
+        return make_unary<std::negate<>>(std::forward<E>(e));
+    }
+
+    template <any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto operator+(L&& left, R&& right) {
+        return make_binary<std::plus<>>(std::forward<L>(left), std::forward<R>(right));
+    }
+
+    template <any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto operator-(L&& left, R&& right) {
+        return make_binary<std::minus<>>(std::forward<L>(left), std::forward<R>(right));
+    }
+
+    template <any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto operator*(L&& left, R&& right) {
+        return make_binary<std::multiplies<>>(std::forward<L>(left), std::forward<R>(right));
+    }
+
+    template <any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto operator/(L&& left, R&& right) {
+        return make_binary<std::divides<>>(std::forward<L>(left), std::forward<R>(right));
+    }
+
+    template <array_operand E>
+    auto exp(E&& e) {
+        return make_unary<exp_op>(std::forward<E>(e));
+    }
+
+    template <array_operand E>
+    auto log(E&& e) {
+        return make_unary<log_op>(std::forward<E>(e));
+    }
+
+    template <array_operand E>
+    auto sqrt(E&& e) {
+        return make_unary<sqrt_op>(std::forward<E>(e));
+    }
+
+    template <array_operand E>
+    auto abs(E&& e) {
+        return make_unary<abs_op>(std::forward<E>(e));
+    }
+
+    /**
+     * Standard normal CDF of every element, see option::Phi.
+     */
+    template <array_operand E>
+    auto Phi(E&& e) {
+        return make_unary<cdf_op>(std::forward<E>(e));
+    }
+
+    /**
+     * Standard normal density of every element.
+     */
+    template <array_operand E>
+    auto norm_pdf(E&& e) {
+        return make_unary<pdf_op>(std::forward<E>(e));
+    }
+
+    /**
+     * Elementwise maximum, e.g. max(S - K, 0.0) for a call payoff.
+     */
+    template <any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto max(L&& left, R&& right) {
+        return make_binary<max_op>(std::forward<L>(left), std::forward<R>(right));
+    }
+
+    template <any_operand L, any_operand R>
+        requires array_operand<L> || array_operand<R>
+    auto min(L&& left, R&& right) {
+        return make_binary<min_op>(std::forward<L>(left), std::forward<R>(right));
+    }
+
+} // namespace pyfi::expr
+
+#endif // EXPR_H
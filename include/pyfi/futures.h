@@ -0,0 +1,122 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef FUTURES_H
+#define FUTURES_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "bond.h"
+
+namespace pyfi::futures {
+
+    /**
+     * Exchange conversion factor of a deliverable bond: the clean price of one unit of par at the contract's notional
+     * yield, with the time to maturity from the delivery date rounded down to whole maturity_rounding periods (a
+     * quarter for bond and 10 year note contracts, a month for 2 and 5 year notes), rounded to four decimals as the
+     * exchange publishes it. Priced with dirty_coupon_price less accrued_interest on the dirty_coupon_price_from_T
+     * schedule.
+     *
+     * @param coupon_rate annual coupon rate of the bond
+     * @param years_to_maturity time from the delivery date to the bond's maturity
+     * @param m coupon payments per year
+     * @param notional_coupon the contract's notional coupon, e.g. 0.06
+     * @param maturity_rounding period the maturity is rounded down to, in years
+     * @throw std::invalid_argument if m <= 0, maturity_rounding <= 0 or the rounded maturity is not positive
+     */
+    double conversion_factor(double coupon_rate,
+        double years_to_maturity,
+        int m = 2,
+        double notional_coupon = 0.06,
+        double maturity_rounding = 0.25);
+
+    /**
+     * A bond futures contract and its deliverable basket, bonds [first, first + count) of the deliverable batch, so
+     * contracts on the same basket (e.g. consecutive delivery months) can share or overlap ranges.
+     */
+    struct contract {
+        double price; // quoted futures price, per the deliverables' par_value
+        double delivery; // years from today's settlement to the delivery date
+        double repo_rate; // term repo rate to delivery, simple interest on year fractions
+        std::size_t first;
+        std::size_t count;
+        double notional_coupon = 0.06;
+        double maturity_rounding = 0.25; // in years
+    };
+
+    /**
+     * Basis analytics of every (contract, deliverable) pair, one row per pair, contract by contract in basket order:
+     * the rows of contract k are [row_start[k], row_start[k + 1]).
+     *
+     * With C the coupons a deliverable pays before delivery at times t_i, tau the delivery time, r the repo rate and
+     * AI the accrued interest, the columns are
+     *
+     *   gross_basis = clean - F CF
+     *   carry = AI(delivery) - AI(today) + sum C (1 + r (tau - t_i)) - dirty r tau
+     *   net_basis = gross_basis - carry
+     *   implied_repo = (F CF + AI(delivery) + sum C - dirty) / (dirty tau - sum C (tau - t_i))
+     *
+     * so implied_repo is the rate that makes buying the bond, financing it to delivery and delivering it into the
+     * contract break even, and net_basis is zero at a repo rate equal to it.
+     */
+    struct basis_analytics {
+        std::vector<std::size_t> row_start{0};
+        std::vector<std::size_t> deliverable; // index of the row's bond in the deliverable batch
+        std::vector<double> conversion_factor;
+        std::vector<double> clean_price;
+        std::vector<double> dirty_price;
+        std::vector<double> invoice_price; // F CF + AI(delivery)
+        std::vector<double> gross_basis;
+        std::vector<double> carry;
+        std::vector<double> net_basis;
+        std::vector<double> implied_repo;
+        // per contract: the deliverable with the highest implied repo, the cheapest to deliver
+        std::vector<std::size_t> cheapest;
+    };
+
+    /**
+     * Conversion factors, basis and implied repo of every contract's basket in one pass over the pairs, in parallel on
+     * the default pool. The deliverables are priced from their yields with dirty_coupon_price on the
+     * dirty_coupon_price_from_T schedule, from today and from the delivery date.
+     *
+     * @param deliverables the bonds of every basket, years_to_maturity from today's settlement
+     * @param contracts the futures, each with its basket
+     * @return the pairs' analytics
+     * @throw std::invalid_argument if a basket is empty or out of range, a delivery time is not positive, a
+     * deliverable has m <= 0 or does not outlive its contract's delivery by a rounding period
+     */
+    basis_analytics basis(const bond::bond_batch& deliverables, std::span<const contract> contracts);
+
+    /**
+     * Cheapest to deliver under parallel yield shifts, contracts x shifts row major. For each shift every
+     * deliverable's yield moves by it, its forward clean price at delivery is repriced at the contract's repo rate, and
+     * the theoretical futures price is the lowest forward clean price over conversion factor in the basket, which the
+     * cheapest to deliver attains.
+     */
+    struct ctd_switch {
+        std::vector<double> shifts;
+        std::vector<std::size_t> cheapest; // deliverable index
+        std::vector<double> futures_price;
+    };
+
+    /**
+     * Runs the cheapest to deliver over a grid of yield shifts. The schedule, conversion factor and coupons of every
+     * pair are worked out once, so each shift costs one dirty_coupon_price per pair; shifts run in parallel on the
+     * default pool.
+     *
+     * @param deliverables the bonds of every basket, years_to_maturity from today's settlement
+     * @param contracts the futures, each with its basket
+     * @param yield_shifts parallel shifts added to every yield, e.g. -0.02 to 0.02
+     * @return the cheapest to deliver and theoretical futures price at every shift
+     * @throw std::invalid_argument as basis
+     */
+    ctd_switch ctd_switch_analysis(const bond::bond_batch& deliverables,
+        std::span<const contract> contracts,
+        std::span<const double> yield_shifts);
+
+} // namespace pyfi::futures
+
+#endif // FUTURES_H
@@ -0,0 +1,242 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pyfi::memory {
+
+    /**
+     * Where the pages of a buffer are placed on a NUMA machine.
+     */
+    enum class numa_policy {
+        local, // on the node of the thread that first touches each page
+        bind, // all on one node
+        interleave // round robin over every node the process may use
+    };
+
+    /**
+     * How a large buffer is mapped. Batch pricing over millions of rows is bandwidth bound, and with 4 KiB pages a
+     * pass over six input columns walks far more pages than the TLB holds; 2 MiB transparent huge pages cut the page
+     * walks by a factor of 512.
+     */
+    struct placement {
+        bool huge_pages = true; // madvise(MADV_HUGEPAGE) on a huge page aligned mapping, MADV_NOHUGEPAGE if false
+        numa_policy numa = numa_policy::local;
+        int node = 0; // the node for numa_policy::bind
+        bool first_touch = true; // fault the pages in up front from the default pool, chunk by chunk
+    };
+
+    /**
+     * @return the transparent huge page size, 2 MiB on x86-64
+     */
+    std::size_t huge_page_size();
+
+    /**
+     * Maps anonymous zeroed memory for a buffer. The size is rounded up to whole pages, and to whole huge pages when
+     * placement.huge_pages is set, in which case the mapping is also aligned to a huge page. Huge pages are a hint:
+     * if the kernel has them disabled the mapping uses normal pages. Without placement.huge_pages the mapping opts
+     * out of transparent huge pages, so it stays on normal pages even where the kernel defaults to always.
+     *
+     * @param bytes requested size
+     * @param placement huge page and NUMA options
+     * @return the mapping and its size, to be passed to unmap
+     * @throw std::invalid_argument if the NUMA node is out of range
+     * @throw std::runtime_error if the memory cannot be mapped or bound to the requested node
+     */
+    std::pair<void*, std::size_t> map(std::size_t bytes, const placement& placement);
+
+    void unmap(void* data, std::size_t bytes);
+
+    /**
+     * Applies the huge page and NUMA options to an existing page aligned mapping, e.g. a shared memory book.
+     *
+     * @throw std::invalid_argument if the NUMA node is out of range
+     * @throw std::runtime_error if the range cannot be bound to the requested node
+     */
+    void advise(void* data, std::size_t bytes, const placement& placement);
+
+    /**
+     * Faults in every page of [data, data + bytes) with parallel_for on the default pool, so under numa_policy::local
+     * each page lands on the node of a pool thread instead of all on the node of the allocating thread. The bytes
+     * already there are kept. Called from inside a parallel_for body on the default pool it runs inline, so every
+     * page lands on the node of that one thread.
+     *
+     * @param grain bytes per chunk, 0 to split evenly between the pool threads
+     */
+    void first_touch(void* data, std::size_t bytes, std::size_t grain = 0);
+
+    /**
+     * Memory access tuning of the batch kernels (option and bond pricers, Greeks), chosen per call. On books much
+     * larger than the caches the kernels stream six or so input columns and write one or more outputs, and both help
+     * there: prefetching hides the latency of the input reads, and non-temporal stores write results that are not read
+     * back soon straight to memory without first reading their lines into the cache or evicting the inputs. On books
+     * that fit in cache both cost a little, so the default is neither. With lanes of 4, 8 or 16 the kernels price
+     * that many rows at a time with the simd pack kernels of simd.h and the remaining rows one by one; the default of 1
+     * runs the scalar kernel throughout, and simd::native_lanes is the width that suits the target.
+     */
+    struct access_hints {
+        std::size_t prefetch_distance = 0; // rows ahead of the current one to prefetch the inputs, 0 for none
+        bool streaming_stores = false; // write outputs with non-temporal stores
+        std::size_t lanes = 1; // rows per pack: 1, 4, 8 or 16
+    };
+
+    /**
+     * Doubles per 64 byte cache line, the stride at which the kernels issue prefetches.
+     */
+    inline constexpr std::size_t line_doubles = 64 / sizeof(double);
+
+    /**
+     * Prefetches the line holding address into all cache levels for reading.
+     */
+    inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#endif
+    }
+
+    /**
+     * Writes value to address, with a non-temporal store when Streaming and the target has one. Non-temporal stores
+     * are weakly ordered; a kernel that issues them ends with store_fence().
+     */
+    template <bool Streaming>
+    inline void store(double* address, const double value) {
+#if defined(__SSE2__) && defined(__x86_64__)
+        if constexpr (Streaming) {
+            _mm_stream_si64(reinterpret_cast<long long*>(address), std::bit_cast<long long>(value));
+            return;
+        }
+#endif
+        *address = value;
+    }
+
+    /**
+     * Orders earlier non-temporal stores before any later store, so results are visible to other threads once the
+     * kernel returns.
+     */
+    inline void store_fence() {
+#if defined(__SSE2__)
+        _mm_sfence();
+#endif
+    }
+
+    /**
+     * Calls store_fence() when it goes out of scope, so a streaming kernel that throws half way still orders the
+     * stores it issued.
+     */
+    struct fence_guard {
+        fence_guard() = default;
+        fence_guard(const fence_guard&) = delete;
+        fence_guard& operator=(const fence_guard&) = delete;
+
+        ~fence_guard() {
+            store_fence();
+        }
+    };
+
+    /**
+     * A fixed size array of trivially copyable T in its own mapping, zero initialised and placed according to a
+     * placement. Meant for the columns and result buffers of large books; it converts to std::span so it plugs into
+     * option_batch, bond_batch and the batch pricers' outputs.
+     */
+    template <class T>
+    class buffer {
+        static_assert(std::is_trivially_copyable_v<T>, "buffer elements are zero filled and never constructed");
+
+    public:
+        buffer() = default;
+
+        /**
+         * @param size number of elements
+         * @param placement huge page and NUMA options
+         * @throw std::invalid_argument if the NUMA node is out of range
+         * @throw std::runtime_error if the memory cannot be mapped or placed
+         */
+        explicit buffer(const std::size_t size, const placement& placement = {}) : size_(size) {
+            if (size == 0) {
+                return;
+            }
+            const auto [data, bytes] = map(size * sizeof(T), placement);
+            data_ = static_cast<T*>(data);
+            bytes_ = bytes;
+            if (placement.first_touch) {
+                first_touch(data_, bytes_);
+            }
+        }
+
+        buffer(const buffer&) = delete;
+        buffer& operator=(const buffer&) = delete;
+
+        buffer(buffer&& other) noexcept :
+            data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+            bytes_(std::exchange(other.bytes_, 0)) {}
+
+        buffer& operator=(buffer&& other) noexcept {
+            if (this != &other) {
+                release();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                bytes_ = std::exchange(other.bytes_, 0);
+            }
+            return *this;
+        }
+
+        ~buffer() {
+            release();
+        }
+
+        [[nodiscard]] T* data() const {
+            return data_;
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return size_;
+        }
+
+        T& operator[](const std::size_t i) const {
+            return data_[i];
+        }
+
+        [[nodiscard]] T* begin() const {
+            return data_;
+        }
+
+        [[nodiscard]] T* end() const {
+            return data_ + size_;
+        }
+
+        operator std::span<T>() const {
+            return {data_, size_};
+        }
+
+        operator std::span<const T>() const {
+            return {data_, size_};
+        }
+
+    private:
+        void release() {
+            if (data_ != nullptr) {
+                unmap(data_, bytes_);
+                data_ = nullptr;
+            }
+        }
+
+        T* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t bytes_ = 0;
+    };
+
+} // namespace pyfi::memory
+
+#endif // MEMORY_H
@@ -0,0 +1,146 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "option.h"
+
+namespace pyfi::monte_carlo {
+
+    /**
+     * What the payoff is written on.
+     */
+    enum class payoff_style {
+        european, // the terminal spot S_T
+        asian // the arithmetic average of the spot over the monitoring dates
+    };
+
+    /**
+     * Simulation settings. The underlying follows geometric Brownian motion with drift r - q, observed on steps equally
+     * spaced dates in (0, T]. Every call draws from its own generator seeded with seed, so concurrent calls neither
+     * share state nor change each other's results.
+     */
+    struct mc_config {
+        std::size_t paths = 100'000; // antithetic pairs count as two paths
+        std::size_t steps = 1;
+        std::uint64_t seed = 42;
+        bool antithetic = true;
+    };
+
+    struct mc_result {
+        double price;
+        double standard_error;
+    };
+
+    /**
+     * How the Monte Carlo Greeks are estimated. Pathwise differentiates the discounted payoff along each path and is
+     * the low variance choice for continuous payoffs; gamma, which pathwise cannot reach through the kink, uses the
+     * likelihood ratio on the pathwise delta. Likelihood ratio weights the payoff by the score of the path density and
+     * needs no smoothness of the payoff, at the cost of more variance.
+     */
+    enum class greek_estimator { pathwise, likelihood_ratio };
+
+    struct estimate {
+        double value;
+        double standard_error;
+    };
+
+    /**
+     * Price and Greeks from one simulation. Vega is per 1.0 of volatility.
+     */
+    struct mc_greeks {
+        estimate price;
+        estimate delta;
+        estimate gamma;
+        estimate vega;
+    };
+
+    /**
+     * Prices one option by Monte Carlo.
+     *
+     * @param stock_price
+     * @param strike_price
+     * @param volatility
+     * @param risk_free_rate
+     * @param time time to maturity in years
+     * @param yield_curve continuous dividend yield
+     * @param type call or put
+     * @param style european or asian payoff
+     * @param config number of paths, monitoring dates and seed
+     * @return the discounted mean payoff and its standard error
+     * @throw std::invalid_argument if time or volatility is 0, or paths or steps is 0
+     */
+    mc_result price(double stock_price,
+        double strike_price,
+        double volatility,
+        double risk_free_rate,
+        double time,
+        double yield_curve,
+        option::option_type type,
+        payoff_style style,
+        const mc_config& config = {});
+
+    /**
+     * Prices every row of the batch with common random numbers: the normal draws of each path are generated once and
+     * reused for every row, so the price differences between rows (for example bumped copies of one contract) carry
+     * far less noise than independent runs, and the random number generation is paid once for the whole batch.
+     *
+     * @param batch the contracts or scenarios to price
+     * @param type call or put
+     * @param style european or asian payoff
+     * @param config number of paths, monitoring dates and seed, shared by all rows
+     * @param out receives the prices, must have batch.size() elements
+     * @param standard_error receives the standard errors if not empty, must then have batch.size() elements
+     * @throw std::invalid_argument if the sizes do not match, a row has zero time or volatility, or paths or steps is 0
+     */
+    void price_batch(const option::option_batch& batch,
+        option::option_type type,
+        payoff_style style,
+        const mc_config& config,
+        std::span<double> out,
+        std::span<double> standard_error = {});
+
+    /**
+     * Price, delta, gamma and vega of every row of the batch in one pass over the same paths as price_batch, so the
+     * prices agree with it to rounding and the Greeks cost a few multiplies per path instead of extra simulations.
+     *
+     * @param batch the contracts to price
+     * @param type call or put
+     * @param style european or asian payoff
+     * @param config number of paths, monitoring dates and seed, shared by all rows
+     * @param estimator pathwise or likelihood ratio
+     * @param out receives the estimates and their standard errors, must have batch.size() elements
+     * @throw std::invalid_argument if the sizes do not match, a row has zero time or volatility, or paths or steps is 0
+     */
+    void greeks_batch(const option::option_batch& batch,
+        option::option_type type,
+        payoff_style style,
+        const mc_config& config,
+        greek_estimator estimator,
+        std::span<mc_greeks> out);
+
+    /**
+     * Price, delta, gamma and vega of one option, see greeks_batch.
+     *
+     * @throw std::invalid_argument if time or volatility is 0, or paths or steps is 0
+     */
+    mc_greeks greeks(double stock_price,
+        double strike_price,
+        double volatility,
+        double risk_free_rate,
+        double time,
+        double yield_curve,
+        option::option_type type,
+        payoff_style style,
+        greek_estimator estimator = greek_estimator::pathwise,
+        const mc_config& config = {});
+
+} // namespace pyfi::monte_carlo
+
+#endif // MONTE_CARLO_H
@@ -5,8 +5,20 @@
 #ifndef OPTION_H
 #define OPTION_H
 
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
+#include "memory.h"
+
+/*
+ * Thread safety: every pricer, Greek, implied vol and batch function in this header is reentrant. They keep no
+ * static or global mutable state and report errors only by exception, so any number of threads may call them at
+ * once; batch calls are safe as long as their output spans do not overlap.
+ */
 namespace pyfi::option {
     /**
      * custom type for the binomial tree function as it needs a function pointer
@@ -19,10 +31,15 @@ namespace pyfi::option {
      * Gives the probability of some normalised random variable x in a
      * Gaussian distr.
      *
+     * Defined inline on std::erfc, so the batch loops inline it and no function-local state or error policy sits on
+     * the hot path.
+     *
      * @param x the normalised variable
      * @return the resolve of the integral of the gaussian distr.
      */
-    double Phi(double x);
+    inline double Phi(const double x) {
+        return 0.5 * std::erfc(-x / std::numbers::sqrt2);
+    }
 
     /**
      *
@@ -46,7 +63,8 @@ namespace pyfi::option {
 
     /**
      *
-     * Calculates the price of a European call option.
+     * Calculates the price of a European call option on an asset paying a continuous yield:
+     *      C = S * exp(-qT) * N(d1) - K * exp(-rT) * N(d2)
      *
      * @param stock_price
      * @param strike_price
@@ -75,6 +93,7 @@ namespace pyfi::option {
      * @param volatility
      * @param risk_free_rate
      * @param time in years
+     * @param yield_curve
      * @return price of the European put option
      * @throw std::invalid if time or volatility is 0
      */
@@ -85,6 +104,201 @@ namespace pyfi::option {
         double time,
         double yield_curve = 0.0);
 
+    /**
+     * Whether an option is the right to buy (call) or to sell (put) the underlying.
+     */
+    enum class option_type { call, put };
+
+    /**
+     * The generalised Black-Scholes intermediates and the price and Greeks as functions of them, written once on the
+     * value type T: double in bs_kernel and a simd::pack of W contracts in the batch kernels. Everything but evaluate
+     * is arithmetic on T, so the scalar and the pack Greeks are the same expressions term for term.
+     *
+     * Sensitivities are per unit of the input: vega and volga per 1.0 of volatility, rho per 1.0 of rate, and theta,
+     * charm and color per year of calendar time (the derivative w.r.t t = -d/dT).
+     */
+    template <typename T>
+    struct bs_terms {
+        [[nodiscard]] T price(const option_type type) const {
+            if (type == option_type::call) {
+                return stock_price * carry * cdf_d1 - strike_price * discount * cdf_d2;
+            }
+            return strike_price * discount * cdf_minus_d2 - stock_price * carry * cdf_minus_d1;
+        }
+
+        [[nodiscard]] T delta(const option_type type) const {
+            return type == option_type::call ? carry * cdf_d1 : -carry * cdf_minus_d1;
+        }
+
+        [[nodiscard]] T gamma() const {
+            return carry * pdf_d1 / (stock_price * vol_sqrt_time);
+        }
+
+        [[nodiscard]] T theta(const option_type type) const {
+            const T decay = -stock_price * carry * pdf_d1 * volatility * volatility / (2.0 * vol_sqrt_time);
+            const T dividend = (cost_of_carry - risk_free_rate) * stock_price * carry;
+            const T financing = risk_free_rate * strike_price * discount;
+            if (type == option_type::call) {
+                return decay - dividend * cdf_d1 - financing * cdf_d2;
+            }
+            return decay + dividend * cdf_minus_d1 + financing * cdf_minus_d2;
+        }
+
+        [[nodiscard]] T vega() const {
+            return stock_price * carry * pdf_d1 * vol_sqrt_time / volatility;
+        }
+
+        /**
+         * @return dV/dr with the dividend yield q = r - b held fixed. For an option on a future, where b stays 0,
+         * the rate sensitivity is rho(type) - carry_rho(type) = -T * price(type).
+         */
+        [[nodiscard]] T rho(const option_type type) const {
+            const T pv_strike = time * strike_price * discount;
+            return type == option_type::call ? pv_strike * cdf_d2 : -pv_strike * cdf_minus_d2;
+        }
+
+        /**
+         * @return dV/db with r held fixed, which is minus the sensitivity to the dividend yield
+         */
+        [[nodiscard]] T carry_rho(const option_type type) const {
+            const T forward_spot = time * stock_price * carry;
+            return type == option_type::call ? forward_spot * cdf_d1 : -forward_spot * cdf_minus_d1;
+        }
+
+        // d(delta)/d(sigma)
+        [[nodiscard]] T vanna() const {
+            return -carry * pdf_d1 * d2 / volatility;
+        }
+
+        // d(vega)/d(sigma)
+        [[nodiscard]] T volga() const {
+            return vega() * d1 * d2 / volatility;
+        }
+
+        // d(delta)/dt
+        [[nodiscard]] T charm(const option_type type) const {
+            const T dividend = (cost_of_carry - risk_free_rate) * carry;
+            if (type == option_type::call) {
+                return -carry * pdf_d1 * drift() - dividend * cdf_d1;
+            }
+            return -carry * pdf_d1 * drift() + dividend * cdf_minus_d1;
+        }
+
+        // d(gamma)/dS
+        [[nodiscard]] T speed() const {
+            return -gamma() / stock_price * (d1 / vol_sqrt_time + 1.0);
+        }
+
+        // d(gamma)/dt
+        [[nodiscard]] T color() const {
+            return gamma() / (2.0 * time) *
+                (2.0 * (risk_free_rate - cost_of_carry) * time + 1.0 + 2.0 * time * drift() * d1);
+        }
+
+        T stock_price;
+        T strike_price;
+        T volatility;
+        T risk_free_rate;
+        T cost_of_carry;
+        T time;
+
+        T vol_sqrt_time; // sigma * sqrt(T)
+        T d1;
+        T d2;
+        T carry; // e^((b - r)T), the dividend discount e^(-qT)
+        T discount; // e^(-rT)
+        T pdf_d1; // n(d1)
+        T cdf_d1; // N(d1)
+        T cdf_d2; // N(d2)
+        T cdf_minus_d1; // N(-d1), computed directly for deep out of the money accuracy
+        T cdf_minus_d2; // N(-d2)
+
+    protected:
+        /**
+         * Fills the intermediates from the six inputs. Math supplies the static functions sqrt, log, exp, norm_pdf,
+         * Phi, abs, select and any_of on T, so double keeps the standard library and the packs use simd.h.
+         *
+         * @throw std::invalid_argument if time or volatility is 0 in any lane
+         */
+        template <typename Math>
+        void evaluate() {
+            if (Math::any_of(volatility < 1e-9 || time < 1e-9)) {
+                throw std::invalid_argument("Time or volatility cannot be zero");
+            }
+
+            vol_sqrt_time = volatility * Math::sqrt(time);
+            d1 = (Math::log(stock_price / strike_price) + (cost_of_carry + 0.5 * volatility * volatility) * time) /
+                vol_sqrt_time;
+            d2 = d1 - vol_sqrt_time;
+            carry = Math::exp((cost_of_carry - risk_free_rate) * time);
+            discount = Math::exp(-risk_free_rate * time);
+            pdf_d1 = Math::norm_pdf(d1);
+
+            // one cdf per argument: the smaller tail N(-|d|) is evaluated directly and the other is its complement,
+            // so both N(d) and N(-d) keep full relative accuracy where they are small
+            const auto tails = [](const T& d, T& cdf, T& cdf_minus) {
+                const T small = Math::Phi(-Math::abs(d));
+                const auto positive = d >= 0.0;
+                cdf_minus = Math::select(positive, small, 1.0 - small);
+                cdf = Math::select(positive, 1.0 - small, small);
+            };
+            tails(d1, cdf_d1, cdf_minus_d1);
+            tails(d2, cdf_d2, cdf_minus_d2);
+        }
+
+    private:
+        // (2bT - d2 sigma sqrt(T)) / (2T sigma sqrt(T)), shared by charm and color
+        [[nodiscard]] T drift() const {
+            return (2.0 * cost_of_carry * time - d2 * vol_sqrt_time) / (2.0 * time * vol_sqrt_time);
+        }
+    };
+
+    /**
+     * Price and Greeks of a European option under the generalised Black-Scholes model, all evaluated from one set of
+     * shared intermediates. The model is described by the risk free rate r and the cost of carry b: b = r - q for a
+     * stock or index paying a continuous dividend yield q, b = 0 for an option on a future and b = r - r_f for a
+     * currency.
+     *
+     * The constructor does all the transcendental work (one log, one sqrt, three exps and two normal cdfs). The price
+     * and every Greek of both the call and the put are then a few multiplies each, so price plus Greeks costs about
+     * one price. The scalar pricers, the bs_* Greeks and the batch functions are all thin wrappers around it, and the
+     * batch packs are the same bs_terms on simd::pack.
+     */
+    struct bs_kernel : bs_terms<double> {
+        /**
+         * @param stock_price spot S
+         * @param strike_price strike K
+         * @param volatility sigma
+         * @param risk_free_rate continuously compounded r
+         * @param time time to maturity T in years
+         * @param dividend_yield continuous yield q, so that b = r - q
+         * @throw std::invalid_argument if time or volatility is 0
+         */
+        bs_kernel(double stock_price,
+            double strike_price,
+            double volatility,
+            double risk_free_rate,
+            double time,
+            double dividend_yield = 0.0);
+
+        /**
+         * Builds the kernel from the cost of carry directly, e.g. b = 0 for Black-76 options on futures.
+         *
+         * @param cost_of_carry b
+         * @throw std::invalid_argument if time or volatility is 0
+         */
+        static bs_kernel with_carry(double stock_price,
+            double strike_price,
+            double volatility,
+            double risk_free_rate,
+            double time,
+            double cost_of_carry);
+
+    private:
+        bs_kernel() = default;
+        void evaluate();
+    };
+
     /**
      *  Different variation of the normal distribution PDF
      *
@@ -100,7 +314,9 @@ namespace pyfi::option {
      */
     double norm_pdf(double stock_price, double strike_price, double volatility, double risk_free_rate, double time);
 
-    double norm_pdf(double x);
+    inline double norm_pdf(const double x) {
+        return std::numbers::inv_sqrtpi / std::numbers::sqrt2 * std::exp(-0.5 * x * x);
+    }
 
     /**
      * calculates the first derivative of the call option w.r.t its underlying asset price
@@ -191,40 +407,42 @@ namespace pyfi::option {
         double time);
 
     /**
-     * Both put and call rho functions are identical, only difference is that the put function uses -x2. Therefore,
-     * this function will do the final calulation
-     *
-     * @param strike_price
-     * @param risk_free_rate
-     * @param time
-     * @param x2
-     * @return
-     */
-    double bs_rho_calculation(double strike_price, double risk_free_rate, double time, double x2);
-
-    /**
-     * Calculates the first derivative of the call option price w.r.t the interest rate of the underlying asset.
+     * Calculates the first derivative of the call option price w.r.t the interest rate, with the dividend yield held
+     * fixed.
      *
      * @param stock_price
      * @param strike_price
      * @param volatility
      * @param risk_free_rate
+     * @param dividend_yield
      * @param time
      * @return
      */
-    double bs_call_rho(double stock_price, double strike_price, double volatility, double risk_free_rate, double time);
+    double bs_call_rho(double stock_price,
+        double strike_price,
+        double volatility,
+        double risk_free_rate,
+        double dividend_yield,
+        double time);
 
     /**
-     * Calculates the first derivative of the put option price w.r.t the interest rate of the underlying asset.
+     * Calculates the first derivative of the put option price w.r.t the interest rate, with the dividend yield held
+     * fixed.
      *
      * @param stock_price
      * @param strike_price
      * @param volatility
      * @param risk_free_rate
+     * @param dividend_yield
      * @param time
      * @return
      */
-    double bs_put_rho(double stock_price, double strike_price, double volatility, double risk_free_rate, double time);
+    double bs_put_rho(double stock_price,
+        double strike_price,
+        double volatility,
+        double risk_free_rate,
+        double dividend_yield,
+        double time);
 
     /**
      *
@@ -316,6 +534,67 @@ namespace pyfi::option {
         double time,
         payoff_func payoff);
 
+    /**
+     * Step count policy of the adaptive binomial pricers. The tree is priced at min_steps, then at twice as many steps
+     * again and again, until the error estimate is within tolerance or max_steps is reached.
+     */
+    struct binomial_tolerance {
+        double tolerance = 1e-4; // absolute price error to stop at
+        int min_steps = 16;
+        int max_steps = 8192;
+    };
+
+    /**
+     * Result of an adaptive binomial pricer.
+     */
+    struct binomial_estimate {
+        double price;
+        double error; // estimated absolute error of price
+        int steps; // steps of the finest tree priced
+        bool converged; // error <= tolerance; false if max_steps was reached first
+    };
+
+    /**
+     * binomial_eu_option with the step count chosen by tolerance instead of fixed up front, so easy contracts finish
+     * in tens of steps while long dated or deep out of the money ones get more.
+     *
+     * The binomial price converges at first order in 1/steps, so when the steps double the difference between the two
+     * prices is the Richardson estimate of the error left in the finer one. The raw price oscillates with the parity of
+     * the step count and with where the strike falls between nodes, which makes a single difference unreliable; each
+     * level therefore averages the trees of n and n + 1 steps, and the error estimate is the larger of the last
+     * difference and half the one before.
+     *
+     * @param stock_price
+     * @param strike_price
+     * @param volatility
+     * @param risk_free_rate
+     * @param time time to maturity
+     * @param payoff the put or call or custom function
+     * @param tolerance target error and step bounds
+     * @return the price at the finest level, its error estimate and step count
+     * @throw std::invalid_argument if tolerance is not positive or the step bounds are not 1 <= min_steps <= max_steps
+     */
+    binomial_estimate binomial_eu_option_adaptive(double stock_price,
+        double strike_price,
+        double volatility,
+        double risk_free_rate,
+        double time,
+        payoff_func payoff,
+        const binomial_tolerance& tolerance = {});
+
+    /**
+     * binomial_us_option with the step count chosen by tolerance, see binomial_eu_option_adaptive.
+     *
+     * @throw std::invalid_argument if tolerance is not positive or the step bounds are not 1 <= min_steps <= max_steps
+     */
+    binomial_estimate binomial_us_option_adaptive(double stock_price,
+        double strike_price,
+        double volatility,
+        double risk_free_rate,
+        double time,
+        payoff_func payoff,
+        const binomial_tolerance& tolerance = {});
+
 
     /**
      * Computes the forward price of the underlying under continuous compounding:
@@ -348,6 +627,247 @@ namespace pyfi::option {
         double forward_price,
         double risk_free_rate,
         double time);
+
+    /**
+     * Column-oriented view over a book of European options. Every column must have the same length; element i of
+     * each column describes contract i. The view does not own the memory, so the columns can live in NumPy arrays,
+     * std::vectors or a shared memory segment.
+     */
+    struct option_batch {
+        std::span<const double> stock_price;
+        std::span<const double> strike_price;
+        std::span<const double> volatility;
+        std::span<const double> risk_free_rate;
+        std::span<const double> time;
+        std::span<const double> yield_curve;
+
+        /**
+         * @return number of contracts in the batch
+         * @throw std::invalid_argument if the columns differ in length
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * @param offset index of the first contract
+         * @param count number of contracts
+         * @return a view over contracts [offset, offset + count)
+         */
+        [[nodiscard]] option_batch slice(std::size_t offset, std::size_t count) const;
+    };
+
+    /**
+     * Prices every contract of the batch as a European call in a single pass over the columns. Same model as
+     * black_scholes_call; with the default hints.lanes of 1 every row goes through bs_kernel, with 4, 8 or 16 that many
+     * rows at a time go through its simd pack form, which agrees with it to a few ulp.
+     *
+     * @param batch the contracts to price
+     * @param out receives the call prices, must have batch.size() elements
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a contract has zero time or volatility or hints.lanes is
+     * not 1, 4, 8 or 16
+     */
+    void black_scholes_call_batch(const option_batch& batch,
+        std::span<double> out,
+        const memory::access_hints& hints = {});
+
+    /**
+     * Prices every contract of the batch as a European put, see black_scholes_put.
+     *
+     * @param batch the contracts to price
+     * @param out receives the put prices, must have batch.size() elements
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a contract has zero time or volatility or hints.lanes is
+     * not 1, 4, 8 or 16
+     */
+    void black_scholes_put_batch(const option_batch& batch,
+        std::span<double> out,
+        const memory::access_hints& hints = {});
+
+    /**
+     * Output columns of the fused Greeks pass. Any column may be left empty to skip it; the others must have
+     * batch.size() elements. Sensitivities are per unit of the input: vega and volga per 1.0 of volatility, rho per
+     * 1.0 of rate, and theta, charm and color per year of calendar time (the derivative w.r.t t = -d/dT).
+     */
+    struct greeks_batch {
+        std::span<double> price{};
+        std::span<double> delta{};
+        std::span<double> gamma{};
+        std::span<double> theta{};
+        std::span<double> vega{};
+        std::span<double> rho{};
+        std::span<double> vanna{}; // d(delta)/d(sigma)
+        std::span<double> volga{}; // d(vega)/d(sigma)
+        std::span<double> charm{}; // d(delta)/dt
+        std::span<double> speed{}; // d(gamma)/dS
+        std::span<double> color{}; // d(gamma)/dt
+    };
+
+    /**
+     * Prices every contract of the batch as a European call under Black-Scholes-Merton with a continuous yield and
+     * fills the requested Greeks in the same pass. Each contract, or each pack of hints.lanes contracts, is evaluated
+     * by one bs_kernel or its simd pack form, so every first, second and third order Greek is a handful of multiplies
+     * on top of the price.
+     *
+     * @param batch the contracts to price, yield_curve is the continuous dividend yield q
+     * @param out the columns to fill
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a contract has zero time or volatility or hints.lanes is
+     * not 1, 4, 8 or 16
+     */
+    void black_scholes_call_greeks_batch(const option_batch& batch,
+        const greeks_batch& out,
+        const memory::access_hints& hints = {});
+
+    /**
+     * Put counterpart of black_scholes_call_greeks_batch. Gamma, vega, vanna, volga, speed and color are the same for
+     * calls and puts.
+     *
+     * @param batch the contracts to price, yield_curve is the continuous dividend yield q
+     * @param out the columns to fill
+     * @param hints prefetch, streaming store and simd width options, see memory::access_hints
+     * @throw std::invalid_argument if the sizes do not match, a contract has zero time or volatility or hints.lanes is
+     * not 1, 4, 8 or 16
+     */
+    void black_scholes_put_greeks_batch(const option_batch& batch,
+        const greeks_batch& out,
+        const memory::access_hints& hints = {});
+
+    /**
+     * Black-Scholes volatility that reproduces a European option price. The price is converted to the out of the money
+     * side by put-call parity and inverted on the forward, by Newton steps on vega safeguarded by bisection, so deep in
+     * and out of the money quotes converge as well as at the money ones.
+     *
+     * @param price observed option price
+     * @param stock_price
+     * @param strike_price
+     * @param risk_free_rate
+     * @param time in years
+     * @param yield_curve continuous dividend yield
+     * @param type call or put
+     * @return the implied volatility
+     * @throw std::invalid_argument if time, spot or strike is not positive or the price is outside the no-arbitrage
+     * bounds
+     */
+    double implied_volatility(double price,
+        double stock_price,
+        double strike_price,
+        double risk_free_rate,
+        double time,
+        double yield_curve,
+        option_type type);
+
+    /**
+     * implied_volatility for every contract of the batch. The volatility column is the starting guess, the previous
+     * fit for example; any positive guess works. Prices outside the no-arbitrage bounds give NaN rather than throwing,
+     * so one bad quote does not stop a chain.
+     *
+     * @param price observed option prices, batch.size() elements
+     * @param batch the contracts
+     * @param type call or put
+     * @param out receives the implied volatilities, batch.size() elements
+     * @throw std::invalid_argument if the sizes do not match
+     */
+    void implied_volatility_batch(std::span<const double> price,
+        const option_batch& batch,
+        option_type type,
+        std::span<double> out);
+
+    /**
+     * Column-oriented view over an option chain of matched call/put pairs. Element i is the pair on underlying[i]
+     * with strike strike_price[i] and expiry time[i]; rows may come in any order.
+     */
+    struct parity_chain {
+        std::span<const int> underlying; // index into the spot column, 0 based
+        std::span<const double> time;
+        std::span<const double> strike_price;
+        std::span<const double> call_price;
+        std::span<const double> put_price;
+
+        /**
+         * @return number of call/put pairs in the chain
+         * @throw std::invalid_argument if the columns differ in length
+         */
+        [[nodiscard]] std::size_t size() const;
+    };
+
+    /**
+     * Forward and carry implied by put-call parity at one expiry of one underlying.
+     */
+    struct carry_point {
+        int underlying;
+        double time;
+        double forward;
+        double discount;
+        double risk_free_rate; // -ln(discount) / T
+        double yield_curve; // r - ln(F / S) / T, the continuous dividend or borrow yield
+        double residual; // robust scale of the parity residuals, in price units
+        std::size_t pairs;
+    };
+
+    /**
+     * Backs out the implied forward and carry of every expiry of every underlying in the chain. Put-call parity
+     * C - P = D F - D K is fitted across the strikes of each expiry by Huber-weighted least squares, so a few stale or
+     * crossed quotes do not move the fit: the slope gives the discount factor D and the intercept the forward F.
+     * Underlyings are fitted in parallel on the default pool.
+     *
+     * @param chain the call/put pairs
+     * @param spot spot price of each underlying, indexed by chain.underlying
+     * @return one point per expiry with at least two distinct strikes, sorted by underlying then time
+     * @throw std::invalid_argument if an underlying index is out of range, a time or spot is not positive, or a fit
+     * gives a non positive discount factor or forward
+     */
+    std::vector<carry_point> implied_carry_batch(const parity_chain& chain, std::span<const double> spot);
+
+    /**
+     * The put-call parity fit of implied_carry_batch for the pairs of a single expiry.
+     *
+     * @param strike_price strikes of the pairs, at least two distinct
+     * @param call_price call prices
+     * @param put_price put prices
+     * @param spot spot price of the underlying
+     * @param time expiry in years
+     * @return the fitted point, with underlying 0
+     * @throw std::invalid_argument if the sizes differ, there are fewer than two distinct strikes, the spot or time is
+     * not positive, or the fit gives a non positive discount factor or forward
+     */
+    carry_point implied_carry(std::span<const double> strike_price,
+        std::span<const double> call_price,
+        std::span<const double> put_price,
+        double spot,
+        double time);
+
+    /**
+     * Term structure of implied carry built from implied_carry_batch, in the form the batch pricers take it. Between
+     * pillars the total carry q * T is interpolated linearly, beyond the first and last pillar the yield is held flat.
+     */
+    class carry_curve {
+    public:
+        /**
+         * @param points pillars in any order, at most one per underlying and time
+         */
+        explicit carry_curve(std::vector<carry_point> points);
+
+        /**
+         * @return the implied yield of the underlying at time
+         * @throw std::invalid_argument if the underlying has no pillar
+         */
+        [[nodiscard]] double yield(int underlying, double time) const;
+
+        /**
+         * Fills the yield_curve column of an option batch.
+         *
+         * @param underlying underlying of each contract
+         * @param time time to maturity of each contract
+         * @param out receives the yields, same length as time
+         * @throw std::invalid_argument if the sizes do not match or an underlying has no pillar
+         */
+        void yield_batch(std::span<const int> underlying, std::span<const double> time, std::span<double> out) const;
+
+        [[nodiscard]] const std::vector<carry_point>& points() const;
+
+    private:
+        std::vector<carry_point> points_;
+    };
 } // namespace pyfi::option
 
 #endif // OPTION_H
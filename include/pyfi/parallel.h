@@ -0,0 +1,82 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pyfi::parallel {
+
+    /**
+     * Body of a parallel loop, called with a half-open range [begin, end) of iterations.
+     */
+    using range_func = std::function<void(std::size_t begin, std::size_t end)>;
+
+    /**
+     * A fixed set of worker threads that run parallel loops. The calling thread takes part in every loop, so a pool
+     * of one thread runs loops inline.
+     */
+    class thread_pool {
+    public:
+        /**
+         * @param threads total number of threads including the caller, 0 for std::thread::hardware_concurrency
+         */
+        explicit thread_pool(std::size_t threads = 0);
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+        ~thread_pool();
+
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * Splits [0, n) into chunks of at most grain iterations and runs body over them on every thread of the pool.
+         * Returns once all chunks are done. If a chunk throws, the remaining chunks are skipped and the first
+         * exception is rethrown on the calling thread. Loops on one pool started from different threads are
+         * serialised; a loop started from inside a body running on this pool runs inline on that thread instead, so
+         * nested loops do not deadlock. A body must not start a loop on another pool whose bodies loop back on this
+         * one.
+         *
+         * @param n number of iterations
+         * @param grain iterations per chunk, 0 to split n evenly between the threads
+         * @param body called once per chunk
+         */
+        void parallel_for(std::size_t n, std::size_t grain, const range_func& body);
+
+    private:
+        struct job;
+
+        void work(job& current);
+        void worker_loop();
+
+        std::vector<std::thread> workers_;
+        std::mutex loop_mutex_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        job* job_ = nullptr;
+        std::size_t generation_ = 0;
+        std::size_t busy_ = 0;
+        bool stopping_ = false;
+    };
+
+    /**
+     * @return a process wide pool sized to the hardware, created on first use
+     */
+    thread_pool& default_pool();
+
+    /**
+     * parallel_for on the default pool.
+     */
+    void parallel_for(std::size_t n, std::size_t grain, const range_func& body);
+
+} // namespace pyfi::parallel
+
+#endif // PARALLEL_H
@@ -0,0 +1,120 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pyfi::profile {
+
+    /**
+     * Hardware events read around every profiled call, through perf_event_open on Linux.
+     */
+    enum class event { cycles, instructions, cache_references, cache_misses, branches, branch_misses };
+
+    inline constexpr std::size_t event_count = 6;
+
+    /**
+     * Totals of one profiled function over every call made while a session was open. When the kernel counts more
+     * events than the PMU has counters it time slices them, and the counts are scaled up by the share of time each was
+     * running.
+     */
+    struct counters {
+        std::uint64_t calls = 0;
+        std::uint64_t rows = 0; // contracts or bonds priced, where the function works on a batch
+        double seconds = 0.0;
+        std::uint64_t hardware_calls = 0; // calls whose hardware events were read
+        std::array<std::uint64_t, event_count> events{};
+
+        [[nodiscard]] std::uint64_t operator[](const event e) const {
+            return events[static_cast<std::size_t>(e)];
+        }
+
+        /**
+         * @return instructions per cycle, 0 if no cycles were counted
+         */
+        [[nodiscard]] double ipc() const;
+
+        counters& operator+=(const counters& other);
+        counters& operator-=(const counters& other);
+    };
+
+    struct entry {
+        std::string name;
+        counters totals;
+    };
+
+    /**
+     * Whether a session is open; profiled functions check this and cost one atomic load when none is.
+     */
+    bool enabled();
+
+    /**
+     * @return whether the hardware events can be read on the calling thread. They cannot in most containers, or
+     * where /proc/sys/kernel/perf_event_paranoid forbids it; the profile then has calls and wall time only.
+     */
+    bool hardware_available();
+
+    /**
+     * Profiles the enclosing call under name while a session is open: wall time, and the hardware events of the
+     * calling thread. Scopes are inclusive, so a profiled function that calls another is charged for both. A batch
+     * that a parallel loop splits across the pool counts one call per chunk, each on its own thread.
+     */
+    class scope {
+    public:
+        /**
+         * @param name profiled function, must outlive the scope (a string literal)
+         * @param rows rows the call works on, 0 if it is not a batch
+         */
+        explicit scope(std::string_view name, std::size_t rows = 0);
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+        ~scope();
+
+    private:
+        std::string_view name_;
+        std::size_t rows_;
+        bool active_ = false;
+        bool hardware_ = false;
+        std::chrono::steady_clock::time_point start_;
+        std::array<std::uint64_t, event_count + 2> start_events_{}; // events, then time enabled and time running
+    };
+
+    /**
+     * Turns profiling on for its lifetime and collects what the profiled functions record meanwhile, from every
+     * thread. Sessions may overlap; each one sees only the calls made since it opened.
+     */
+    class session {
+    public:
+        session();
+
+        session(const session&) = delete;
+        session& operator=(const session&) = delete;
+        ~session();
+
+        /**
+         * @return the totals of every function called since the session opened, sorted by name
+         */
+        [[nodiscard]] std::vector<entry> results() const;
+
+    private:
+        std::vector<entry> baseline_;
+    };
+
+    /**
+     * @return results as a table: calls, ns per call and per row, cycles, IPC, cache miss and branch mispredict rates
+     */
+    std::string format(const std::vector<entry>& results);
+
+} // namespace pyfi::profile
+
+#endif // PROFILE_H
@@ -0,0 +1,126 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef PROXY_H
+#define PROXY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace pyfi::proxy {
+
+    /**
+     * Price of one fixed contract as a function of the market state; strike, rate, style and the like are bound into
+     * the function. Called concurrently from the default pool while a proxy is built, so it must be reentrant, which
+     * every pricer in this library is.
+     */
+    using pricer = std::function<double(double spot, double volatility, double time)>;
+
+    /**
+     * One dimension of the sampling grid: nodes Chebyshev points on [lower, upper], clustered towards the ends.
+     */
+    struct axis {
+        double lower;
+        double upper;
+        int nodes = 12;
+    };
+
+    /**
+     * The box of market states a proxy covers and how finely it is sampled. A smooth pricer converges geometrically
+     * in the node count; volatility and time are usually smoother than spot and need fewer nodes. Kinks (an expiry
+     * near 0, a barrier inside the box) slow the convergence down, so keep them outside the box.
+     */
+    struct proxy_config {
+        axis spot;
+        axis volatility;
+        axis time;
+        double drop_tolerance = 0.0; // coefficients below this are dropped, trading accuracy for evaluation speed
+    };
+
+    /**
+     * Chebyshev interpolant of a pricer over (spot, volatility, time). Building samples the pricer once on the tensor
+     * grid of Chebyshev points, in parallel, and turns the samples into a tensor of Chebyshev coefficients; each
+     * evaluation afterwards is a sum over those coefficients, a few hundred nanoseconds for a 16 x 8 x 8 grid instead
+     * of milliseconds for a lattice or Monte Carlo run.
+     * Coefficients below proxy_config::drop_tolerance are dropped, which leaves a sparse set that evaluates faster.
+     * Evaluation is const and reentrant.
+     */
+    class chebyshev_proxy {
+    public:
+        /**
+         * Samples price with parallel_for on the default pool, or inline when called from inside a parallel_for body
+         * on it.
+         *
+         * @param price the pricer to approximate, called nodes_spot * nodes_volatility * nodes_time times
+         * @param config the box and node counts
+         * @throw std::invalid_argument if an axis has lower >= upper or fewer than 2 or more than 64 nodes, or
+         * drop_tolerance is negative
+         */
+        chebyshev_proxy(const pricer& price, const proxy_config& config);
+
+        /**
+         * @return the interpolated price
+         * @throw std::invalid_argument if the point is outside the box
+         */
+        [[nodiscard]] double operator()(double spot, double volatility, double time) const;
+
+        /**
+         * Interpolated prices of many market states.
+         *
+         * @param out receives the prices, same length as the inputs
+         * @throw std::invalid_argument if the sizes differ or a point is outside the box
+         */
+        void evaluate_batch(std::span<const double> spot,
+            std::span<const double> volatility,
+            std::span<const double> time,
+            std::span<double> out) const;
+
+        /**
+         * A priori bound on the interpolation error anywhere in the box: the size of the highest order coefficients
+         * along each axis, which estimates the truncated tail of a converging Chebyshev series, plus the sum of the
+         * dropped coefficients, which bounds the error their removal adds since every Chebyshev polynomial is at most 1
+         * in magnitude. If it is not small the box needs more nodes or is too wide for the pricer's smoothness.
+         */
+        [[nodiscard]] double error_estimate() const;
+
+        /**
+         * A posteriori check: the largest difference between the proxy and the pricer at random points of the box.
+         *
+         * @param price the pricer the proxy was built from
+         * @param points number of random points, priced in parallel
+         * @param seed random seed
+         */
+        [[nodiscard]] double max_error(const pricer& price, std::size_t points, std::uint64_t seed = 42) const;
+
+        /**
+         * @return number of coefficients kept after dropping
+         */
+        [[nodiscard]] std::size_t coefficients() const;
+
+        [[nodiscard]] const proxy_config& config() const;
+
+    private:
+        [[nodiscard]] double evaluate(double spot, double volatility, double time) const;
+
+        // the time coefficients of one spot and volatility order, coefficient_[offset, offset + length)
+        struct row {
+            std::uint8_t spot;
+            std::uint8_t volatility;
+            std::uint32_t offset;
+            std::uint32_t length;
+        };
+
+        proxy_config config_;
+        std::vector<row> rows_;
+        std::vector<double> coefficient_;
+        double truncation_error_ = 0.0;
+        double dropped_error_ = 0.0;
+    };
+
+} // namespace pyfi::proxy
+
+#endif // PROXY_H
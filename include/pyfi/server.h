@@ -0,0 +1,158 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace pyfi::server {
+
+    /**
+     * What a request asks for. Option requests use fields as (S, K, sigma, r, T, q), bond requests as
+     * (par_value, coupon_rate, annual_yield, years_to_maturity) together with m.
+     */
+    enum class request_kind : std::uint32_t { call = 0, put = 1, bond_dirty = 2, bond_clean = 3 };
+
+    /**
+     * Status of a response. Anything but ok leaves the value as NaN.
+     */
+    enum class response_status : std::int32_t { ok = 0, bad_kind = 1, bad_input = 2 };
+
+    /**
+     * Flat wire format of a request, 64 bytes in host byte order. Clients may pipeline any number of requests on one
+     * connection; responses for a connection come back in request order and carry the request id.
+     */
+    struct price_request {
+        std::uint64_t id;
+        request_kind kind;
+        std::int32_t m;
+        double fields[6];
+    };
+
+    /**
+     * Flat wire format of a response, 24 bytes in host byte order.
+     */
+    struct price_response {
+        std::uint64_t id;
+        response_status status;
+        std::uint32_t reserved;
+        double value;
+    };
+
+    static_assert(sizeof(price_request) == 64, "price_request is a wire format");
+    static_assert(sizeof(price_response) == 24, "price_response is a wire format");
+
+    /**
+     * Batching parameters of the server.
+     *
+     * The server keeps an EWMA of the request arrival rate and waits for target_batch requests, i.e. for
+     * target_batch / rate, clamped to [min_window, max_window]. If even max_window would not gather target_batch
+     * requests the server flushes after min_window, so a lightly loaded server does not add latency waiting for a
+     * batch that will not form. A batch is always flushed as soon as it reaches max_batch: the server reads no more
+     * from its clients than the batch has room for and leaves the rest in the sockets for the next batch.
+     */
+    struct server_config {
+        std::string socket_path;
+        std::size_t target_batch = 256;
+        std::size_t max_batch = 8192;
+        std::chrono::microseconds min_window{10};
+        std::chrono::microseconds max_window{1000};
+    };
+
+    /**
+     * Counters of a running server, safe to read from any thread.
+     */
+    struct server_stats {
+        std::uint64_t requests = 0;
+        std::uint64_t batches = 0;
+        std::uint64_t connections = 0;
+    };
+
+    /**
+     * A pricing server on a Unix domain socket. A single event loop reads requests from every connection, batches
+     * them over an adaptive window and prices each batch with the vectorised batch pricers.
+     */
+    class pricing_server {
+    public:
+        /**
+         * Binds and listens on config.socket_path, replacing a stale socket file.
+         *
+         * @throw std::invalid_argument if the batch sizes or windows are inconsistent
+         * @throw std::runtime_error if the socket cannot be created
+         */
+        explicit pricing_server(server_config config);
+
+        pricing_server(const pricing_server&) = delete;
+        pricing_server& operator=(const pricing_server&) = delete;
+
+        /**
+         * Closes every connection and removes the socket file.
+         */
+        ~pricing_server();
+
+        /**
+         * Serves requests until stop is called.
+         */
+        void run();
+
+        /**
+         * Asks run to return. Safe to call from any thread or a signal handler.
+         */
+        void stop() const;
+
+        [[nodiscard]] server_stats stats() const;
+
+        /**
+         * @return the batching window currently in use
+         */
+        [[nodiscard]] std::chrono::microseconds window() const;
+
+    private:
+        struct state;
+
+        server_config config_;
+        int listen_fd_ = -1;
+        int wake_fds_[2] = {-1, -1};
+        std::unique_ptr<state> state_;
+    };
+
+    /**
+     * Blocking client for pricing_server, used by the load generator and the tests.
+     */
+    class pricing_client {
+    public:
+        /**
+         * @throw std::runtime_error if the server cannot be reached
+         */
+        explicit pricing_client(const std::string& socket_path);
+
+        pricing_client(const pricing_client&) = delete;
+        pricing_client& operator=(const pricing_client&) = delete;
+        ~pricing_client();
+
+        /**
+         * Writes all requests to the socket.
+         */
+        void send(std::span<const price_request> requests) const;
+
+        /**
+         * Reads exactly responses.size() responses.
+         *
+         * @throw std::runtime_error if the server closes the connection
+         */
+        void receive(std::span<price_response> responses) const;
+
+    private:
+        int fd_ = -1;
+    };
+
+} // namespace pyfi::server
+
+#endif // SERVER_H
@@ -0,0 +1,543 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <numbers>
+
+#include "memory.h"
+
+#if __has_include(<experimental/simd>) && !defined(PYFI_NO_STD_SIMD)
+#include <experimental/simd>
+#endif
+
+/*
+ * Fixed width packs of doubles for the batch kernels. A kernel is written once as a template on the width W and
+ * instantiated for 4, 8 and 16 lanes; the compiler maps each pack operation onto whatever vector registers the target
+ * has (two SSE2 registers for a pack of 4, one AVX-512 register for a pack of 8), so there are no intrinsics per ISA.
+ *
+ * With libstdc++ the packs are std::experimental::simd on the target's native ABI for W, or fixed_size where it has
+ * none of that width. Elsewhere, or when PYFI_NO_STD_SIMD is defined,
+ * they are a plain array whose operators are fixed length loops that the auto vectorizer turns into the same code.
+ * Both expose the same small interface: arithmetic and comparison operators, load, store, select, any_of, and the
+ * transcendental functions below, which are written on the pack operations only. The standard library's own exp and
+ * log on a simd call the scalar function once per lane, so the kernels use these instead.
+ */
+namespace pyfi::simd {
+
+    /**
+     * Pack width that fills one vector register of the target, and 1 where the registers are too narrow for the packs
+     * to beat the scalar kernels (SSE2 has two lanes and no fused multiply add). A value for access_hints::lanes.
+     */
+#if defined(__AVX512F__)
+    inline constexpr std::size_t native_lanes = 8;
+#elif defined(__AVX2__)
+    inline constexpr std::size_t native_lanes = 4;
+#else
+    inline constexpr std::size_t native_lanes = 1;
+#endif
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+    namespace stdx = std::experimental;
+
+    template <std::size_t W>
+    using pack = stdx::simd<double, stdx::simd_abi::deduce_t<double, W>>;
+
+    template <std::size_t W>
+    using int_pack = stdx::simd<std::uint64_t, stdx::simd_abi::deduce_t<std::uint64_t, W>>;
+
+    template <std::size_t W>
+    using mask = typename pack<W>::mask_type;
+
+    template <std::size_t W>
+    inline pack<W> load(const double* address) {
+        return pack<W>(address, stdx::element_aligned);
+    }
+
+    template <std::size_t W>
+    inline pack<W> load(const int* address) {
+        return stdx::static_simd_cast<pack<W>>(stdx::fixed_size_simd<int, W>(address, stdx::element_aligned));
+    }
+
+    template <std::size_t W>
+    inline void store_to(const pack<W>& value, double* address) {
+        value.copy_to(address, stdx::element_aligned);
+    }
+
+    template <std::size_t W>
+    inline pack<W> select(const mask<W>& condition, const pack<W>& if_true, const pack<W>& if_false) {
+        auto out = if_false;
+        stdx::where(condition, out) = if_true;
+        return out;
+    }
+
+    template <std::size_t W>
+    inline bool any_of(const mask<W>& condition) {
+        return stdx::any_of(condition);
+    }
+
+    template <std::size_t W>
+    inline pack<W> abs(const pack<W>& x) {
+        return stdx::abs(x);
+    }
+
+    template <std::size_t W>
+    inline pack<W> sqrt(const pack<W>& x) {
+        return stdx::sqrt(x);
+    }
+
+    template <std::size_t W>
+    inline pack<W> min(const pack<W>& a, const pack<W>& b) {
+        return stdx::min(a, b);
+    }
+
+    template <std::size_t W>
+    inline pack<W> max(const pack<W>& a, const pack<W>& b) {
+        return stdx::max(a, b);
+    }
+
+    template <std::size_t W>
+    inline int_pack<W> to_bits(const pack<W>& x) {
+        return stdx::__proposed::simd_bit_cast<int_pack<W>>(x);
+    }
+
+    template <std::size_t W>
+    inline pack<W> from_bits(const int_pack<W>& x) {
+        return stdx::__proposed::simd_bit_cast<pack<W>>(x);
+    }
+#else
+    /**
+     * W lanes of T, with element wise operators.
+     */
+    template <typename T, std::size_t W>
+    struct basic_pack {
+        T lane[W];
+
+        basic_pack() = default;
+
+        basic_pack(const T value) { // NOLINT(google-explicit-constructor): broadcasts like std::experimental::simd
+            for (std::size_t i = 0; i < W; ++i) {
+                lane[i] = value;
+            }
+        }
+
+        T operator[](const std::size_t i) const {
+            return lane[i];
+        }
+
+        template <typename F>
+        static basic_pack generate(const F& f) {
+            basic_pack out;
+            for (std::size_t i = 0; i < W; ++i) {
+                out.lane[i] = f(i);
+            }
+            return out;
+        }
+
+        friend basic_pack operator-(const basic_pack& a) {
+            return generate([&](const std::size_t i) { return static_cast<T>(-a.lane[i]); });
+        }
+
+#define PYFI_SIMD_OPERATOR(op)                                                                                         \
+    friend basic_pack operator op(const basic_pack& a, const basic_pack& b) {                                          \
+        return generate([&](const std::size_t i) { return static_cast<T>(a.lane[i] op b.lane[i]); });                  \
+    }                                                                                                                  \
+    basic_pack& operator op##=(const basic_pack& b) {                                                                  \
+        return *this = *this op b;                                                                                     \
+    }
+        PYFI_SIMD_OPERATOR(+)
+        PYFI_SIMD_OPERATOR(-)
+        PYFI_SIMD_OPERATOR(*)
+        PYFI_SIMD_OPERATOR(/)
+#undef PYFI_SIMD_OPERATOR
+
+        friend basic_pack operator&(const basic_pack& a, const basic_pack& b) {
+            return generate([&](const std::size_t i) { return static_cast<T>(a.lane[i] & b.lane[i]); });
+        }
+
+        friend basic_pack operator|(const basic_pack& a, const basic_pack& b) {
+            return generate([&](const std::size_t i) { return static_cast<T>(a.lane[i] | b.lane[i]); });
+        }
+
+        friend basic_pack operator<<(const basic_pack& a, const int shift) {
+            return generate([&](const std::size_t i) { return static_cast<T>(a.lane[i] << shift); });
+        }
+
+        friend basic_pack operator>>(const basic_pack& a, const int shift) {
+            return generate([&](const std::size_t i) { return static_cast<T>(a.lane[i] >> shift); });
+        }
+
+#define PYFI_SIMD_COMPARISON(op)                                                                                       \
+    friend basic_pack<bool, W> operator op(const basic_pack& a, const basic_pack& b) {                                 \
+        return basic_pack<bool, W>::generate([&](const std::size_t i) { return a.lane[i] op b.lane[i]; });             \
+    }
+        PYFI_SIMD_COMPARISON(<)
+        PYFI_SIMD_COMPARISON(<=)
+        PYFI_SIMD_COMPARISON(>)
+        PYFI_SIMD_COMPARISON(>=)
+        PYFI_SIMD_COMPARISON(==)
+        PYFI_SIMD_COMPARISON(!=)
+        PYFI_SIMD_COMPARISON(&&)
+        PYFI_SIMD_COMPARISON(||)
+#undef PYFI_SIMD_COMPARISON
+
+        friend basic_pack operator!(const basic_pack& a) {
+            return generate([&](const std::size_t i) { return !a.lane[i]; });
+        }
+    };
+
+    template <std::size_t W>
+    using pack = basic_pack<double, W>;
+
+    template <std::size_t W>
+    using int_pack = basic_pack<std::uint64_t, W>;
+
+    template <std::size_t W>
+    using mask = basic_pack<bool, W>;
+
+    template <std::size_t W>
+    inline pack<W> load(const double* address) {
+        return pack<W>::generate([&](const std::size_t i) { return address[i]; });
+    }
+
+    template <std::size_t W>
+    inline pack<W> load(const int* address) {
+        return pack<W>::generate([&](const std::size_t i) { return static_cast<double>(address[i]); });
+    }
+
+    template <std::size_t W>
+    inline void store_to(const pack<W>& value, double* address) {
+        for (std::size_t i = 0; i < W; ++i) {
+            address[i] = value[i];
+        }
+    }
+
+    template <std::size_t W>
+    inline pack<W> select(const mask<W>& condition, const pack<W>& if_true, const pack<W>& if_false) {
+        return pack<W>::generate([&](const std::size_t i) { return condition[i] ? if_true[i] : if_false[i]; });
+    }
+
+    template <std::size_t W>
+    inline bool any_of(const mask<W>& condition) {
+        bool any = false;
+        for (std::size_t i = 0; i < W; ++i) {
+            any = any || condition[i];
+        }
+        return any;
+    }
+
+    template <std::size_t W>
+    inline pack<W> abs(const pack<W>& x) {
+        return pack<W>::generate([&](const std::size_t i) { return std::abs(x[i]); });
+    }
+
+    template <std::size_t W>
+    inline pack<W> sqrt(const pack<W>& x) {
+        return pack<W>::generate([&](const std::size_t i) { return std::sqrt(x[i]); });
+    }
+
+    template <std::size_t W>
+    inline pack<W> min(const pack<W>& a, const pack<W>& b) {
+        return pack<W>::generate([&](const std::size_t i) { return b[i] < a[i] ? b[i] : a[i]; });
+    }
+
+    template <std::size_t W>
+    inline pack<W> max(const pack<W>& a, const pack<W>& b) {
+        return pack<W>::generate([&](const std::size_t i) { return a[i] < b[i] ? b[i] : a[i]; });
+    }
+
+    template <std::size_t W>
+    inline int_pack<W> to_bits(const pack<W>& x) {
+        return int_pack<W>::generate([&](const std::size_t i) { return std::bit_cast<std::uint64_t>(x[i]); });
+    }
+
+    template <std::size_t W>
+    inline pack<W> from_bits(const int_pack<W>& x) {
+        return pack<W>::generate([&](const std::size_t i) { return std::bit_cast<double>(x[i]); });
+    }
+#endif
+
+    /**
+     * Writes value to [address, address + W), lane by lane with non-temporal stores when Streaming.
+     */
+    template <bool Streaming, std::size_t W>
+    inline void store(double* address, const pack<W>& value) {
+        if constexpr (Streaming) {
+            for (std::size_t i = 0; i < W; ++i) {
+                memory::store<true>(address + i, value[i]);
+            }
+        } else {
+            store_to<W>(value, address);
+        }
+    }
+
+    /**
+     * Largest integer not above x, for |x| < 2^51.
+     */
+    template <std::size_t W>
+    inline pack<W> floor(const pack<W>& x) {
+        constexpr double round = 0x1.8p52;
+        const pack<W> nearest = (x + round) - round;
+        return select<W>(nearest > x, nearest - 1.0, nearest);
+    }
+
+    /**
+     * Smallest integer not below x, for |x| < 2^51.
+     */
+    template <std::size_t W>
+    inline pack<W> ceil(const pack<W>& x) {
+        constexpr double round = 0x1.8p52;
+        const pack<W> nearest = (x + round) - round;
+        return select<W>(nearest < x, nearest + 1.0, nearest);
+    }
+
+    /**
+     * e^x, within 1 ulp over the normal range.
+     */
+    template <std::size_t W>
+    pack<W> exp(const pack<W>& x) {
+        constexpr double round = 0x1.8p52; // adding it rounds to an integer kept in the low mantissa bits
+        constexpr double ln2_high = 6.93147180369123816490e-01; // 32 significant bits, so n * ln2_high is exact
+        constexpr double ln2_low = 1.90821492927058770002e-10;
+        constexpr double lowest = -746.0;
+        constexpr double highest = 709.79;
+        // 1 / k! for k = 13 down to 2: the Taylor remainder past r^13 is below 2^-60 on |r| <= ln(2) / 2
+        constexpr double inverse_factorial[] = {1.0 / 6227020800.0,
+            1.0 / 479001600.0,
+            1.0 / 39916800.0,
+            1.0 / 3628800.0,
+            1.0 / 362880.0,
+            1.0 / 40320.0,
+            1.0 / 5040.0,
+            1.0 / 720.0,
+            1.0 / 120.0,
+            1.0 / 24.0,
+            1.0 / 6.0,
+            1.0 / 2.0};
+
+        const pack<W> n = (x * std::numbers::log2e + round) - round;
+        const pack<W> r = (x - n * ln2_high) - n * ln2_low; // |r| <= ln(2) / 2
+
+        pack<W> p(inverse_factorial[0]);
+        for (std::size_t k = 1; k < std::size(inverse_factorial); ++k) {
+            p = p * r + inverse_factorial[k];
+        }
+        p = (p * r + 1.0) * r + 1.0;
+
+        // 2^n as 2^half 2^(n - half), which both stay normal where 2^n alone would not at either end of the range.
+        // Each integer k is the low bits of k + round, and shifting them into the exponent field drops the rest.
+        const pack<W> half = (n * 0.5 + round) - round;
+        const auto power = [&](const pack<W>& k) {
+            return from_bits<W>((to_bits<W>(k + round) + 1023) << 52);
+        };
+        const pack<W> out = p * power(half) * power(n - half);
+
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        const pack<W> finite = select<W>(x < lowest, pack<W>(0.0), select<W>(x != x, x, out));
+        return select<W>(x > highest, pack<W>(infinity), finite);
+    }
+
+    /**
+     * Natural logarithm, within 2 ulp. 0 gives -inf and negative values NaN.
+     */
+    template <std::size_t W>
+    pack<W> log(const pack<W>& x) {
+        constexpr std::uint64_t mantissa_bits = (std::uint64_t{1} << 52) - 1;
+        constexpr std::uint64_t one_bits = std::uint64_t{1023} << 52;
+        constexpr std::uint64_t exponent_to_double = std::uint64_t{0x433} << 52; // 2^52 plus the exponent field
+
+        // subnormals are scaled into the normal range first
+        const auto tiny = x < std::numeric_limits<double>::min();
+        const pack<W> normal = select<W>(tiny, x * 0x1p54, x);
+
+        // x = m 2^e with m in [sqrt(2) / 2, sqrt(2))
+        const auto bits = to_bits<W>(normal);
+        pack<W> m = from_bits<W>((bits & mantissa_bits) | one_bits);
+        pack<W> e = from_bits<W>((bits >> 52) | exponent_to_double) - (0x1p52 + 1023.0);
+        e = select<W>(tiny, e - 54.0, e);
+        const auto high = m > std::numbers::sqrt2;
+        m = select<W>(high, m * 0.5, m);
+        e = select<W>(high, e + 1.0, e);
+
+        // log(m) = 2 atanh(f) = 2 (f + f^3 / 3 + f^5 / 5 + ...) with |f| <= 0.172, to f^21
+        const pack<W> f = (m - 1.0) / (m + 1.0);
+        const pack<W> f2 = f * f;
+        constexpr double inverse_odd[] = {1.0 / 19.0,
+            1.0 / 17.0,
+            1.0 / 15.0,
+            1.0 / 13.0,
+            1.0 / 11.0,
+            1.0 / 9.0,
+            1.0 / 7.0,
+            1.0 / 5.0,
+            1.0 / 3.0,
+            1.0};
+        pack<W> series(1.0 / 21.0);
+        for (const double c : inverse_odd) {
+            series = series * f2 + c;
+        }
+        const pack<W> out = e * std::numbers::ln2 + 2.0 * f * series;
+
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        const pack<W> nan(std::numeric_limits<double>::quiet_NaN());
+        const pack<W> special = select<W>(x == 0.0, pack<W>(-infinity), nan);
+        return select<W>(x > 0.0 && x < infinity, out, select<W>(x == infinity, x, special));
+    }
+
+    /**
+     * The standard normal density.
+     */
+    template <std::size_t W>
+    pack<W> norm_pdf(const pack<W>& x) {
+        return std::numbers::inv_sqrtpi / std::numbers::sqrt2 * exp<W>(-0.5 * x * x);
+    }
+
+    /**
+     * The standard normal distribution function, 0.5 erfc(-x / sqrt(2)), within a few ulp. erfc is evaluated with
+     * the double precision minimax rationals Boost.Math uses: erf(z) = z (Y + P(z^2) / Q(z^2)) below z = 0.5 and
+     * erfc(z) = e^(-z^2) / z (Y + P(t) / Q(t)) on four intervals above. A pack only evaluates the rationals of the
+     * intervals its lanes fall in. The smaller tail N(-|x|) is computed directly and the other is its complement, so
+     * both keep their relative accuracy where they are small.
+     */
+    template <std::size_t W>
+    pack<W> Phi(const pack<W>& x) {
+        using coefficients = std::initializer_list<double>;
+        // Y + P(t) / Q(t) with the coefficients highest power first
+        const auto rational = [](const double y, const pack<W>& t, const coefficients p, const coefficients q) {
+            const auto polynomial = [&](const coefficients c) {
+                pack<W> sum(*c.begin());
+                for (auto k = c.begin() + 1; k != c.end(); ++k) {
+                    sum = sum * t + *k;
+                }
+                return sum;
+            };
+            return y + polynomial(p) / polynomial(q);
+        };
+
+        const pack<W> z = abs<W>(x) / std::numbers::sqrt2;
+        const pack<W> zz = z * z;
+        pack<W> tail(0.0);
+
+        const auto small = z < 0.5;
+        if (any_of<W>(small)) {
+            const pack<W> erf = z *
+                rational(1.044948577880859375,
+                    zz,
+                    {-0.000322780120964605683831,
+                        -0.00772758345802133288487,
+                        -0.0509990735146777432841,
+                        -0.338165134459360935041,
+                        0.0834305892146531832907},
+                    {0.000370900071787748000569,
+                        0.00858571925074406212772,
+                        0.0875222600142252549554,
+                        0.455004033050794024546,
+                        1.0});
+            tail = select<W>(small, 1.0 - erf, tail);
+        }
+        if (!any_of<W>(!small)) {
+            return select<W>(x > 0.0, 1.0 - 0.5 * tail, 0.5 * tail);
+        }
+
+        pack<W> scaled(0.0); // erfc(z) z e^(z^2)
+        const auto first = !small && z < 1.5;
+        if (any_of<W>(first)) {
+            scaled = select<W>(first,
+                rational(0.405935764312744140625,
+                    z - 0.5,
+                    {0.00180424538297014223957,
+                        0.0195049001251218801359,
+                        0.0888900368967884466578,
+                        0.191003695796775433986,
+                        0.178114665841120341155,
+                        -0.098090592216281240205},
+                    {0.337511472483094676155e-5,
+                        0.0113385233577001411017,
+                        0.12385097467900864233,
+                        0.578052804889902404909,
+                        1.42628004845511324508,
+                        1.84759070983002217845,
+                        1.0}),
+                scaled);
+        }
+        const auto second = z >= 1.5 && z < 2.5;
+        if (any_of<W>(second)) {
+            scaled = select<W>(second,
+                rational(0.50672817230224609375,
+                    z - 1.5,
+                    {0.000235839115596880717416,
+                        0.00323962406290842133584,
+                        0.0175679436311802092299,
+                        0.04394818964209516296,
+                        0.0386540375035707201728,
+                        -0.0243500476207698441272},
+                    {0.00410369723978904575884,
+                        0.0563921837420478160373,
+                        0.325732924782444448493,
+                        0.982403709157920235114,
+                        1.53991494948552447182,
+                        1.0}),
+                scaled);
+        }
+        const auto third = z >= 2.5 && z < 4.5;
+        if (any_of<W>(third)) {
+            scaled = select<W>(third,
+                rational(0.5405750274658203125,
+                    z - 3.5,
+                    {0.113212406648847561139e-4,
+                        0.000250269961544794627958,
+                        0.00212825620914618649141,
+                        0.00840807615555585383007,
+                        0.0137384425896355332126,
+                        0.00295276716530971662634},
+                    {0.000479411269521714493907,
+                        0.0105982906484876531489,
+                        0.0958492726301061423444,
+                        0.442597659481563127003,
+                        1.04217814166938418171,
+                        1.0}),
+                scaled);
+        }
+        const auto fourth = z >= 4.5;
+        if (any_of<W>(fourth)) {
+            scaled = select<W>(fourth,
+                rational(0.5579090118408203125,
+                    1.0 / z,
+                    {-2.8175401114513378771,
+                        -3.22729451764143718517,
+                        -2.5518551727311523996,
+                        -0.687717681153649930619,
+                        -0.212652252872804219852,
+                        0.0175389834052493308818,
+                        0.00628057170626964891937},
+                    {5.48409182238641741584,
+                        13.5064170191802889145,
+                        22.9367376522880577224,
+                        15.930646027911794143,
+                        11.0567237927800161565,
+                        2.79257750980575282228,
+                        1.0}),
+                scaled);
+        }
+
+        // z^2 is rounded, which costs up to z^2 ulp in e^(-z^2); z = high + low with high on 26 bits gives its rounding
+        // error exactly, and e^(-error) = 1 - error at that size
+        const pack<W> high = from_bits<W>(to_bits<W>(z) & ~((std::uint64_t{1} << 27) - 1));
+        const pack<W> low = z - high;
+        const pack<W> error = ((high * high - zz) + 2.0 * high * low) + low * low;
+        tail = select<W>(small, tail, scaled * (exp<W>(-zz) * (1.0 - error)) / z);
+        return select<W>(x > 0.0, 1.0 - 0.5 * tail, 0.5 * tail);
+    }
+
+} // namespace pyfi::simd
+
+#endif // SIMD_H
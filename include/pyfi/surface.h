@@ -0,0 +1,98 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef SURFACE_H
+#define SURFACE_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace pyfi::surface {
+
+    /**
+     * Raw bid/ask quotes of one underlying. Row i holds the call and put quotes at strike_price[i] and expiry time[i];
+     * a side with a non positive bid or an ask below its bid counts as missing. Rows may come in any order.
+     */
+    struct quote_chain {
+        std::span<const double> time;
+        std::span<const double> strike_price;
+        std::span<const double> call_bid;
+        std::span<const double> call_ask;
+        std::span<const double> put_bid;
+        std::span<const double> put_ask;
+
+        /**
+         * @return number of rows
+         * @throw std::invalid_argument if the columns differ in length
+         */
+        [[nodiscard]] std::size_t size() const;
+    };
+
+    struct surface_config {
+        double max_relative_spread = 0.5; // (ask - bid) / mid above which a quote is dropped
+        double outlier_threshold = 4.0; // robust deviations from the smile fit above which a vol is dropped
+        std::size_t min_quotes = 3; // cleaned vols an expiry needs to enter the surface
+    };
+
+    /**
+     * The cleaned implied vols of one expiry against log moneyness ln(K / F).
+     */
+    struct smile {
+        double time;
+        double forward;
+        double discount;
+        std::vector<double> moneyness; // ascending
+        std::vector<double> volatility;
+        std::size_t rejected; // quotes dropped by the spread, no-arbitrage and outlier filters
+
+        /**
+         * @return the vol at log moneyness k, total variance linear between quotes and flat vol beyond them
+         */
+        [[nodiscard]] double volatility_at(double k) const;
+    };
+
+    /**
+     * Implied vol surface on a regular grid of expiries and log moneyness, with the smiles it was built from.
+     */
+    struct vol_surface {
+        std::vector<smile> smiles; // ascending time
+        std::vector<double> time; // grid rows
+        std::vector<double> moneyness; // grid columns, ln(K / F)
+        std::vector<double> forward; // forward of each grid row
+        std::vector<double> volatility; // time.size() x moneyness.size(), row major
+
+        /**
+         * Between smiles total variance is interpolated linearly in time at fixed log moneyness; before the first and
+         * after the last smile the vol is held flat.
+         *
+         * @return the vol at any expiry and log moneyness
+         */
+        [[nodiscard]] double volatility_at(double time, double k) const;
+    };
+
+    /**
+     * Builds a cleaned implied vol surface for one underlying from raw quotes. Per expiry, in parallel: the forward
+     * and discount factor come from a robust put-call parity fit on the mids, the out of the money mid of every strike
+     * is inverted on that forward, vols whose quotes are too wide or violate no-arbitrage bounds are dropped, and so
+     * are vols that stray from a quadratic fit of the smile by more than outlier_threshold robust deviations. The
+     * cleaned smiles are then interpolated onto the grid.
+     *
+     * @param quotes the raw quotes
+     * @param spot spot price of the underlying
+     * @param grid_time expiries of the output grid
+     * @param grid_moneyness log moneyness ln(K / F) of the output grid
+     * @param config the cleaning thresholds
+     * @return the surface
+     * @throw std::invalid_argument if the sizes do not match, spot is not positive or no expiry survives the cleaning
+     */
+    vol_surface build_surface(const quote_chain& quotes,
+        double spot,
+        std::span<const double> grid_time,
+        std::span<const double> grid_moneyness,
+        const surface_config& config = {});
+
+} // namespace pyfi::surface
+
+#endif // SURFACE_H
@@ -0,0 +1,110 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace pyfi::trace {
+
+    /**
+     * Starts recording spans, dropping any recorded before. Each thread records into its own fixed size buffer with
+     * no locks or atomic read-modify-writes; a thread whose buffer is full drops its later spans and counts them.
+     * Meant to be called between jobs, not while traced work is running.
+     *
+     * @param spans_per_thread capacity of each thread's buffer, allocated the first time the thread records
+     * @throw std::invalid_argument if spans_per_thread is 0
+     */
+    void start(std::size_t spans_per_thread = 1 << 16);
+
+    /**
+     * Stops recording. The spans recorded so far are kept until the next start().
+     */
+    void stop();
+
+    /**
+     * Whether spans are being recorded; a span costs one atomic load when they are not.
+     */
+    bool enabled();
+
+    /**
+     * @return spans dropped since start() because a thread's buffer was full
+     */
+    std::size_t dropped();
+
+    /**
+     * Names the calling thread in the trace, e.g. "pool worker 3". Threads without a name show as their id.
+     */
+    void set_thread_name(std::string name);
+
+    /**
+     * @return a copy of name with static storage, for spans whose names are only known at run time. Each distinct
+     * name is kept once for the life of the process.
+     */
+    const char* intern(std::string_view name);
+
+    /**
+     * Records the enclosing scope as one complete event on the calling thread while tracing is enabled.
+     */
+    class span {
+    public:
+        /**
+         * @param name stage, e.g. "option.black_scholes_call_greeks_batch"; must have static storage
+         * @param category group of stages, e.g. "parsing", "curve", "pricing", "greeks" or "pool"
+         * @param rows rows the stage works on, exported as an argument; 0 to leave it out
+         */
+        span(const char* name, const char* category, std::size_t rows = 0) {
+            if (enabled()) {
+                name_ = name;
+                category_ = category;
+                rows_ = rows;
+                start_ = std::chrono::steady_clock::now();
+            }
+        }
+
+        span(const span&) = delete;
+        span& operator=(const span&) = delete;
+
+        ~span() {
+            if (name_ != nullptr) {
+                record(name_, category_, rows_, start_, std::chrono::steady_clock::now());
+            }
+        }
+
+    private:
+        static void record(const char* name,
+            const char* category,
+            std::size_t rows,
+            std::chrono::steady_clock::time_point begin,
+            std::chrono::steady_clock::time_point end);
+
+        const char* name_ = nullptr;
+        const char* category_ = nullptr;
+        std::size_t rows_ = 0;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * Writes every recorded span as Chrome trace event JSON, which chrome://tracing and ui.perfetto.dev open: one
+     * complete ("X") event per span with microsecond timestamps from start(), and a thread name record per thread.
+     * Spans still being recorded by other threads may or may not be included.
+     */
+    void write_json(std::ostream& out);
+
+    /**
+     * write_json to a file.
+     *
+     * @throw std::runtime_error if the file cannot be written
+     */
+    void write_json(const std::string& path);
+
+} // namespace pyfi::trace
+
+#endif // TRACE_H
@@ -0,0 +1,36 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef ARRAY_BIND_H
+#define ARRAY_BIND_H
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <span>
+#include <stdexcept>
+
+namespace py = pybind11;
+
+/**
+ * NumPy arrays accepted by the batch functions. forcecast converts lists and other dtypes, c_style guarantees a
+ * contiguous buffer that can be viewed as a std::span without copying.
+ */
+using double_array = py::array_t<double, py::array::c_style | py::array::forcecast>;
+using int_array = py::array_t<int, py::array::c_style | py::array::forcecast>;
+
+template <typename T>
+std::span<const T> as_span(const py::array_t<T, py::array::c_style | py::array::forcecast>& array) {
+    if (array.ndim() != 1) {
+        throw std::invalid_argument("expected a one dimensional array");
+    }
+    return {array.data(), static_cast<std::size_t>(array.size())};
+}
+
+template <typename T>
+std::span<T> as_mutable_span(py::array_t<T, py::array::c_style | py::array::forcecast>& array) {
+    return {array.mutable_data(), static_cast<std::size_t>(array.size())};
+}
+
+#endif // ARRAY_BIND_H
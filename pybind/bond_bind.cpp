@@ -5,11 +5,13 @@
 #include "bond_bind.h"
 #include <pybind11/pybind11.h>
 #include "../include/pyfi/bond.h"
+#include "array_bind.h"
 
 namespace py = pybind11;
 
 void add_bond_module(py::module_& m) {
     using namespace pyfi::bond;
+    using pyfi::memory::access_hints;
 
     m.def("present_value",
         &present_value,
@@ -447,4 +449,100 @@ void add_bond_module(py::module_& m) {
         m :
             Coupon payments per year.
         )doc");
+
+    const auto batch_pricer = [](void (*pricer)(const bond_batch&, std::span<double>, const access_hints&)) {
+        return [pricer](const double_array& par_value,
+                   const double_array& coupon_rate,
+                   const double_array& annual_yield,
+                   const double_array& years_to_maturity,
+                   const int_array& m,
+                   const std::size_t prefetch_distance,
+                   const bool streaming_stores,
+                   const std::size_t lanes) {
+            const bond_batch batch{
+                as_span(par_value), as_span(coupon_rate), as_span(annual_yield), as_span(years_to_maturity), as_span(m)};
+
+            double_array out(static_cast<py::ssize_t>(batch.size()));
+            auto out_span = as_mutable_span(out);
+            {
+                py::gil_scoped_release release;
+                pricer(batch, out_span, {prefetch_distance, streaming_stores, lanes});
+            }
+            return out;
+        };
+    };
+
+    m.def("dirty_coupon_price_from_T_batch",
+        batch_pricer(&dirty_coupon_price_from_T_batch),
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("annual_yield"),
+        py::arg("years_to_maturity"),
+        py::arg("m"),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        dirty_coupon_price_from_T_batch(
+            par_value: ndarray,
+            coupon_rate: ndarray,
+            annual_yield: ndarray,
+            years_to_maturity: ndarray,
+            m: ndarray,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> ndarray
+
+        Dirty prices for a whole book of bonds in one call. Element i of every
+        array describes bond i; all arrays must have the same length.
+
+        Parameters
+        ----------
+        prefetch_distance :
+            Rows ahead to prefetch the inputs, 0 for none.
+        streaming_stores :
+            Write the prices with non-temporal stores that bypass the cache.
+        lanes :
+            Rows priced together in one simd pack: 1, 4, 8 or 16. 1 runs the
+            scalar kernel; wider packs pay off on AVX2 and AVX-512 builds.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a bond has m <= 0 or lanes is not 1, 4, 8
+            or 16.
+        )doc");
+
+    m.def("clean_coupon_price_from_T_batch",
+        batch_pricer(&clean_coupon_price_from_T_batch),
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("annual_yield"),
+        py::arg("years_to_maturity"),
+        py::arg("m"),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        clean_coupon_price_from_T_batch(
+            par_value: ndarray,
+            coupon_rate: ndarray,
+            annual_yield: ndarray,
+            years_to_maturity: ndarray,
+            m: ndarray,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> ndarray
+
+        Clean prices for a whole book of bonds in one call, see
+        dirty_coupon_price_from_T_batch.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a bond has m <= 0 or lanes is not 1, 4, 8
+            or 16.
+        )doc");
 }
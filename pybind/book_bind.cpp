@@ -0,0 +1,137 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "book_bind.h"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "../include/pyfi/book.h"
+
+namespace py = pybind11;
+
+void add_book_module(py::module_& m) {
+    using namespace pyfi::book;
+
+    py::enum_<option_column>(m, "OptionColumn")
+        .value("stock_price", option_column::stock_price)
+        .value("strike_price", option_column::strike_price)
+        .value("volatility", option_column::volatility)
+        .value("risk_free_rate", option_column::risk_free_rate)
+        .value("time", option_column::time)
+        .value("yield_curve", option_column::yield_curve)
+        .value("call", option_column::call)
+        .value("put", option_column::put);
+
+    py::enum_<bond_column>(m, "BondColumn")
+        .value("par_value", bond_column::par_value)
+        .value("coupon_rate", bond_column::coupon_rate)
+        .value("annual_yield", bond_column::annual_yield)
+        .value("years_to_maturity", bond_column::years_to_maturity)
+        .value("dirty_price", bond_column::dirty_price)
+        .value("clean_price", bond_column::clean_price);
+
+    // columns are returned as NumPy views into the mapping; the view keeps the book (and so the mapping) alive
+    const auto view = [](const py::object& owner, auto column) {
+        return py::array_t<typename decltype(column)::element_type>(
+            {static_cast<py::ssize_t>(column.size())}, {sizeof(*column.data())}, column.data(), owner);
+    };
+
+    py::class_<shared_book>(m,
+        "SharedBook",
+        R"doc(
+        Option and bond book stored in POSIX shared memory.
+
+        The parent creates the book, fills the input columns through the NumPy
+        views and forks workers. Each worker calls price_options(worker) and
+        price_bonds(worker), which read the inputs in place and write into the
+        worker's own slice of the output columns, so no data is pickled or
+        copied between processes. Spawned processes use SharedBook.attach(name).
+        )doc")
+        .def_static("create",
+            &shared_book::create,
+            py::arg("name"),
+            py::arg("options"),
+            py::arg("bonds"),
+            py::arg("workers"),
+            R"doc(
+            create(name: str, options: int, bonds: int, workers: int) -> SharedBook
+
+            Creates a zero initialised book. Fails if `name` already exists.
+            )doc")
+        .def_static("attach",
+            &shared_book::attach,
+            py::arg("name"),
+            R"doc(
+            attach(name: str) -> SharedBook
+
+            Maps a book created by another process.
+            )doc")
+        .def("unlink",
+            &shared_book::unlink,
+            R"doc(
+            Removes the shared memory name. Existing mappings stay valid.
+            )doc")
+        .def_property_readonly("name", &shared_book::name)
+        .def_property_readonly("options", &shared_book::options)
+        .def_property_readonly("bonds", &shared_book::bonds)
+        .def_property_readonly("workers", &shared_book::workers)
+        .def(
+            "option_column",
+            [view](const py::object& self, const option_column column) {
+                return view(self, self.cast<const shared_book&>().column(column));
+            },
+            py::arg("column"),
+            "Writable NumPy view of an option column.")
+        .def(
+            "bond_column",
+            [view](const py::object& self, const bond_column column) {
+                return view(self, self.cast<const shared_book&>().column(column));
+            },
+            py::arg("column"),
+            "Writable NumPy view of a bond column.")
+        .def(
+            "compounding",
+            [view](const py::object& self) {
+                return view(self, self.cast<const shared_book&>().compounding());
+            },
+            "Writable NumPy view of the bonds' coupon frequencies m.")
+        .def("option_range", &shared_book::option_range, py::arg("worker"))
+        .def("bond_range", &shared_book::bond_range, py::arg("worker"))
+        .def(
+            "advise",
+            [](const shared_book& self, const bool huge_pages, const pyfi::memory::numa_policy numa, const int node) {
+                self.advise({huge_pages, numa, node, false});
+            },
+            py::arg("huge_pages") = true,
+            py::arg("numa") = pyfi::memory::numa_policy::local,
+            py::arg("node") = 0,
+            R"doc(
+            advise(huge_pages: bool = True, numa: NumaPolicy = NumaPolicy.local, node: int = 0) -> None
+
+            Applies huge page and NUMA options to this process' mapping of the
+            book. Call it before the pages are first written.
+            )doc")
+        .def("first_touch",
+            &shared_book::first_touch,
+            py::arg("worker"),
+            R"doc(
+            Faults in the worker's slice of every column from the calling
+            process, so the pages land on the worker's NUMA node. Each worker
+            calls it once before the parent fills the inputs.
+            )doc")
+        .def("price_options",
+            &shared_book::price_options,
+            py::arg("worker"),
+            py::call_guard<py::gil_scoped_release>(),
+            R"doc(
+            Prices the worker's slice of the options into the call and put columns.
+            )doc")
+        .def("price_bonds",
+            &shared_book::price_bonds,
+            py::arg("worker"),
+            py::call_guard<py::gil_scoped_release>(),
+            R"doc(
+            Prices the worker's slice of the bonds into the dirty and clean price columns.
+            )doc");
+}
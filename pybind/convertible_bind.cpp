@@ -0,0 +1,123 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "convertible_bind.h"
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <tuple>
+#include <vector>
+#include "../include/pyfi/convertible.h"
+
+namespace py = pybind11;
+
+void add_convertible_module(py::module_& m) {
+    using namespace pyfi::convertible;
+    using provision_row = std::tuple<double, double, double>;
+
+    m.def(
+        "price",
+        [](const double par_value,
+            const double coupon_rate,
+            const double maturity,
+            const double conversion_ratio,
+            const double stock_price,
+            const double volatility,
+            const double risk_free_rate,
+            const double credit_spread,
+            const double yield_curve,
+            const int steps,
+            const int m,
+            const std::vector<provision_row>& calls,
+            const std::vector<provision_row>& puts) {
+            convertible_bond bond{par_value, coupon_rate, maturity, conversion_ratio, m};
+            for (const auto& [start, end, call] : calls) {
+                bond.calls.push_back({start, end, call});
+            }
+            for (const auto& [start, end, put] : puts) {
+                bond.puts.push_back({start, end, put});
+            }
+            const market_data market{stock_price, volatility, risk_free_rate, credit_spread, yield_curve};
+            convertible_result out;
+            {
+                py::gil_scoped_release release;
+                out = price(bond, market, steps);
+            }
+
+            py::dict result;
+            result["price"] = out.price;
+            result["equity_part"] = out.equity_part;
+            result["debt_part"] = out.debt_part;
+            result["bond_floor"] = out.bond_floor;
+            result["conversion_value"] = out.conversion_value;
+            result["delta"] = out.delta;
+            result["gamma"] = out.gamma;
+            return result;
+        },
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("maturity"),
+        py::arg("conversion_ratio"),
+        py::arg("stock_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("credit_spread") = 0.0,
+        py::arg("yield_curve") = 0.0,
+        py::arg("steps") = 500,
+        py::arg("m") = 2,
+        py::arg("calls") = std::vector<provision_row>{},
+        py::arg("puts") = std::vector<provision_row>{},
+        R"doc(
+        price(
+            par_value: float,
+            coupon_rate: float,
+            maturity: float,
+            conversion_ratio: float,
+            stock_price: float,
+            volatility: float,
+            risk_free_rate: float,
+            credit_spread: float = 0.0,
+            yield_curve: float = 0.0,
+            steps: int = 500,
+            m: int = 2,
+            calls: list[tuple[float, float, float]] = [],
+            puts: list[tuple[float, float, float]] = []
+        ) -> dict[str, float]
+
+        Convertible bond price on a binomial lattice with the
+        Tsiveriotis-Fernandes split: the part of the value that ends up in
+        shares is discounted at the risk free rate, the part paid in cash at
+        the risk free rate plus the issuer's credit spread. Only one column of
+        the lattice is held at a time, so memory grows with steps and not
+        steps squared.
+
+        Parameters
+        ----------
+        par_value, coupon_rate, maturity, m :
+            The bond, coupons on the dirty_coupon_price_from_T schedule.
+        conversion_ratio :
+            Shares received per bond on conversion, at any step.
+        stock_price, volatility, yield_curve :
+            The stock and its continuous dividend yield.
+        risk_free_rate, credit_spread :
+            Continuous rates; cash owed by the issuer is discounted at their
+            sum.
+        calls, puts :
+            (start, end, price) windows in years from today in which the
+            issuer may call, or the holder put, the bond at price. A called
+            holder may still convert.
+
+        Returns
+        -------
+        dict
+            price, equity_part, debt_part, bond_floor, conversion_value and
+            the lattice delta and gamma with respect to stock_price.
+
+        Raises
+        ------
+        ValueError
+            If steps < 2, the maturity, volatility or stock price is not
+            positive, m <= 0, the conversion ratio is negative or the lattice
+            is too coarse for a risk neutral probability.
+        )doc");
+}
@@ -0,0 +1,245 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "credit_bind.h"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <vector>
+#include "../include/pyfi/credit.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_credit_module(py::module_& m) {
+    using namespace pyfi::credit;
+    using pyfi::bond::bond_batch;
+    using pyfi::curve::bootstrap_result;
+
+    py::class_<hazard_curve>(m,
+        "HazardCurve",
+        R"doc(
+        HazardCurve(times: ndarray, hazards: ndarray) -> HazardCurve
+
+        Piecewise constant hazard rate curve: hazards[i] is the default
+        intensity up to times[i] from the pillar before it, and the last one is
+        held flat after the last pillar.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, the times are not positive and increasing
+            or a hazard is negative.
+        )doc")
+        .def(py::init([](const double_array& times, const double_array& hazards) {
+            const auto t = as_span(times);
+            const auto h = as_span(hazards);
+            return hazard_curve({t.begin(), t.end()}, {h.begin(), h.end()});
+        }),
+            py::arg("times"),
+            py::arg("hazards"))
+        .def_property_readonly("times",
+            [](const hazard_curve& self) {
+                return py::array_t<double>(static_cast<py::ssize_t>(self.times().size()), self.times().data());
+            })
+        .def_property_readonly("hazards",
+            [](const hazard_curve& self) {
+                return py::array_t<double>(static_cast<py::ssize_t>(self.hazards().size()), self.hazards().data());
+            })
+        .def("hazard", &hazard_curve::hazard, py::arg("time"))
+        .def("survival", &hazard_curve::survival, py::arg("time"));
+
+    m.def(
+        "bootstrap",
+        [](const bootstrap_result& curve,
+            const double_array& maturity,
+            const double_array& spread,
+            const double recovery,
+            const int m) {
+            const auto t = as_span(maturity);
+            const auto s = as_span(spread);
+            if (s.size() != t.size()) {
+                throw std::invalid_argument("maturity and spread must have the same length");
+            }
+            std::vector<cds> quotes;
+            for (std::size_t i = 0; i < t.size(); ++i) {
+                quotes.push_back({t[i], s[i], m});
+            }
+            py::gil_scoped_release release;
+            return bootstrap(curve.curve, quotes, recovery);
+        },
+        py::arg("curve"),
+        py::arg("maturity"),
+        py::arg("spread"),
+        py::arg("recovery") = 0.4,
+        py::arg("m") = 4,
+        R"doc(
+        bootstrap(
+            curve: Curve,
+            maturity: ndarray,
+            spread: ndarray,
+            recovery: float = 0.4,
+            m: int = 4
+        ) -> HazardCurve
+
+        Hazard curve with one pillar per par CDS quote, each solved so its
+        CDS prices at zero given the pillars before it.
+
+        Parameters
+        ----------
+        curve :
+            The risk free curve, a pyfi.curve.Curve.
+        maturity, spread :
+            Increasing CDS maturities and their par spreads.
+        recovery :
+            Recovery rate on default.
+        m :
+            Premium payments per year.
+
+        Raises
+        ------
+        ValueError
+            If the maturities are not increasing, the recovery is outside
+            [0, 1) or the spreads imply a negative hazard.
+        )doc");
+
+    m.def(
+        "price_cds",
+        [](const bootstrap_result& curve,
+            const hazard_curve& hazard,
+            const double maturity,
+            const double spread,
+            const double recovery,
+            const int m) {
+            const auto out = price_cds(curve.curve, hazard, {maturity, spread, m}, recovery);
+            py::dict result;
+            result["premium_leg"] = out.premium_leg;
+            result["protection_leg"] = out.protection_leg;
+            result["risky_annuity"] = out.risky_annuity;
+            result["pv"] = out.pv;
+            result["par_spread"] = out.par_spread;
+            return result;
+        },
+        py::arg("curve"),
+        py::arg("hazard"),
+        py::arg("maturity"),
+        py::arg("spread"),
+        py::arg("recovery") = 0.4,
+        py::arg("m") = 4,
+        R"doc(
+        price_cds(
+            curve: Curve,
+            hazard: HazardCurve,
+            maturity: float,
+            spread: float,
+            recovery: float = 0.4,
+            m: int = 4
+        ) -> dict[str, float]
+
+        Premium and protection legs of a CDS per unit of notional, with the
+        premium accrued on default. pv is to the protection buyer.
+        )doc");
+
+    m.def(
+        "risky_bond_price",
+        [](const bootstrap_result& curve,
+            const hazard_curve& hazard,
+            const double par_value,
+            const double coupon_rate,
+            const double years_to_maturity,
+            const int m,
+            const double recovery) {
+            return risky_bond_price(curve.curve, hazard, par_value, coupon_rate, years_to_maturity, m, recovery);
+        },
+        py::arg("curve"),
+        py::arg("hazard"),
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("years_to_maturity"),
+        py::arg("m") = 2,
+        py::arg("recovery") = 0.4,
+        R"doc(
+        risky_bond_price(
+            curve: Curve,
+            hazard: HazardCurve,
+            par_value: float,
+            coupon_rate: float,
+            years_to_maturity: float,
+            m: int = 2,
+            recovery: float = 0.4
+        ) -> float
+
+        Dirty price of a defaultable coupon bond: the cash flows weighted by
+        survival to their dates plus recovery * par_value paid at default.
+        )doc");
+
+    m.def(
+        "risky_dirty_price_batch",
+        [](const double_array& par_value,
+            const double_array& coupon_rate,
+            const double_array& annual_yield,
+            const double_array& years_to_maturity,
+            const int_array& m,
+            const double_array& hazard_rate,
+            const double_array& recovery,
+            const std::size_t prefetch_distance,
+            const bool streaming_stores,
+            const std::size_t lanes) {
+            const bond_batch batch{as_span(par_value),
+                as_span(coupon_rate),
+                as_span(annual_yield),
+                as_span(years_to_maturity),
+                as_span(m)};
+
+            double_array out(static_cast<py::ssize_t>(batch.size()));
+            auto out_span = as_mutable_span(out);
+            {
+                py::gil_scoped_release release;
+                risky_dirty_price_batch(batch,
+                    as_span(hazard_rate),
+                    as_span(recovery),
+                    out_span,
+                    {prefetch_distance, streaming_stores, lanes});
+            }
+            return out;
+        },
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("annual_yield"),
+        py::arg("years_to_maturity"),
+        py::arg("m"),
+        py::arg("hazard_rate"),
+        py::arg("recovery"),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        risky_dirty_price_batch(
+            par_value: ndarray,
+            coupon_rate: ndarray,
+            annual_yield: ndarray,
+            years_to_maturity: ndarray,
+            m: ndarray,
+            hazard_rate: ndarray,
+            recovery: ndarray,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> ndarray
+
+        Dirty prices of a book of defaultable bonds, each with a flat hazard
+        rate and annual_yield its risk free yield. The surviving cash flows
+        go through the same kernel as bond.dirty_coupon_price_from_T_batch
+        at a hazard adjusted yield, and the recovery of par is added in
+        closed form. prefetch_distance, streaming_stores and lanes are as for
+        that function.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a bond has m <= 0, a hazard is negative, a
+            recovery is outside [0, 1) or lanes is not 1, 4, 8 or 16.
+        )doc");
+}
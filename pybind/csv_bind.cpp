@@ -0,0 +1,98 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "csv_bind.h"
+#include <map>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "../include/pyfi/csv.h"
+
+namespace py = pybind11;
+
+void add_csv_module(py::module_& m) {
+    using namespace pyfi::csv;
+
+    m.def(
+        "read_csv",
+        [](const std::string& path,
+            const std::vector<std::string>& real_columns,
+            const std::vector<std::string>& integer_columns,
+            const std::map<std::string, double>& optional_columns,
+            const char delimiter) {
+            std::vector<column_spec> columns;
+            for (const auto& name : real_columns) {
+                columns.push_back({name, column_type::real});
+            }
+            for (const auto& name : integer_columns) {
+                columns.push_back({name, column_type::integer});
+            }
+            for (const auto& [name, fill] : optional_columns) {
+                columns.push_back({name, column_type::real, false, fill});
+            }
+
+            std::vector<std::vector<double>> reals;
+            std::vector<std::vector<int>> integers;
+            {
+                py::gil_scoped_release release;
+                read_file(path, columns, reals, integers, delimiter);
+            }
+
+            py::dict result;
+            std::size_t r = 0;
+            std::size_t i = 0;
+            for (const auto& column : columns) {
+                if (column.type == column_type::real) {
+                    const auto& values = reals[r++];
+                    result[py::str(column.name)] = py::array_t<double>(values.size(), values.data());
+                } else {
+                    const auto& values = integers[i++];
+                    result[py::str(column.name)] = py::array_t<int>(values.size(), values.data());
+                }
+            }
+            return result;
+        },
+        py::arg("path"),
+        py::arg("real_columns"),
+        py::arg("integer_columns") = std::vector<std::string>{},
+        py::arg("optional_columns") = std::map<std::string, double>{},
+        py::arg("delimiter") = ',',
+        R"doc(
+        read_csv(path: str, real_columns: list[str], integer_columns: list[str] = [], optional_columns: dict[str, float] = {}, delimiter: str = ',') -> dict[str, numpy.ndarray]
+
+        Reads the named columns of a headed, unquoted CSV file of numbers.
+
+        Only the requested columns are parsed; the others are skipped. Field
+        boundaries are found with SIMD compares and numbers are converted with
+        std::from_chars, so this is much faster than a general CSV reader for
+        market data dumps. The result can be passed straight to the batch pricers.
+
+        Parameters
+        ----------
+        path : str
+            File to read.
+        real_columns : list of str
+            Columns returned as float64 arrays. Each must be in the header.
+        integer_columns : list of str, optional
+            Columns returned as int32 arrays, e.g. the compounding frequency m.
+        optional_columns : dict of str to float, optional
+            float64 columns that may be missing from the header, mapped to the
+            value used when they are.
+        delimiter : str, optional
+            Field separator.
+
+        Returns
+        -------
+        dict of str to numpy.ndarray
+            One array per requested column, keyed by name.
+
+        Raises
+        ------
+        ValueError
+            If a name is requested twice.
+        RuntimeError
+            If the file cannot be read, a required column is missing from the
+            header, a row is short, a field is not a number or a field is quoted.
+        )doc");
+}
@@ -0,0 +1,14 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef CSV_BIND_H
+#define CSV_BIND_H
+
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void add_csv_module(py::module_& m);
+
+#endif // CSV_BIND_H
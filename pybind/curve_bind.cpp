@@ -0,0 +1,174 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "curve_bind.h"
+#include <algorithm>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../include/pyfi/curve.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_curve_module(py::module_& m) {
+    using namespace pyfi::curve;
+
+    // CSR parts in the (data, indices, indptr) order scipy.sparse.csr_matrix takes
+    const auto csr = [](const sparse_matrix& matrix) {
+        return py::make_tuple(py::array_t<double>(static_cast<py::ssize_t>(matrix.value.size()), matrix.value.data()),
+            py::array_t<std::uint32_t>(static_cast<py::ssize_t>(matrix.column.size()), matrix.column.data()),
+            py::array_t<std::size_t>(static_cast<py::ssize_t>(matrix.row_start.size()), matrix.row_start.data()));
+    };
+
+    // prices and zero risk of the bond columns, without the GIL
+    const auto zero_risk = [](const bootstrap_result& self,
+                               const double_array& par_value,
+                               const double_array& coupon_rate,
+                               const double_array& years_to_maturity,
+                               const int_array& m) {
+        double_array price(static_cast<py::ssize_t>(as_span(par_value).size()));
+        sparse_matrix risk;
+        {
+            py::gil_scoped_release release;
+            risk = zero_sensitivities(self.curve,
+                as_span(par_value),
+                as_span(coupon_rate),
+                as_span(years_to_maturity),
+                as_span(m),
+                as_mutable_span(price));
+        }
+        return std::pair{price, std::move(risk)};
+    };
+
+    py::class_<bootstrap_result>(m,
+        "Curve",
+        R"doc(
+        Curve(maturity: ndarray, par_rate: ndarray, m: ndarray) -> Curve
+
+        Zero curve bootstrapped from par instruments, one pillar per
+        instrument, together with the Jacobian d zero / d par computed during
+        the bootstrap. Zero rates are continuously compounded, with flat
+        forwards between pillars.
+
+        Parameters
+        ----------
+        maturity :
+            Increasing maturities of the par bonds or swaps.
+        par_rate :
+            Their par coupons.
+        m :
+            Their coupon payments per year.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, the maturities are not increasing or a
+            pillar cannot be solved for.
+        )doc")
+        .def(py::init([](const double_array& maturity, const double_array& par_rate, const int_array& m) {
+            const auto t = as_span(maturity);
+            const auto rate = as_span(par_rate);
+            const auto frequency = as_span(m);
+            if (rate.size() != t.size() || frequency.size() != t.size()) {
+                throw std::invalid_argument("instrument columns must have the same length");
+            }
+            std::vector<par_instrument> instruments;
+            for (std::size_t i = 0; i < t.size(); ++i) {
+                instruments.push_back({t[i], rate[i], frequency[i]});
+            }
+            return bootstrap(instruments);
+        }),
+            py::arg("maturity"),
+            py::arg("par_rate"),
+            py::arg("m"))
+        .def_property_readonly("times",
+            [](const bootstrap_result& self) {
+                const auto& times = self.curve.times();
+                return py::array_t<double>(static_cast<py::ssize_t>(times.size()), times.data());
+            })
+        .def_property_readonly("zero_rates",
+            [](const bootstrap_result& self) {
+                const auto& rates = self.curve.zero_rates();
+                return py::array_t<double>(static_cast<py::ssize_t>(rates.size()), rates.data());
+            })
+        .def_property_readonly(
+            "jacobian",
+            [](const bootstrap_result& self) {
+                const auto n = static_cast<py::ssize_t>(self.curve.times().size());
+                py::array_t<double> out({n, n});
+                std::copy(self.jacobian.begin(), self.jacobian.end(), out.mutable_data());
+                return out;
+            },
+            "d zero_rate[i] / d par_rate[k], lower triangular.")
+        .def(
+            "discount",
+            [](const bootstrap_result& self, const double time) { return self.curve.discount(time); },
+            py::arg("time"))
+        .def(
+            "zero_rate",
+            [](const bootstrap_result& self, const double time) { return self.curve.zero_rate(time); },
+            py::arg("time"))
+        .def(
+            "zero_sensitivities",
+            [zero_risk, csr](const bootstrap_result& self,
+                const double_array& par_value,
+                const double_array& coupon_rate,
+                const double_array& years_to_maturity,
+                const int_array& m) {
+                const auto [price, risk] = zero_risk(self, par_value, coupon_rate, years_to_maturity, m);
+                return py::make_tuple(price, csr(risk));
+            },
+            py::arg("par_value"),
+            py::arg("coupon_rate"),
+            py::arg("years_to_maturity"),
+            py::arg("m"),
+            R"doc(
+            zero_sensitivities(
+                par_value: ndarray,
+                coupon_rate: ndarray,
+                years_to_maturity: ndarray,
+                m: ndarray
+            ) -> tuple[ndarray, tuple[ndarray, ndarray, ndarray]]
+
+            Dirty prices of coupon bonds off the curve and their sensitivities
+            to each zero pillar per 1.0 of rate, as (data, indices, indptr) of
+            a bonds x pillars CSR matrix for scipy.sparse.csr_matrix.
+            )doc")
+        .def(
+            "par_sensitivities",
+            [zero_risk, csr](const bootstrap_result& self,
+                const double_array& par_value,
+                const double_array& coupon_rate,
+                const double_array& years_to_maturity,
+                const int_array& m) {
+                auto [price, risk] = zero_risk(self, par_value, coupon_rate, years_to_maturity, m);
+                sparse_matrix par;
+                {
+                    py::gil_scoped_release release;
+                    par = par_sensitivities(risk, self);
+                }
+                return py::make_tuple(price, csr(par));
+            },
+            py::arg("par_value"),
+            py::arg("coupon_rate"),
+            py::arg("years_to_maturity"),
+            py::arg("m"),
+            R"doc(
+            par_sensitivities(
+                par_value: ndarray,
+                coupon_rate: ndarray,
+                years_to_maturity: ndarray,
+                m: ndarray
+            ) -> tuple[ndarray, tuple[ndarray, ndarray, ndarray]]
+
+            Dirty prices of coupon bonds off the curve and their sensitivities
+            to each par instrument's rate per 1.0 of rate: the zero risk times
+            the bootstrap Jacobian in one sparse product, as (data, indices,
+            indptr) of a bonds x instruments CSR matrix.
+            )doc");
+}
@@ -0,0 +1,155 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "exposure_bind.h"
+#include <optional>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <tuple>
+#include <vector>
+#include "../include/pyfi/exposure.h"
+
+namespace py = pybind11;
+
+void add_exposure_module(py::module_& m) {
+    using namespace pyfi::exposure;
+    using pyfi::option::option_type;
+    using pyfi::proxy::chebyshev_proxy;
+    using option_row = std::tuple<double, double, option_type, double>;
+    using bond_row = std::tuple<double, double, double, int, double>;
+    using proxy_row = std::tuple<const chebyshev_proxy*, double, double>;
+
+    m.def(
+        "simulate",
+        [](const double spot,
+            const double volatility,
+            const double short_rate,
+            const std::vector<double>& dates,
+            const std::vector<option_row>& options,
+            const std::vector<bond_row>& bonds,
+            const std::vector<proxy_row>& proxies,
+            const double yield_curve,
+            const double mean_reversion,
+            const std::optional<double> long_rate,
+            const double rate_volatility,
+            const double correlation,
+            const std::vector<double>& quantiles,
+            const std::size_t paths,
+            const std::uint64_t seed,
+            const double relative_accuracy) {
+            const market_model model{spot,
+                volatility,
+                yield_curve,
+                short_rate,
+                mean_reversion,
+                long_rate.value_or(short_rate),
+                rate_volatility,
+                correlation};
+            portfolio netting_set;
+            for (const auto& [strike_price, maturity, type, quantity] : options) {
+                netting_set.options.push_back({strike_price, maturity, type, quantity});
+            }
+            for (const auto& [par_value, coupon_rate, maturity, compounding, quantity] : bonds) {
+                netting_set.bonds.push_back({par_value, coupon_rate, maturity, compounding, quantity});
+            }
+            for (const auto& [proxy, maturity, quantity] : proxies) {
+                netting_set.proxies.push_back({proxy, maturity, quantity});
+            }
+            exposure_config config{dates, quantiles, paths, seed, relative_accuracy};
+
+            exposure_profile profile;
+            {
+                py::gil_scoped_release release;
+                profile = simulate(model, netting_set, config);
+            }
+
+            const auto n = static_cast<py::ssize_t>(profile.dates.size());
+            py::dict pfe;
+            for (std::size_t i = 0; i < quantiles.size(); ++i) {
+                pfe[py::float_(quantiles[i])] = py::array_t<double>(n, profile.potential_future_exposure[i].data());
+            }
+            py::dict result;
+            result["dates"] = py::array_t<double>(n, profile.dates.data());
+            result["expected_exposure"] = py::array_t<double>(n, profile.expected_exposure.data());
+            result["potential_future_exposure"] = pfe;
+            result["expected_positive_exposure"] = profile.expected_positive_exposure;
+            result["peak_exposure"] = profile.peak_exposure;
+            return result;
+        },
+        py::arg("spot"),
+        py::arg("volatility"),
+        py::arg("short_rate"),
+        py::arg("dates"),
+        py::arg("options") = std::vector<option_row>{},
+        py::arg("bonds") = std::vector<bond_row>{},
+        py::arg("proxies") = std::vector<proxy_row>{},
+        py::arg("yield_curve") = 0.0,
+        py::arg("mean_reversion") = 0.1,
+        py::arg("long_rate") = py::none(),
+        py::arg("rate_volatility") = 0.01,
+        py::arg("correlation") = 0.0,
+        py::arg("quantiles") = std::vector<double>{0.95},
+        py::arg("paths") = 10'000,
+        py::arg("seed") = 42,
+        py::arg("relative_accuracy") = 0.005,
+        R"doc(
+        simulate(
+            spot: float,
+            volatility: float,
+            short_rate: float,
+            dates: list[float],
+            options: list[tuple[float, float, OptionType, float]] = [],
+            bonds: list[tuple[float, float, float, int, float]] = [],
+            proxies: list[tuple[ChebyshevProxy, float, float]] = [],
+            yield_curve: float = 0.0,
+            mean_reversion: float = 0.1,
+            long_rate: float | None = None,
+            rate_volatility: float = 0.01,
+            correlation: float = 0.0,
+            quantiles: list[float] = [0.95],
+            paths: int = 10000,
+            seed: int = 42,
+            relative_accuracy: float = 0.005
+        ) -> dict
+
+        Expected exposure and potential future exposure profile of one
+        netting set. The spot follows GBM and the short rate a Vasicek
+        process; every path is repriced at every date with the batch closed
+        forms or the given proxies. EE and the PFE quantiles are aggregated
+        block by block, so the paths x dates exposure cube is never stored.
+        Runs in parallel without the GIL.
+
+        Parameters
+        ----------
+        dates :
+            Exposure dates in years, increasing and positive.
+        options :
+            (strike_price, maturity, type, quantity) European options on the
+            spot; quantity is negative for sold options.
+        bonds :
+            (par_value, coupon_rate, maturity, m, quantity) coupon bonds.
+        proxies :
+            (proxy, maturity, quantity) contracts priced by a ChebyshevProxy,
+            with spots outside its box clamped to the box.
+        long_rate :
+            Vasicek mean reversion level, the short rate if None.
+        relative_accuracy :
+            Of the PFE quantile sketches.
+
+        Returns
+        -------
+        dict
+            dates, expected_exposure, potential_future_exposure (an array per
+            quantile), expected_positive_exposure (time averaged EE) and
+            peak_exposure (the maximum PFE per quantile).
+
+        Raises
+        ------
+        ValueError
+            If the dates are not increasing and positive, a quantile is
+            outside [0, 1], paths is 0, spot or volatility is not positive or
+            the correlation is outside [-1, 1].
+        )doc");
+}
@@ -0,0 +1,203 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "futures_bind.h"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <tuple>
+#include <vector>
+#include "../include/pyfi/futures.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_futures_module(py::module_& m) {
+    using namespace pyfi::futures;
+    using pyfi::bond::bond_batch;
+    using contract_row = std::tuple<double, double, double, std::size_t, std::size_t>;
+
+    const auto contract_list = [](const std::vector<contract_row>& rows,
+                                   const double notional_coupon,
+                                   const double maturity_rounding) {
+        std::vector<contract> contracts;
+        for (const auto& [price, delivery, repo_rate, first, count] : rows) {
+            contracts.push_back({price, delivery, repo_rate, first, count, notional_coupon, maturity_rounding});
+        }
+        return contracts;
+    };
+
+    m.def("conversion_factor",
+        &conversion_factor,
+        py::arg("coupon_rate"),
+        py::arg("years_to_maturity"),
+        py::arg("m") = 2,
+        py::arg("notional_coupon") = 0.06,
+        py::arg("maturity_rounding") = 0.25,
+        R"doc(
+        conversion_factor(
+            coupon_rate: float,
+            years_to_maturity: float,
+            m: int = 2,
+            notional_coupon: float = 0.06,
+            maturity_rounding: float = 0.25
+        ) -> float
+
+        Exchange conversion factor of a deliverable bond: its clean price per
+        1 of par at the notional yield, with the maturity from the delivery
+        date rounded down to whole maturity_rounding periods (0.25 for bond
+        and 10 year note contracts, 1 / 12 for 2 and 5 year notes) and the
+        result rounded to four decimals.
+
+        Raises
+        ------
+        ValueError
+            If m <= 0 or the rounded maturity is not positive.
+        )doc");
+
+    m.def(
+        "basis",
+        [contract_list](const double_array& par_value,
+            const double_array& coupon_rate,
+            const double_array& annual_yield,
+            const double_array& years_to_maturity,
+            const int_array& m,
+            const std::vector<contract_row>& contracts,
+            const double notional_coupon,
+            const double maturity_rounding) {
+            const bond_batch deliverables{
+                as_span(par_value), as_span(coupon_rate), as_span(annual_yield), as_span(years_to_maturity), as_span(m)};
+            const auto list = contract_list(contracts, notional_coupon, maturity_rounding);
+            basis_analytics out;
+            {
+                py::gil_scoped_release release;
+                out = basis(deliverables, list);
+            }
+
+            const auto rows = static_cast<py::ssize_t>(out.deliverable.size());
+            py::dict result;
+            result["row_start"] = py::array_t<std::size_t>(static_cast<py::ssize_t>(out.row_start.size()),
+                out.row_start.data());
+            result["deliverable"] = py::array_t<std::size_t>(rows, out.deliverable.data());
+            result["conversion_factor"] = py::array_t<double>(rows, out.conversion_factor.data());
+            result["clean_price"] = py::array_t<double>(rows, out.clean_price.data());
+            result["dirty_price"] = py::array_t<double>(rows, out.dirty_price.data());
+            result["invoice_price"] = py::array_t<double>(rows, out.invoice_price.data());
+            result["gross_basis"] = py::array_t<double>(rows, out.gross_basis.data());
+            result["carry"] = py::array_t<double>(rows, out.carry.data());
+            result["net_basis"] = py::array_t<double>(rows, out.net_basis.data());
+            result["implied_repo"] = py::array_t<double>(rows, out.implied_repo.data());
+            result["cheapest"] = py::array_t<std::size_t>(static_cast<py::ssize_t>(out.cheapest.size()),
+                out.cheapest.data());
+            return result;
+        },
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("annual_yield"),
+        py::arg("years_to_maturity"),
+        py::arg("m"),
+        py::arg("contracts"),
+        py::arg("notional_coupon") = 0.06,
+        py::arg("maturity_rounding") = 0.25,
+        R"doc(
+        basis(
+            par_value: ndarray,
+            coupon_rate: ndarray,
+            annual_yield: ndarray,
+            years_to_maturity: ndarray,
+            m: ndarray,
+            contracts: list[tuple[float, float, float, int, int]],
+            notional_coupon: float = 0.06,
+            maturity_rounding: float = 0.25
+        ) -> dict[str, ndarray]
+
+        Conversion factors, gross and net basis, carry and implied repo of
+        every futures contract's deliverable basket in one call.
+
+        Parameters
+        ----------
+        par_value, coupon_rate, annual_yield, years_to_maturity, m :
+            The deliverable bonds, years_to_maturity from today's settlement.
+        contracts :
+            (futures price, years to delivery, term repo rate, first, count)
+            per contract; its basket is bonds [first, first + count). The
+            futures price is quoted per par_value of the bonds.
+
+        Returns
+        -------
+        dict
+            One row per (contract, deliverable) pair, contract by contract:
+            the rows of contract k are row_start[k] to row_start[k + 1].
+            cheapest holds the deliverable with the highest implied repo of
+            each contract.
+
+        Raises
+        ------
+        ValueError
+            If a basket is empty or out of range, a delivery time is not
+            positive, a bond has m <= 0 or matures too close to delivery.
+        )doc");
+
+    m.def(
+        "ctd_switch",
+        [contract_list](const double_array& par_value,
+            const double_array& coupon_rate,
+            const double_array& annual_yield,
+            const double_array& years_to_maturity,
+            const int_array& m,
+            const std::vector<contract_row>& contracts,
+            const double_array& yield_shifts,
+            const double notional_coupon,
+            const double maturity_rounding) {
+            const bond_batch deliverables{
+                as_span(par_value), as_span(coupon_rate), as_span(annual_yield), as_span(years_to_maturity), as_span(m)};
+            const auto list = contract_list(contracts, notional_coupon, maturity_rounding);
+            ctd_switch out;
+            {
+                py::gil_scoped_release release;
+                out = ctd_switch_analysis(deliverables, list, as_span(yield_shifts));
+            }
+
+            const auto shape = std::vector<py::ssize_t>{
+                static_cast<py::ssize_t>(list.size()), static_cast<py::ssize_t>(out.shifts.size())};
+            py::dict result;
+            result["shifts"] = py::array_t<double>(static_cast<py::ssize_t>(out.shifts.size()), out.shifts.data());
+            result["cheapest"] = py::array_t<std::size_t>(shape, out.cheapest.data());
+            result["futures_price"] = py::array_t<double>(shape, out.futures_price.data());
+            return result;
+        },
+        py::arg("par_value"),
+        py::arg("coupon_rate"),
+        py::arg("annual_yield"),
+        py::arg("years_to_maturity"),
+        py::arg("m"),
+        py::arg("contracts"),
+        py::arg("yield_shifts"),
+        py::arg("notional_coupon") = 0.06,
+        py::arg("maturity_rounding") = 0.25,
+        R"doc(
+        ctd_switch(
+            par_value: ndarray,
+            coupon_rate: ndarray,
+            annual_yield: ndarray,
+            years_to_maturity: ndarray,
+            m: ndarray,
+            contracts: list[tuple[float, float, float, int, int]],
+            yield_shifts: ndarray,
+            notional_coupon: float = 0.06,
+            maturity_rounding: float = 0.25
+        ) -> dict[str, ndarray]
+
+        Cheapest to deliver of every contract under parallel shifts of all
+        deliverable yields, see basis for the parameters. For each shift the
+        theoretical futures price is the lowest forward clean price at
+        delivery over conversion factor in the basket.
+
+        Returns
+        -------
+        dict
+            cheapest (deliverable index) and futures_price, both contracts x
+            shifts.
+        )doc");
+}
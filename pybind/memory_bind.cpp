@@ -0,0 +1,78 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "memory_bind.h"
+#include <memory>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include "../include/pyfi/memory.h"
+
+namespace py = pybind11;
+
+void add_memory_module(py::module_& m) {
+    using namespace pyfi::memory;
+
+    py::enum_<numa_policy>(m, "NumaPolicy")
+        .value("local", numa_policy::local)
+        .value("bind", numa_policy::bind)
+        .value("interleave", numa_policy::interleave);
+
+    m.def(
+        "empty",
+        [](const std::size_t size,
+            const bool huge_pages,
+            const numa_policy numa,
+            const int node,
+            const bool first_touch) {
+            auto owned = std::make_unique<buffer<double>>();
+            {
+                py::gil_scoped_release release;
+                *owned = buffer<double>(size, {huge_pages, numa, node, first_touch});
+            }
+            double* data = owned->data();
+            // the capsule owns the mapping and unmaps it when the last array viewing it is gone
+            const py::capsule owner(owned.release(), [](void* p) {
+                delete static_cast<buffer<double>*>(p);
+            });
+            return py::array_t<double>({static_cast<py::ssize_t>(size)}, {sizeof(double)}, data, owner);
+        },
+        py::arg("size"),
+        py::arg("huge_pages") = true,
+        py::arg("numa") = numa_policy::local,
+        py::arg("node") = 0,
+        py::arg("first_touch") = true,
+        R"doc(
+        empty(
+            size: int,
+            huge_pages: bool = True,
+            numa: NumaPolicy = NumaPolicy.local,
+            node: int = 0,
+            first_touch: bool = True
+        ) -> ndarray
+
+        Zero filled float64 array in its own mapping, for the columns and
+        result buffers of books of millions of contracts. With huge_pages the
+        mapping is aligned to and advised for 2 MiB transparent huge pages,
+        which cuts the TLB misses of a pass over the book; without it the
+        mapping opts out of huge pages. numa binds the pages
+        to one node or interleaves them over all nodes; with first_touch the
+        pages are faulted in up front by the pricing thread pool.
+
+        Parameters
+        ----------
+        size :
+            Number of elements.
+        node :
+            Node for NumaPolicy.bind.
+
+        Raises
+        ------
+        ValueError
+            If node is out of range.
+        RuntimeError
+            If the memory cannot be mapped or bound to the node.
+        )doc");
+
+    m.def("huge_page_size", &huge_page_size, "Transparent huge page size in bytes.");
+}
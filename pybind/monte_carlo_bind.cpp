@@ -0,0 +1,288 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "monte_carlo_bind.h"
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "../include/pyfi/monte_carlo.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_monte_carlo_module(py::module_& m) {
+    using namespace pyfi::monte_carlo;
+    using pyfi::option::option_batch;
+    using pyfi::option::option_type;
+
+    py::enum_<payoff_style>(m, "PayoffStyle")
+        .value("european", payoff_style::european)
+        .value("asian", payoff_style::asian);
+
+    py::enum_<greek_estimator>(m, "GreekEstimator")
+        .value("pathwise", greek_estimator::pathwise)
+        .value("likelihood_ratio", greek_estimator::likelihood_ratio);
+
+    m.def(
+        "price",
+        [](const double stock_price,
+            const double strike_price,
+            const double volatility,
+            const double risk_free_rate,
+            const double time,
+            const double yield_curve,
+            const option_type type,
+            const payoff_style style,
+            const std::size_t paths,
+            const std::size_t steps,
+            const std::uint64_t seed,
+            const bool antithetic) {
+            const auto result = price(stock_price,
+                strike_price,
+                volatility,
+                risk_free_rate,
+                time,
+                yield_curve,
+                type,
+                style,
+                {paths, steps, seed, antithetic});
+            return py::make_tuple(result.price, result.standard_error);
+        },
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = 0.0,
+        py::arg("type") = option_type::call,
+        py::arg("style") = payoff_style::european,
+        py::arg("paths") = 100'000,
+        py::arg("steps") = 1,
+        py::arg("seed") = 42,
+        py::arg("antithetic") = true,
+        R"doc(
+        price(
+            stock_price: float,
+            strike_price: float,
+            volatility: float,
+            risk_free_rate: float,
+            time: float,
+            yield_curve: float = 0.0,
+            type: OptionType = OptionType.call,
+            style: PayoffStyle = PayoffStyle.european,
+            paths: int = 100000,
+            steps: int = 1,
+            seed: int = 42,
+            antithetic: bool = True
+        ) -> tuple[float, float]
+
+        Monte Carlo price of one option under geometric Brownian motion.
+
+        Parameters
+        ----------
+        style :
+            european pays on the terminal spot, asian on the arithmetic average
+            of the spot over steps equally spaced monitoring dates.
+        paths :
+            Number of paths, an antithetic pair counts as two.
+
+        Returns
+        -------
+        tuple
+            The price and its standard error.
+
+        Raises
+        ------
+        ValueError
+            If time or volatility is zero, or paths or steps is zero.
+        )doc");
+
+    m.def(
+        "price_batch",
+        [](const double_array& stock_price,
+            const double_array& strike_price,
+            const double_array& volatility,
+            const double_array& risk_free_rate,
+            const double_array& time,
+            const std::optional<double_array>& yield_curve,
+            const option_type type,
+            const payoff_style style,
+            const std::size_t paths,
+            const std::size_t steps,
+            const std::uint64_t seed,
+            const bool antithetic) {
+            const auto n = static_cast<py::ssize_t>(as_span(stock_price).size());
+            double_array q = yield_curve ? *yield_curve : double_array(n);
+            if (!yield_curve) {
+                std::fill_n(q.mutable_data(), n, 0.0);
+            }
+            const option_batch batch{as_span(stock_price),
+                as_span(strike_price),
+                as_span(volatility),
+                as_span(risk_free_rate),
+                as_span(time),
+                as_span(q)};
+
+            double_array out(n);
+            double_array standard_error(n);
+            auto out_span = as_mutable_span(out);
+            auto error_span = as_mutable_span(standard_error);
+            {
+                py::gil_scoped_release release;
+                price_batch(batch, type, style, {paths, steps, seed, antithetic}, out_span, error_span);
+            }
+            return py::make_tuple(out, standard_error);
+        },
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("type") = option_type::call,
+        py::arg("style") = payoff_style::european,
+        py::arg("paths") = 100'000,
+        py::arg("steps") = 1,
+        py::arg("seed") = 42,
+        py::arg("antithetic") = true,
+        R"doc(
+        price_batch(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            type: OptionType = OptionType.call,
+            style: PayoffStyle = PayoffStyle.european,
+            paths: int = 100000,
+            steps: int = 1,
+            seed: int = 42,
+            antithetic: bool = True
+        ) -> tuple[ndarray, ndarray]
+
+        Monte Carlo prices for a whole book on common random numbers: every
+        contract is priced on the same paths, so differences between rows
+        carry little simulation noise and the draws are generated once.
+
+        Returns
+        -------
+        tuple
+            The prices and their standard errors.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility, or
+            paths or steps is zero.
+        )doc");
+
+    m.def(
+        "greeks_batch",
+        [](const double_array& stock_price,
+            const double_array& strike_price,
+            const double_array& volatility,
+            const double_array& risk_free_rate,
+            const double_array& time,
+            const std::optional<double_array>& yield_curve,
+            const option_type type,
+            const payoff_style style,
+            const greek_estimator estimator,
+            const std::size_t paths,
+            const std::size_t steps,
+            const std::uint64_t seed,
+            const bool antithetic) {
+            const auto n = static_cast<py::ssize_t>(as_span(stock_price).size());
+            double_array q = yield_curve ? *yield_curve : double_array(n);
+            if (!yield_curve) {
+                std::fill_n(q.mutable_data(), n, 0.0);
+            }
+            const option_batch batch{as_span(stock_price),
+                as_span(strike_price),
+                as_span(volatility),
+                as_span(risk_free_rate),
+                as_span(time),
+                as_span(q)};
+
+            std::vector<mc_greeks> out(n);
+            {
+                py::gil_scoped_release release;
+                greeks_batch(batch, type, style, {paths, steps, seed, antithetic}, estimator, out);
+            }
+
+            py::dict result;
+            for (const auto& [name, member] : {std::pair{"price", &mc_greeks::price},
+                     std::pair{"delta", &mc_greeks::delta},
+                     std::pair{"gamma", &mc_greeks::gamma},
+                     std::pair{"vega", &mc_greeks::vega}}) {
+                double_array value(n);
+                double_array standard_error(n);
+                for (py::ssize_t i = 0; i < n; ++i) {
+                    value.mutable_data()[i] = (out[i].*member).value;
+                    standard_error.mutable_data()[i] = (out[i].*member).standard_error;
+                }
+                result[name] = value;
+                result[py::str(std::string(name) + "_error")] = standard_error;
+            }
+            return result;
+        },
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("type") = option_type::call,
+        py::arg("style") = payoff_style::european,
+        py::arg("estimator") = greek_estimator::pathwise,
+        py::arg("paths") = 100'000,
+        py::arg("steps") = 1,
+        py::arg("seed") = 42,
+        py::arg("antithetic") = true,
+        R"doc(
+        greeks_batch(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            type: OptionType = OptionType.call,
+            style: PayoffStyle = PayoffStyle.european,
+            estimator: GreekEstimator = GreekEstimator.pathwise,
+            paths: int = 100000,
+            steps: int = 1,
+            seed: int = 42,
+            antithetic: bool = True
+        ) -> dict[str, ndarray]
+
+        Monte Carlo price, delta, gamma and vega for a whole book, estimated
+        in the same pass over the same paths as price_batch.
+
+        Parameters
+        ----------
+        estimator :
+            pathwise differentiates the payoff along each path (lowest
+            variance, gamma by likelihood ratio on the pathwise delta);
+            likelihood_ratio weights the payoff by the score of the path
+            density and suits discontinuous payoffs.
+
+        Returns
+        -------
+        dict
+            price, delta, gamma and vega arrays, and their standard errors
+            under price_error, delta_error, gamma_error and vega_error. Vega is
+            per 1.0 of volatility.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility, or
+            paths or steps is zero.
+        )doc");
+}
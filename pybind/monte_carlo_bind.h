@@ -0,0 +1,14 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef MONTE_CARLO_BIND_H
+#define MONTE_CARLO_BIND_H
+
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void add_monte_carlo_module(py::module_& m);
+
+#endif // MONTE_CARLO_BIND_H
@@ -7,15 +7,21 @@
 #include <pybind11/functional.h>
 
 #include "../include/pyfi/option.h"
+#include "array_bind.h"
 #include "option_bind.h"
 
+#include <algorithm>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace py = pybind11;
 
 void add_option_module(py::module_& m) {
     using namespace pyfi::option;
+    using pyfi::memory::access_hints;
 
     m.def("black_scholes_x",
         &black_scholes_x,
@@ -196,6 +202,80 @@ void add_option_module(py::module_& m) {
         )doc");
 
 
+    py::enum_<option_type>(m, "OptionType")
+        .value("call", option_type::call)
+        .value("put", option_type::put);
+
+    py::class_<bs_kernel>(m,
+        "BSKernel",
+        R"doc(
+        Price and Greeks of one European option under the generalised
+        Black-Scholes model, evaluated from shared intermediates.
+
+        Construction does the transcendental work once; price() and every
+        Greek of both the call and the put are then a few multiplies. The
+        model is described by the rate r and the cost of carry b = r - q.
+        Vega and volga are per 1.0 of volatility, rho per 1.0 of rate, and
+        theta, charm and color per year of calendar time.
+        )doc")
+        .def(py::init<double, double, double, double, double, double>(),
+            py::arg("stock_price"),
+            py::arg("strike_price"),
+            py::arg("volatility"),
+            py::arg("risk_free_rate"),
+            py::arg("time"),
+            py::arg_v("dividend_yield", 0.0, "0.0"),
+            R"doc(
+            BSKernel(
+                stock_price: float,
+                strike_price: float,
+                volatility: float,
+                risk_free_rate: float,
+                time: float,
+                dividend_yield: float = 0.0
+            )
+
+            Raises
+            ------
+            ValueError
+                If time or volatility is zero.
+            )doc")
+        .def_static("with_carry",
+            &bs_kernel::with_carry,
+            py::arg("stock_price"),
+            py::arg("strike_price"),
+            py::arg("volatility"),
+            py::arg("risk_free_rate"),
+            py::arg("time"),
+            py::arg("cost_of_carry"),
+            R"doc(
+            with_carry(
+                stock_price: float,
+                strike_price: float,
+                volatility: float,
+                risk_free_rate: float,
+                time: float,
+                cost_of_carry: float
+            ) -> BSKernel
+
+            Builds the kernel from the cost of carry b directly, e.g. b = 0 for
+            Black-76 options on futures.
+            )doc")
+        .def("price", &bs_kernel::price, py::arg("type"))
+        .def("delta", &bs_kernel::delta, py::arg("type"))
+        .def("gamma", &bs_kernel::gamma)
+        .def("theta", &bs_kernel::theta, py::arg("type"))
+        .def("vega", &bs_kernel::vega)
+        .def("rho", &bs_kernel::rho, py::arg("type"), "dV/dr with the dividend yield held fixed.")
+        .def("carry_rho", &bs_kernel::carry_rho, py::arg("type"), "dV/db with the rate held fixed.")
+        .def("vanna", &bs_kernel::vanna)
+        .def("volga", &bs_kernel::volga)
+        .def("charm", &bs_kernel::charm, py::arg("type"))
+        .def("speed", &bs_kernel::speed)
+        .def("color", &bs_kernel::color)
+        .def_readonly("d1", &bs_kernel::d1)
+        .def_readonly("d2", &bs_kernel::d2);
+
     m.def("bs_call_delta",
         &bs_call_delta,
         py::arg("stock_price"),
@@ -338,35 +418,8 @@ void add_option_module(py::module_& m) {
             time: float
         ) -> float
 
-        Vega of European options (∂V/∂σ), same for calls and puts.
-        )doc");
-
-    m.def("bs_rho_calculation",
-        &bs_rho_calculation,
-        py::arg("strike_price"),
-        py::arg("risk_free_rate"),
-        py::arg("time"),
-        py::arg("x2"),
-        R"doc(
-        bs_rho_calculation(
-            strike_price: float,
-            risk_free_rate: float,
-            time: float,
-            x2: float
-        ) -> float
-
-        Internal helper for rho, shared by call and put versions.
-
-        Parameters
-        ----------
-        strike_price :
-            Strike K.
-        risk_free_rate :
-            Rate r.
-        time :
-            Time to maturity T.
-        x2 :
-            x2 (d2) or -x2 depending on call/put.
+        Vega of European options (∂V/∂σ) per 1.0 of volatility, same for calls
+        and puts.
         )doc");
 
     m.def("bs_call_rho",
@@ -375,6 +428,7 @@ void add_option_module(py::module_& m) {
         py::arg("strike_price"),
         py::arg("volatility"),
         py::arg("risk_free_rate"),
+        py::arg("dividend_yield"),
         py::arg("time"),
         R"doc(
         bs_call_rho(
@@ -382,10 +436,12 @@ void add_option_module(py::module_& m) {
             strike_price: float,
             volatility: float,
             risk_free_rate: float,
+            dividend_yield: float,
             time: float
         ) -> float
 
-        Rho of a European call option (∂C/∂r).
+        Rho of a European call option (∂C/∂r) per 1.0 of rate, with the
+        dividend yield held fixed.
         )doc");
 
     m.def("bs_put_rho",
@@ -394,6 +450,7 @@ void add_option_module(py::module_& m) {
         py::arg("strike_price"),
         py::arg("volatility"),
         py::arg("risk_free_rate"),
+        py::arg("dividend_yield"),
         py::arg("time"),
         R"doc(
         bs_put_rho(
@@ -401,10 +458,12 @@ void add_option_module(py::module_& m) {
             strike_price: float,
             volatility: float,
             risk_free_rate: float,
+            dividend_yield: float,
             time: float
         ) -> float
 
-        Rho of a European put option (∂P/∂r).
+        Rho of a European put option (∂P/∂r) per 1.0 of rate, with the
+        dividend yield held fixed.
         )doc");
 
     // Wrapper for binomial_eu_option that takes a string for payoff type
@@ -533,6 +592,111 @@ void add_option_module(py::module_& m) {
             If payoff_type is not "call" or "put".
         )doc");
 
+    const auto adaptive_binomial = [](decltype(&binomial_eu_option_adaptive) pricer) {
+        return [pricer](const double stock_price,
+                   const double strike_price,
+                   const double volatility,
+                   const double risk_free_rate,
+                   const double time,
+                   const std::string& payoff_type,
+                   const double tolerance,
+                   const int min_steps,
+                   const int max_steps) {
+            payoff_func payoff;
+            if (payoff_type == "call") {
+                payoff = call_payoff;
+            } else if (payoff_type == "put") {
+                payoff = put_payoff;
+            } else {
+                throw std::invalid_argument("payoff_type must be 'call' or 'put'");
+            }
+            const auto estimate = pricer(stock_price,
+                strike_price,
+                volatility,
+                risk_free_rate,
+                time,
+                payoff,
+                {tolerance, min_steps, max_steps});
+            return py::make_tuple(estimate.price, estimate.error, estimate.steps);
+        };
+    };
+
+    m.def("binomial_eu_option_adaptive",
+        adaptive_binomial(&binomial_eu_option_adaptive),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("payoff_type"),
+        py::arg("tolerance") = 1e-4,
+        py::arg("min_steps") = 16,
+        py::arg("max_steps") = 8192,
+        R"doc(
+        binomial_eu_option_adaptive(
+            stock_price: float,
+            strike_price: float,
+            volatility: float,
+            risk_free_rate: float,
+            time: float,
+            payoff_type: str,
+            tolerance: float = 1e-4,
+            min_steps: int = 16,
+            max_steps: int = 8192
+        ) -> tuple[float, float, int]
+
+        European option price using a binomial tree whose step count doubles
+        from min_steps until the estimated error is within tolerance, so easy
+        contracts finish in tens of steps and hard ones get more. The error
+        estimate is the difference between successive step counts.
+
+        Returns
+        -------
+        (price, error, steps) :
+            The price, its estimated absolute error and the step count used.
+            If max_steps is reached first, error is above tolerance.
+
+        Raises
+        ------
+        ValueError
+            If payoff_type is not "call" or "put", tolerance is not positive or
+            the step bounds are not 1 <= min_steps <= max_steps.
+        )doc");
+
+    m.def("binomial_us_option_adaptive",
+        adaptive_binomial(&binomial_us_option_adaptive),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("payoff_type"),
+        py::arg("tolerance") = 1e-4,
+        py::arg("min_steps") = 16,
+        py::arg("max_steps") = 8192,
+        R"doc(
+        binomial_us_option_adaptive(
+            stock_price: float,
+            strike_price: float,
+            volatility: float,
+            risk_free_rate: float,
+            time: float,
+            payoff_type: str,
+            tolerance: float = 1e-4,
+            min_steps: int = 16,
+            max_steps: int = 8192
+        ) -> tuple[float, float, int]
+
+        American option price with early exercise and the step count chosen by
+        tolerance, see binomial_eu_option_adaptive.
+
+        Raises
+        ------
+        ValueError
+            If payoff_type is not "call" or "put", tolerance is not positive or
+            the step bounds are not 1 <= min_steps <= max_steps.
+        )doc");
+
     m.def("forward_from_yield",
         &forward_from_yield,
         py::arg("spot_price"),
@@ -603,4 +767,503 @@ void add_option_module(py::module_& m) {
             If `time <= 0` or `spot_price <= 0` or `forward_price <= 0`
             in the underlying C++ code.
         )doc");
-}
\ No newline at end of file
+
+    // the batch pricers take one array per column and release the GIL while pricing
+    const auto batch_pricer = [](void (*pricer)(const option_batch&, std::span<double>, const access_hints&)) {
+        return [pricer](const double_array& stock_price,
+                   const double_array& strike_price,
+                   const double_array& volatility,
+                   const double_array& risk_free_rate,
+                   const double_array& time,
+                   const std::optional<double_array>& yield_curve,
+                   const std::size_t prefetch_distance,
+                   const bool streaming_stores,
+                   const std::size_t lanes) {
+            const auto n = static_cast<py::ssize_t>(as_span(stock_price).size());
+            double_array q = yield_curve ? *yield_curve : double_array(n);
+            if (!yield_curve) {
+                std::fill_n(q.mutable_data(), n, 0.0);
+            }
+            const option_batch batch{as_span(stock_price),
+                as_span(strike_price),
+                as_span(volatility),
+                as_span(risk_free_rate),
+                as_span(time),
+                as_span(q)};
+
+            double_array out(n);
+            auto out_span = as_mutable_span(out);
+            {
+                py::gil_scoped_release release;
+                pricer(batch, out_span, {prefetch_distance, streaming_stores, lanes});
+            }
+            return out;
+        };
+    };
+
+    m.def("black_scholes_call_batch",
+        batch_pricer(&black_scholes_call_batch),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        black_scholes_call_batch(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> ndarray
+
+        European call prices for a whole book in one call. Element i of every
+        array describes contract i; all arrays must have the same length.
+
+        Parameters
+        ----------
+        stock_price, strike_price, volatility, risk_free_rate, time :
+            One dimensional arrays, see black_scholes_call.
+        yield_curve :
+            Continuous dividend yields, zero when omitted.
+        prefetch_distance :
+            Rows ahead to prefetch the inputs, 0 for none. Helps on books
+            much larger than the caches.
+        streaming_stores :
+            Write the prices with non-temporal stores that bypass the cache.
+        lanes :
+            Rows priced together in one simd pack: 1, 4, 8 or 16. 1 runs the
+            scalar kernel; wider packs pay off on AVX2 and AVX-512 builds.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility or
+            lanes is not 1, 4, 8 or 16.
+        )doc");
+
+    m.def("black_scholes_put_batch",
+        batch_pricer(&black_scholes_put_batch),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        black_scholes_put_batch(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> ndarray
+
+        European put prices for a whole book in one call, see
+        black_scholes_call_batch for the parameters.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility or
+            lanes is not 1, 4, 8 or 16.
+        )doc");
+
+    // the fused Greeks pass fills only the requested columns and returns them by name
+    const auto greeks_pricer = [](void (*pricer)(const option_batch&, const greeks_batch&, const access_hints&)) {
+        return [pricer](const double_array& stock_price,
+                   const double_array& strike_price,
+                   const double_array& volatility,
+                   const double_array& risk_free_rate,
+                   const double_array& time,
+                   const std::optional<double_array>& yield_curve,
+                   const std::optional<std::vector<std::string>>& greeks,
+                   const std::size_t prefetch_distance,
+                   const bool streaming_stores,
+                   const std::size_t lanes) {
+            static const std::vector<std::pair<std::string, std::span<double> greeks_batch::*>> columns{
+                {"price", &greeks_batch::price},
+                {"delta", &greeks_batch::delta},
+                {"gamma", &greeks_batch::gamma},
+                {"theta", &greeks_batch::theta},
+                {"vega", &greeks_batch::vega},
+                {"rho", &greeks_batch::rho},
+                {"vanna", &greeks_batch::vanna},
+                {"volga", &greeks_batch::volga},
+                {"charm", &greeks_batch::charm},
+                {"speed", &greeks_batch::speed},
+                {"color", &greeks_batch::color}};
+
+            const auto n = static_cast<py::ssize_t>(as_span(stock_price).size());
+            double_array q = yield_curve ? *yield_curve : double_array(n);
+            if (!yield_curve) {
+                std::fill_n(q.mutable_data(), n, 0.0);
+            }
+            const option_batch batch{as_span(stock_price),
+                as_span(strike_price),
+                as_span(volatility),
+                as_span(risk_free_rate),
+                as_span(time),
+                as_span(q)};
+
+            py::dict result;
+            greeks_batch out;
+            for (const auto& [name, member] : columns) {
+                if (greeks && std::find(greeks->begin(), greeks->end(), name) == greeks->end()) {
+                    continue;
+                }
+                double_array column(n);
+                out.*member = as_mutable_span(column);
+                result[py::str(name)] = column;
+            }
+            if (greeks) {
+                for (const auto& name : *greeks) {
+                    if (!result.contains(name)) {
+                        throw std::invalid_argument("unknown greek " + name);
+                    }
+                }
+            }
+            {
+                py::gil_scoped_release release;
+                pricer(batch, out, {prefetch_distance, streaming_stores, lanes});
+            }
+            return result;
+        };
+    };
+
+    m.def("black_scholes_call_greeks_batch",
+        greeks_pricer(&black_scholes_call_greeks_batch),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("greeks") = py::none(),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        black_scholes_call_greeks_batch(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            greeks: list[str] | None = None,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> dict[str, ndarray]
+
+        European call price and Greeks for a whole book in one fused pass.
+        d1, d2, the discount factors and the normal pdf/cdf values are computed
+        once per contract and shared by every Greek, so the second and third
+        order Greeks cost a few multiplies each.
+
+        Vega and volga are per 1.0 of volatility, rho per 1.0 of rate, and
+        theta, charm and color per year of calendar time.
+
+        Parameters
+        ----------
+        stock_price, strike_price, volatility, risk_free_rate, time :
+            One dimensional arrays, see black_scholes_call.
+        yield_curve :
+            Continuous dividend yields, zero when omitted.
+        greeks :
+            Names of the columns to compute, any of price, delta, gamma, theta,
+            vega, rho, vanna, volga, charm, speed and color. All when omitted.
+        prefetch_distance, streaming_stores, lanes :
+            Memory access and simd width tuning, see black_scholes_call_batch.
+
+        Returns
+        -------
+        dict
+            One array per requested column, keyed by name.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility, a
+            Greek name is unknown or lanes is not 1, 4, 8 or 16.
+        )doc");
+
+    m.def("black_scholes_put_greeks_batch",
+        greeks_pricer(&black_scholes_put_greeks_batch),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("greeks") = py::none(),
+        py::arg("prefetch_distance") = 0,
+        py::arg("streaming_stores") = false,
+        py::arg("lanes") = 1,
+        R"doc(
+        black_scholes_put_greeks_batch(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            greeks: list[str] | None = None,
+            prefetch_distance: int = 0,
+            streaming_stores: bool = False,
+            lanes: int = 1
+        ) -> dict[str, ndarray]
+
+        European put price and Greeks for a whole book in one fused pass, see
+        black_scholes_call_greeks_batch.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility, a
+            Greek name is unknown or lanes is not 1, 4, 8 or 16.
+        )doc");
+
+    m.def("implied_volatility",
+        &implied_volatility,
+        py::arg("price"),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg_v("yield_curve", 0.0, "0.0"),
+        py::arg_v("type", option_type::call, "OptionType.call"),
+        R"doc(
+        implied_volatility(
+            price: float,
+            stock_price: float,
+            strike_price: float,
+            risk_free_rate: float,
+            time: float,
+            yield_curve: float = 0.0,
+            type: OptionType = OptionType.call
+        ) -> float
+
+        Black-Scholes volatility that reproduces a European option price. The
+        price is moved to the out of the money side by put-call parity and
+        inverted on the forward with safeguarded Newton steps.
+
+        Raises
+        ------
+        ValueError
+            If spot, strike or time is not positive or the price is outside
+            the no-arbitrage bounds.
+        )doc");
+
+    m.def(
+        "implied_volatility_batch",
+        [](const double_array& price,
+            const double_array& stock_price,
+            const double_array& strike_price,
+            const double_array& risk_free_rate,
+            const double_array& time,
+            const std::optional<double_array>& yield_curve,
+            const option_type type,
+            const std::optional<double_array>& guess) {
+            const auto n = static_cast<py::ssize_t>(as_span(stock_price).size());
+            double_array q = yield_curve ? *yield_curve : double_array(n);
+            if (!yield_curve) {
+                std::fill_n(q.mutable_data(), n, 0.0);
+            }
+            double_array start = guess ? *guess : double_array(n);
+            if (!guess) {
+                std::fill_n(start.mutable_data(), n, 0.0);
+            }
+            const option_batch batch{as_span(stock_price),
+                as_span(strike_price),
+                as_span(start),
+                as_span(risk_free_rate),
+                as_span(time),
+                as_span(q)};
+
+            double_array out(n);
+            auto out_span = as_mutable_span(out);
+            {
+                py::gil_scoped_release release;
+                implied_volatility_batch(as_span(price), batch, type, out_span);
+            }
+            return out;
+        },
+        py::arg("price"),
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg_v("type", option_type::call, "OptionType.call"),
+        py::arg("guess") = py::none(),
+        R"doc(
+        implied_volatility_batch(
+            price: ndarray,
+            stock_price: ndarray,
+            strike_price: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            type: OptionType = OptionType.call,
+            guess: ndarray | None = None
+        ) -> ndarray
+
+        implied_volatility for whole arrays of quotes. guess, for example the
+        previous fit, seeds the solver. Prices outside the no-arbitrage bounds
+        give NaN instead of raising.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ.
+        )doc");
+
+    m.def(
+        "implied_carry",
+        [](const int_array& underlying,
+            const double_array& time,
+            const double_array& strike_price,
+            const double_array& call_price,
+            const double_array& put_price,
+            const double_array& spot) {
+            const parity_chain chain{as_span(underlying),
+                as_span(time),
+                as_span(strike_price),
+                as_span(call_price),
+                as_span(put_price)};
+            std::vector<carry_point> points;
+            {
+                py::gil_scoped_release release;
+                points = implied_carry_batch(chain, as_span(spot));
+            }
+
+            const auto n = static_cast<py::ssize_t>(points.size());
+            int_array ids(n);
+            for (py::ssize_t i = 0; i < n; ++i) {
+                ids.mutable_data()[i] = points[i].underlying;
+            }
+            py::dict result;
+            result["underlying"] = ids;
+            for (const auto& [name, member] : {std::pair{"time", &carry_point::time},
+                     std::pair{"forward", &carry_point::forward},
+                     std::pair{"discount", &carry_point::discount},
+                     std::pair{"risk_free_rate", &carry_point::risk_free_rate},
+                     std::pair{"yield_curve", &carry_point::yield_curve},
+                     std::pair{"residual", &carry_point::residual}}) {
+                double_array column(n);
+                for (py::ssize_t i = 0; i < n; ++i) {
+                    column.mutable_data()[i] = points[i].*member;
+                }
+                result[name] = column;
+            }
+            return result;
+        },
+        py::arg("underlying"),
+        py::arg("time"),
+        py::arg("strike_price"),
+        py::arg("call_price"),
+        py::arg("put_price"),
+        py::arg("spot"),
+        R"doc(
+        implied_carry(
+            underlying: ndarray,
+            time: ndarray,
+            strike_price: ndarray,
+            call_price: ndarray,
+            put_price: ndarray,
+            spot: ndarray
+        ) -> dict[str, ndarray]
+
+        Implied forward, discount and carry of every expiry of every
+        underlying in an option chain. C - P = D F - D K is fitted across the
+        strikes of each expiry with Huber weights, so stale or crossed quotes
+        barely move the fit. Underlyings are fitted in parallel.
+
+        Parameters
+        ----------
+        underlying :
+            Integer index of the underlying of each call/put pair.
+        time, strike_price, call_price, put_price :
+            Expiry, strike and mid prices of each pair; rows in any order.
+        spot :
+            Spot price of each underlying, indexed by underlying.
+
+        Returns
+        -------
+        dict
+            underlying, time, forward, discount, risk_free_rate, yield_curve
+            and residual arrays, one entry per expiry with at least two
+            distinct strikes, sorted by underlying then time. yield_curve is
+            the implied dividend or borrow yield used by the pricers.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, an underlying index is out of range or a fit
+            gives a non positive discount or forward.
+        )doc");
+
+    py::class_<carry_curve>(m,
+        "CarryCurve",
+        R"doc(
+        Term structure of implied carry per underlying. The total carry q * T
+        is linear between pillars and the yield is flat beyond them.
+        )doc")
+        .def(py::init([](const py::dict& points) {
+            const auto id_column = points["underlying"].cast<int_array>();
+            const auto time_column = points["time"].cast<double_array>();
+            const auto yield_column = points["yield_curve"].cast<double_array>();
+            const auto ids = as_span(id_column);
+            const auto time = as_span(time_column);
+            const auto yield = as_span(yield_column);
+            if (time.size() != ids.size() || yield.size() != ids.size()) {
+                throw std::invalid_argument("carry columns must have the same length");
+            }
+            std::vector<carry_point> pillars(ids.size());
+            for (std::size_t i = 0; i < ids.size(); ++i) {
+                pillars[i].underlying = ids[i];
+                pillars[i].time = time[i];
+                pillars[i].yield_curve = yield[i];
+            }
+            return carry_curve(std::move(pillars));
+        }),
+            py::arg("points"),
+            R"doc(
+            CarryCurve(points: dict[str, ndarray])
+
+            Builds the curve from the dict returned by implied_carry, or any
+            dict with underlying, time and yield_curve arrays.
+            )doc")
+        .def("yield_curve",
+            [](const carry_curve& curve, const int_array& underlying, const double_array& time) {
+                double_array out(static_cast<py::ssize_t>(as_span(time).size()));
+                auto out_span = as_mutable_span(out);
+                curve.yield_batch(as_span(underlying), as_span(time), out_span);
+                return out;
+            },
+            py::arg("underlying"),
+            py::arg("time"),
+            R"doc(
+            yield_curve(underlying: ndarray, time: ndarray) -> ndarray
+
+            Implied yield of each contract, ready to pass as the yield_curve
+            argument of the batch pricers.
+            )doc");
+}
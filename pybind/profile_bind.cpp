@@ -0,0 +1,97 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "profile_bind.h"
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+#include "../include/pyfi/profile.h"
+
+namespace py = pybind11;
+
+void add_profile_module(py::module_& m) {
+    using namespace pyfi::profile;
+
+    // a session while the with block runs, then the results it collected
+    struct profile_run {
+        std::unique_ptr<session> open;
+        std::vector<entry> results;
+
+        [[nodiscard]] std::vector<entry> current() const {
+            return open ? open->results() : results;
+        }
+    };
+
+    py::class_<profile_run>(m,
+        "Profile",
+        R"doc(
+        Profile() -> Profile
+
+        Context manager that profiles the batch pricers, implied volatility,
+        Monte Carlo, bump and reprice and surface calls made inside its with
+        block, from every thread: calls, wall time, and where the kernel allows
+        perf_event_open, cycles, instructions, cache references and misses and
+        branches and mispredicts. Also available as pyfi.profile().
+
+        Examples
+        --------
+        >>> with pyfi.profile() as prof:
+        ...     pyfi.option.black_scholes_call_batch(S, K, sigma, r, T, q)
+        >>> print(prof)
+        )doc")
+        .def(py::init<>())
+        .def("__enter__",
+            [](profile_run& run) -> profile_run& {
+                run.results.clear();
+                run.open = std::make_unique<session>();
+                return run;
+            })
+        .def("__exit__",
+            [](profile_run& run, const py::args&) {
+                if (run.open) {
+                    run.results = run.open->results();
+                    run.open.reset();
+                }
+            })
+        .def(
+            "results",
+            [](const profile_run& run) {
+                py::dict out;
+                for (const auto& [name, totals] : run.current()) {
+                    py::dict row;
+                    row["calls"] = totals.calls;
+                    row["rows"] = totals.rows;
+                    row["seconds"] = totals.seconds;
+                    const bool hardware = totals.hardware_calls > 0;
+                    const auto count = [&](const event e) -> py::object {
+                        return hardware ? py::object(py::int_(totals[e])) : py::object(py::none());
+                    };
+                    row["cycles"] = count(event::cycles);
+                    row["instructions"] = count(event::instructions);
+                    row["ipc"] = hardware ? py::object(py::float_(totals.ipc())) : py::object(py::none());
+                    row["cache_references"] = count(event::cache_references);
+                    row["cache_misses"] = count(event::cache_misses);
+                    row["branches"] = count(event::branches);
+                    row["branch_misses"] = count(event::branch_misses);
+                    out[py::str(name)] = row;
+                }
+                return out;
+            },
+            R"doc(
+            results() -> dict
+
+            Totals per profiled function, keyed by name such as
+            "option.black_scholes_call_batch": calls, rows, seconds, cycles,
+            instructions, ipc, cache_references, cache_misses, branches and
+            branch_misses. The hardware counts are None where perf_event_open is
+            not allowed. Inside the with block these are the totals so far.
+            )doc")
+        .def("__str__", [](const profile_run& run) {
+            return format(run.current());
+        });
+
+    m.def("hardware_available",
+        &hardware_available,
+        "Whether the hardware counters can be read, which perf_event_paranoid and most containers forbid.");
+}
@@ -0,0 +1,14 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef PROFILE_BIND_H
+#define PROFILE_BIND_H
+
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void add_profile_module(py::module_& m);
+
+#endif // PROFILE_BIND_H
@@ -0,0 +1,172 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "proxy_bind.h"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include "../include/pyfi/option.h"
+#include "../include/pyfi/proxy.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_proxy_module(py::module_& m) {
+    using namespace pyfi::proxy;
+    using pyfi::option::option_type;
+    using axis_tuple = std::tuple<double, double, int>;
+
+    // the contract the proxy stands in for, with everything but spot, volatility and time fixed
+    const auto model_pricer = [](const double strike_price,
+                                  const double risk_free_rate,
+                                  const double yield_curve,
+                                  const option_type type,
+                                  const std::string& model,
+                                  const bool american,
+                                  const int steps) -> pricer {
+        namespace option = pyfi::option;
+        const auto payoff = type == option_type::call ? option::call_payoff : option::put_payoff;
+        if (model == "black_scholes") {
+            const auto black_scholes =
+                type == option_type::call ? option::black_scholes_call : option::black_scholes_put;
+            return [=](const double S, const double sigma, const double T) {
+                return black_scholes(S, strike_price, sigma, risk_free_rate, T, yield_curve);
+            };
+        }
+        if (model == "binomial") {
+            if (steps <= 0) {
+                throw std::invalid_argument("steps must be positive");
+            }
+            return [=](const double S, const double sigma, const double T) {
+                return american ? option::binomial_us_option(S, strike_price, sigma, risk_free_rate, steps, T, payoff)
+                                : option::binomial_eu_option(S, strike_price, sigma, risk_free_rate, steps, T, payoff);
+            };
+        }
+        throw std::invalid_argument("unknown model " + model);
+    };
+
+    py::class_<chebyshev_proxy>(m,
+        "ChebyshevProxy",
+        R"doc(
+        ChebyshevProxy(
+            strike_price: float,
+            risk_free_rate: float,
+            spot: tuple[float, float, int],
+            volatility: tuple[float, float, int],
+            time: tuple[float, float, int],
+            yield_curve: float = 0.0,
+            type: OptionType = OptionType.call,
+            model: str = "black_scholes",
+            american: bool = False,
+            steps: int = 500,
+            drop_tolerance: float = 0.0
+        ) -> ChebyshevProxy
+
+        Chebyshev interpolant of one option's price over a box of spot,
+        volatility and time. Building prices the contract once per grid node,
+        in parallel and without the GIL; afterwards each evaluation costs a few
+        hundred nanoseconds however slow the model is, which pays off when the
+        same contract is revalued across many scenarios.
+
+        Parameters
+        ----------
+        spot, volatility, time :
+            (lower, upper, nodes) of each axis, 2 to 64 nodes. Volatility and
+            time are usually smooth enough for 6 to 8 nodes.
+        model :
+            black_scholes or binomial (steps, american).
+        drop_tolerance :
+            Coefficients smaller than this are dropped, which evaluates faster
+            and adds at most their sum to the error.
+
+        Raises
+        ------
+        ValueError
+            If an axis is empty or has a bad node count, drop_tolerance is
+            negative or the model is unknown.
+
+        Examples
+        --------
+        >>> proxy = pyfi.proxy.ChebyshevProxy(100.0, 0.03, spot=(60, 140, 16),
+        ...     volatility=(0.15, 0.45, 8), time=(0.5, 2.0, 8),
+        ...     type=OptionType.put, model="binomial", american=True)
+        >>> proxy(100.0, 0.2, 1.0), proxy.error_estimate()
+        )doc")
+        .def(py::init([model_pricer](const double strike_price,
+                          const double risk_free_rate,
+                          const axis_tuple& spot,
+                          const axis_tuple& volatility,
+                          const axis_tuple& time,
+                          const double yield_curve,
+                          const option_type type,
+                          const std::string& model,
+                          const bool american,
+                          const int steps,
+                          const double drop_tolerance) {
+            const auto to_axis = [](const axis_tuple& a) {
+                return axis{std::get<0>(a), std::get<1>(a), std::get<2>(a)};
+            };
+            const auto price = model_pricer(strike_price, risk_free_rate, yield_curve, type, model, american, steps);
+            const proxy_config config{to_axis(spot), to_axis(volatility), to_axis(time), drop_tolerance};
+            py::gil_scoped_release release;
+            return chebyshev_proxy(price, config);
+        }),
+            py::arg("strike_price"),
+            py::arg("risk_free_rate"),
+            py::arg("spot"),
+            py::arg("volatility"),
+            py::arg("time"),
+            py::arg("yield_curve") = 0.0,
+            py::arg_v("type", option_type::call, "OptionType.call"),
+            py::arg("model") = "black_scholes",
+            py::arg("american") = false,
+            py::arg("steps") = 500,
+            py::arg("drop_tolerance") = 0.0)
+        .def("__call__",
+            &chebyshev_proxy::operator(),
+            py::arg("spot"),
+            py::arg("volatility"),
+            py::arg("time"),
+            R"doc(
+            __call__(spot: float, volatility: float, time: float) -> float
+
+            Interpolated price. Raises ValueError outside the box.
+            )doc")
+        .def(
+            "evaluate_batch",
+            [](const chebyshev_proxy& self,
+                const double_array& spot,
+                const double_array& volatility,
+                const double_array& time) {
+                double_array out(static_cast<py::ssize_t>(as_span(spot).size()));
+                {
+                    py::gil_scoped_release release;
+                    self.evaluate_batch(as_span(spot), as_span(volatility), as_span(time), as_mutable_span(out));
+                }
+                return out;
+            },
+            py::arg("spot"),
+            py::arg("volatility"),
+            py::arg("time"),
+            R"doc(
+            evaluate_batch(spot: ndarray, volatility: ndarray, time: ndarray) -> ndarray
+
+            Interpolated prices of many scenarios. Raises ValueError if the
+            lengths differ or a scenario is outside the box.
+            )doc")
+        .def("error_estimate",
+            &chebyshev_proxy::error_estimate,
+            R"doc(
+            error_estimate() -> float
+
+            A priori bound on the error anywhere in the box, from the size of
+            the highest order and the dropped coefficients.
+            )doc")
+        .def_property_readonly("coefficients",
+            &chebyshev_proxy::coefficients,
+            "Number of Chebyshev coefficients kept after dropping.");
+}
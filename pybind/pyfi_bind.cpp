@@ -7,7 +7,21 @@
 #include <pybind11/stl.h>
 
 #include "./bond_bind.cpp"
+#include "./book_bind.cpp"
+#include "./convertible_bind.cpp"
+#include "./credit_bind.cpp"
+#include "./csv_bind.cpp"
+#include "./curve_bind.cpp"
+#include "./exposure_bind.cpp"
+#include "./futures_bind.cpp"
+#include "./memory_bind.cpp"
+#include "./monte_carlo_bind.cpp"
 #include "./option_bind.cpp"
+#include "./profile_bind.cpp"
+#include "./proxy_bind.cpp"
+#include "./risk_bind.cpp"
+#include "./surface_bind.cpp"
+#include "./trace_bind.cpp"
 
 namespace py = pybind11;
 
@@ -23,4 +37,61 @@ PYBIND11_MODULE(_pyfi, m) {
         "Contains functions related to options pricing for american and european options alongside the greeks for the "
         "Black-Scholes formula");
     add_option_module(option);
+
+    auto memory = m.def_submodule("memory",
+        "Contains huge page and NUMA aware buffers for the columns and results of large books");
+    add_memory_module(memory);
+
+    auto book = m.def_submodule("book",
+        "Contains the shared memory option and bond book used to price one copy of a book from many processes");
+    add_book_module(book);
+
+    auto csv = m.def_submodule("csv",
+        "Contains the fast CSV reader used to load market data into NumPy columns for the batch pricers");
+    add_csv_module(csv);
+
+    auto monte_carlo = m.def_submodule("monte_carlo",
+        "Contains the Monte Carlo option pricer, which prices whole books on common random numbers");
+    add_monte_carlo_module(monte_carlo);
+
+    auto risk = m.def_submodule("risk",
+        "Contains the bump and reprice Greeks engine for the closed form, lattice and Monte Carlo pricers");
+    add_risk_module(risk);
+
+    auto surface = m.def_submodule("surface",
+        "Contains the implied volatility surface builder that turns raw option quotes into a cleaned vol grid");
+    add_surface_module(surface);
+
+    auto profiler = m.def_submodule("profiler",
+        "Contains the hardware counter profiler of the batch pricers, also available as pyfi.profile()");
+    add_profile_module(profiler);
+    m.attr("profile") = profiler.attr("Profile");
+
+    auto trace = m.def_submodule("trace",
+        "Contains the trace recorder that exports the library's stages as Chrome trace / Perfetto JSON");
+    add_trace_module(trace);
+
+    auto proxy = m.def_submodule("proxy",
+        "Contains the Chebyshev proxy pricers that stand in for slow pricers when a contract is revalued many times");
+    add_proxy_module(proxy);
+
+    auto curve = m.def_submodule("curve",
+        "Contains the par curve bootstrap with its Jacobian and the zero to par risk transformation for bond books");
+    add_curve_module(curve);
+
+    auto exposure = m.def_submodule("exposure",
+        "Contains the counterparty exposure engine that simulates risk factors and aggregates EE and PFE profiles");
+    add_exposure_module(exposure);
+
+    auto futures = m.def_submodule("futures",
+        "Contains bond futures analytics: conversion factors, basis, implied repo and cheapest to deliver switches");
+    add_futures_module(futures);
+
+    auto convertible = m.def_submodule("convertible",
+        "Contains the convertible bond pricer on a binomial lattice with equity and credit discounting split");
+    add_convertible_module(convertible);
+
+    auto credit = m.def_submodule("credit",
+        "Contains hazard rate curves, CDS valuation and bootstrapping, and defaultable bond pricing");
+    add_credit_module(credit);
 }
@@ -0,0 +1,234 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "risk_bind.h"
+#include <algorithm>
+#include <optional>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../include/pyfi/bump.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_risk_module(py::module_& m) {
+    using namespace pyfi::bump;
+    using pyfi::option::option_batch;
+    using pyfi::option::option_type;
+
+    // runs the engine on the contract columns and returns one array per Greek
+    const auto risk = [](const double_array& stock_price,
+                          const double_array& strike_price,
+                          const double_array& volatility,
+                          const double_array& risk_free_rate,
+                          const double_array& time,
+                          const std::optional<double_array>& yield_curve,
+                          const auto& engine) {
+        const auto n = static_cast<py::ssize_t>(as_span(stock_price).size());
+        double_array q = yield_curve ? *yield_curve : double_array(n);
+        if (!yield_curve) {
+            std::fill_n(q.mutable_data(), n, 0.0);
+        }
+        const option_batch batch{as_span(stock_price),
+            as_span(strike_price),
+            as_span(volatility),
+            as_span(risk_free_rate),
+            as_span(time),
+            as_span(q)};
+
+        std::vector<greeks> out(n);
+        {
+            py::gil_scoped_release release;
+            engine(batch, std::span<greeks>(out));
+        }
+
+        py::dict result;
+        for (const auto& [name, member] : {std::pair{"price", &greeks::price},
+                 std::pair{"delta", &greeks::delta},
+                 std::pair{"gamma", &greeks::gamma},
+                 std::pair{"vega", &greeks::vega},
+                 std::pair{"theta", &greeks::theta},
+                 std::pair{"rho", &greeks::rho}}) {
+            double_array column(n);
+            std::transform(out.begin(), out.end(), column.mutable_data(), [member](const greeks& g) {
+                return g.*member;
+            });
+            result[name] = column;
+        }
+        return result;
+    };
+
+    m.def(
+        "bump_and_reprice",
+        [risk](const double_array& stock_price,
+            const double_array& strike_price,
+            const double_array& volatility,
+            const double_array& risk_free_rate,
+            const double_array& time,
+            const std::optional<double_array>& yield_curve,
+            const option_type type,
+            const std::string& model,
+            const bool american,
+            const int steps,
+            const std::size_t paths,
+            const std::uint64_t seed,
+            const double spot_bump,
+            const double volatility_bump,
+            const double rate_bump,
+            const double time_bump) {
+            scenario_pricer pricer;
+            if (model == "black_scholes") {
+                pricer = black_scholes_pricer(type);
+            } else if (model == "binomial") {
+                pricer = binomial_pricer(type, american, steps);
+            } else if (model == "monte_carlo") {
+                pricer = monte_carlo_pricer(type, pyfi::monte_carlo::payoff_style::european, {paths, 1, seed, true});
+            } else {
+                throw std::invalid_argument("unknown model " + model);
+            }
+            const bump_sizes bumps{spot_bump, volatility_bump, rate_bump, time_bump};
+            return risk(stock_price,
+                strike_price,
+                volatility,
+                risk_free_rate,
+                time,
+                yield_curve,
+                [&](const option_batch& batch, const std::span<greeks> out) {
+                    bump_and_reprice(batch, pricer, out, bumps);
+                });
+        },
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("type") = option_type::call,
+        py::arg("model") = "black_scholes",
+        py::arg("american") = false,
+        py::arg("steps") = 500,
+        py::arg("paths") = 100'000,
+        py::arg("seed") = 42,
+        py::arg("spot_bump") = 0.01,
+        py::arg("volatility_bump") = 0.01,
+        py::arg("rate_bump") = 1e-4,
+        py::arg("time_bump") = 1.0 / 365.0,
+        R"doc(
+        bump_and_reprice(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            type: OptionType = OptionType.call,
+            model: str = "black_scholes",
+            american: bool = False,
+            steps: int = 500,
+            paths: int = 100000,
+            seed: int = 42,
+            spot_bump: float = 0.01,
+            volatility_bump: float = 0.01,
+            rate_bump: float = 1e-4,
+            time_bump: float = 1 / 365
+        ) -> dict[str, ndarray]
+
+        Finite difference Greeks for any pricer. The base and eight bumped
+        scenarios of every contract are priced in one batch call; with the
+        monte_carlo model they all share the same paths.
+
+        Parameters
+        ----------
+        model :
+            black_scholes, binomial (steps, american) or monte_carlo (paths,
+            seed, European payoff).
+        spot_bump :
+            Relative to the spot. The other bumps are absolute; the
+            volatility and time bumps are capped at half the contract's
+            volatility and time to maturity.
+
+        Returns
+        -------
+        dict
+            price, delta, gamma, vega, theta and rho arrays. Vega and rho are
+            per 1.0 of volatility and rate, theta per year of calendar time.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility or
+            the model is unknown.
+        )doc");
+
+    m.def(
+        "binomial_greeks",
+        [risk](const double_array& stock_price,
+            const double_array& strike_price,
+            const double_array& volatility,
+            const double_array& risk_free_rate,
+            const double_array& time,
+            const std::optional<double_array>& yield_curve,
+            const option_type type,
+            const bool american,
+            const int steps,
+            const double volatility_bump,
+            const double rate_bump) {
+            const bump_sizes bumps{.volatility = volatility_bump, .rate = rate_bump};
+            return risk(stock_price,
+                strike_price,
+                volatility,
+                risk_free_rate,
+                time,
+                yield_curve,
+                [&](const option_batch& batch, const std::span<greeks> out) {
+                    binomial_greeks(batch, type, american, steps, out, bumps);
+                });
+        },
+        py::arg("stock_price"),
+        py::arg("strike_price"),
+        py::arg("volatility"),
+        py::arg("risk_free_rate"),
+        py::arg("time"),
+        py::arg("yield_curve") = py::none(),
+        py::arg("type") = option_type::call,
+        py::arg("american") = false,
+        py::arg("steps") = 500,
+        py::arg("volatility_bump") = 0.01,
+        py::arg("rate_bump") = 1e-4,
+        R"doc(
+        binomial_greeks(
+            stock_price: ndarray,
+            strike_price: ndarray,
+            volatility: ndarray,
+            risk_free_rate: ndarray,
+            time: ndarray,
+            yield_curve: ndarray | None = None,
+            type: OptionType = OptionType.call,
+            american: bool = False,
+            steps: int = 500,
+            volatility_bump: float = 0.01,
+            rate_bump: float = 1e-4
+        ) -> dict[str, ndarray]
+
+        Cox-Ross-Rubinstein Greeks that reuse the base lattice. Delta, gamma
+        and theta are read off a tree started two steps before today, so they
+        need no repricing and do not oscillate with the step count the way a
+        small spot bump does. Only vega and rho reprice.
+
+        Returns
+        -------
+        dict
+            price, delta, gamma, vega, theta and rho arrays.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, a contract has zero time or volatility or
+            steps is not positive.
+        )doc");
+}
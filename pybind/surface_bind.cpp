@@ -0,0 +1,137 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "surface_bind.h"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "../include/pyfi/surface.h"
+#include "array_bind.h"
+
+namespace py = pybind11;
+
+void add_surface_module(py::module_& m) {
+    using namespace pyfi::surface;
+
+    m.def(
+        "build_surface",
+        [](const double_array& time,
+            const double_array& strike_price,
+            const double_array& call_bid,
+            const double_array& call_ask,
+            const double_array& put_bid,
+            const double_array& put_ask,
+            const double spot,
+            const double_array& grid_time,
+            const double_array& grid_moneyness,
+            const double max_relative_spread,
+            const double outlier_threshold,
+            const std::size_t min_quotes) {
+            const quote_chain quotes{as_span(time),
+                as_span(strike_price),
+                as_span(call_bid),
+                as_span(call_ask),
+                as_span(put_bid),
+                as_span(put_ask)};
+            vol_surface surface;
+            {
+                py::gil_scoped_release release;
+                surface = build_surface(quotes,
+                    spot,
+                    as_span(grid_time),
+                    as_span(grid_moneyness),
+                    {max_relative_spread, outlier_threshold, min_quotes});
+            }
+
+            const auto rows = static_cast<py::ssize_t>(surface.time.size());
+            const auto columns = static_cast<py::ssize_t>(surface.moneyness.size());
+            py::array_t<double> volatility({rows, columns});
+            std::copy(surface.volatility.begin(), surface.volatility.end(), volatility.mutable_data());
+
+            py::list smiles;
+            for (const auto& s : surface.smiles) {
+                py::dict entry;
+                entry["time"] = s.time;
+                entry["forward"] = s.forward;
+                entry["discount"] = s.discount;
+                entry["moneyness"] = py::array_t<double>(static_cast<py::ssize_t>(s.moneyness.size()), s.moneyness.data());
+                entry["volatility"] =
+                    py::array_t<double>(static_cast<py::ssize_t>(s.volatility.size()), s.volatility.data());
+                entry["rejected"] = s.rejected;
+                smiles.append(entry);
+            }
+
+            py::dict result;
+            result["time"] = py::array_t<double>(rows, surface.time.data());
+            result["moneyness"] = py::array_t<double>(columns, surface.moneyness.data());
+            result["forward"] = py::array_t<double>(rows, surface.forward.data());
+            result["volatility"] = volatility;
+            result["smiles"] = smiles;
+            return result;
+        },
+        py::arg("time"),
+        py::arg("strike_price"),
+        py::arg("call_bid"),
+        py::arg("call_ask"),
+        py::arg("put_bid"),
+        py::arg("put_ask"),
+        py::arg("spot"),
+        py::arg("grid_time"),
+        py::arg("grid_moneyness"),
+        py::arg("max_relative_spread") = 0.5,
+        py::arg("outlier_threshold") = 4.0,
+        py::arg("min_quotes") = 3,
+        R"doc(
+        build_surface(
+            time: ndarray,
+            strike_price: ndarray,
+            call_bid: ndarray,
+            call_ask: ndarray,
+            put_bid: ndarray,
+            put_ask: ndarray,
+            spot: float,
+            grid_time: ndarray,
+            grid_moneyness: ndarray,
+            max_relative_spread: float = 0.5,
+            outlier_threshold: float = 4.0,
+            min_quotes: int = 3
+        ) -> dict
+
+        Cleaned implied vol surface of one underlying from raw bid/ask quotes
+        in one call. Per expiry, in parallel: forward and discount from a
+        robust put-call parity fit, out of the money mids inverted on that
+        forward, and wide, arbitrageable or off-smile quotes dropped. The
+        cleaned smiles are interpolated onto the grid, total variance linear
+        in log moneyness and in time, flat vol beyond the quotes.
+
+        Parameters
+        ----------
+        time, strike_price :
+            Expiry and strike of each quote row.
+        call_bid, call_ask, put_bid, put_ask :
+            Quotes of each row; a non positive bid or an ask below the bid
+            marks the side as missing.
+        grid_moneyness :
+            Log moneyness ln(K / F) of the grid columns.
+        max_relative_spread :
+            Quotes with (ask - bid) / mid above this are dropped.
+        outlier_threshold :
+            Vols further than this many robust deviations from a quadratic
+            smile fit are dropped.
+        min_quotes :
+            Clean vols an expiry needs to enter the surface.
+
+        Returns
+        -------
+        dict
+            time, moneyness and forward arrays, the volatility grid of shape
+            (len(time), len(moneyness)) and a list of the cleaned smiles.
+
+        Raises
+        ------
+        ValueError
+            If the lengths differ, spot is not positive or no expiry has
+            enough clean quotes.
+        )doc");
+}
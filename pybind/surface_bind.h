@@ -0,0 +1,14 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#ifndef SURFACE_BIND_H
+#define SURFACE_BIND_H
+
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void add_surface_module(py::module_& m);
+
+#endif // SURFACE_BIND_H
@@ -0,0 +1,98 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include "trace_bind.h"
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <sstream>
+#include <string>
+#include "../include/pyfi/trace.h"
+
+namespace py = pybind11;
+
+void add_trace_module(py::module_& m) {
+    using namespace pyfi::trace;
+
+    m.def("start",
+        &start,
+        py::arg("spans_per_thread") = 1 << 16,
+        R"doc(
+        start(spans_per_thread: int = 65536) -> None
+
+        Starts recording the library's stages (CSV parsing, carry and surface
+        building, pricing, Greeks and thread pool chunks) as trace spans, and
+        drops any recorded before. Each thread records into its own buffer of
+        spans_per_thread spans; spans past that are dropped and counted.
+
+        Raises
+        ------
+        ValueError
+            If spans_per_thread is 0.
+        )doc");
+
+    m.def("stop", &stop, "Stops recording; the spans so far are kept until the next start().");
+    m.def("enabled", &enabled, "Whether spans are being recorded.");
+    m.def("dropped", &dropped, "Spans dropped since start() because a thread's buffer was full.");
+
+    m.def(
+        "save",
+        [](const std::string& path) {
+            write_json(path);
+        },
+        py::arg("path"),
+        R"doc(
+        save(path: str) -> None
+
+        Writes the recorded spans as Chrome trace event JSON, to open in
+        chrome://tracing or ui.perfetto.dev.
+
+        Raises
+        ------
+        RuntimeError
+            If the file cannot be written.
+        )doc");
+
+    m.def(
+        "to_json",
+        [] {
+            std::ostringstream out;
+            write_json(out);
+            return out.str();
+        },
+        "The recorded spans as a Chrome trace event JSON string.");
+
+    // a span over a with block, for the stages of a Python job around the library calls
+    struct python_span {
+        const char* name;
+        const char* category;
+        std::unique_ptr<span> open;
+    };
+
+    py::class_<python_span>(m,
+        "Span",
+        R"doc(
+        Span(name: str, category: str = "python") -> Span
+
+        Context manager that records its with block as one span, so a job's own
+        stages show up in the trace around the library's.
+
+        Examples
+        --------
+        >>> with pyfi.trace.Span("load quotes"):
+        ...     quotes = pyfi.csv.read_csv(path, real_columns=["bid", "ask"])
+        )doc")
+        .def(py::init([](const std::string& name, const std::string& category) {
+            return python_span{intern(name), intern(category), nullptr};
+        }),
+            py::arg("name"),
+            py::arg("category") = "python")
+        .def("__enter__",
+            [](python_span& s) -> python_span& {
+                s.open = std::make_unique<span>(s.name, s.category);
+                return s;
+            })
+        .def("__exit__", [](python_span& s, const py::args&) {
+            s.open.reset();
+        });
+}
@@ -1,6 +1,12 @@
 # pyfi - Python Financial Instruments Library
 # Import submodules from the compiled C++ extension
 
-from ._pyfi import bond, option
+from ._pyfi import (
+    bond, book, convertible, credit, csv, curve, exposure, futures, memory, monte_carlo, option, profile, profiler,
+    proxy, risk, surface, trace,
+)
 
-__all__ = ['bond', 'option']
+__all__ = [
+    'bond', 'book', 'convertible', 'credit', 'csv', 'curve', 'exposure', 'futures', 'memory', 'monte_carlo', 'option',
+    'profile', 'profiler', 'proxy', 'risk', 'surface', 'trace',
+]
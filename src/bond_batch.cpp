@@ -0,0 +1,169 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/bond.h>
+#include <pyfi/profile.h>
+#include <pyfi/simd.h>
+#include <pyfi/trace.h>
+#include <stdexcept>
+
+namespace pyfi::bond {
+
+    std::size_t bond_batch::size() const {
+        const auto n = par_value.size();
+        if (coupon_rate.size() != n || annual_yield.size() != n || years_to_maturity.size() != n || m.size() != n) {
+            throw std::invalid_argument("bond_batch columns must have the same length");
+        }
+        return n;
+    }
+
+    bond_batch bond_batch::slice(const std::size_t offset, const std::size_t count) const {
+        if (offset + count > size()) {
+            throw std::invalid_argument("bond_batch slice out of range");
+        }
+        return {par_value.subspan(offset, count),
+            coupon_rate.subspan(offset, count),
+            annual_yield.subspan(offset, count),
+            years_to_maturity.subspan(offset, count),
+            m.subspan(offset, count)};
+    }
+
+    static std::size_t checked_size(const bond_batch& batch, const std::span<double> out) {
+        const auto n = batch.size();
+        if (out.size() != n) {
+            throw std::invalid_argument("output size must match the batch size");
+        }
+        return n;
+    }
+
+    // prefetches row i + distance of every input column, once per cache line of rows
+    static void prefetch_ahead(const bond_batch& batch,
+        const std::size_t i,
+        const std::size_t n,
+        const std::size_t distance) {
+        const auto ahead = i + distance;
+        if (distance == 0 || ahead >= n || ahead % memory::line_doubles != 0) {
+            return;
+        }
+        memory::prefetch(&batch.par_value[ahead]);
+        memory::prefetch(&batch.coupon_rate[ahead]);
+        memory::prefetch(&batch.annual_yield[ahead]);
+        memory::prefetch(&batch.years_to_maturity[ahead]);
+        memory::prefetch(&batch.m[ahead]);
+    }
+
+    // prefetches for rows [i, i + W), which crosses at most one prefetch point per input line
+    template <std::size_t W>
+    static void prefetch_pack(const bond_batch& batch,
+        const std::size_t i,
+        const std::size_t n,
+        const std::size_t distance) {
+        for (std::size_t j = i; j < i + W; ++j) {
+            prefetch_ahead(batch, j, n, distance);
+        }
+    }
+
+    /*
+     * dirty_coupon_price_from_T on rows [i, i + W), less the accrued interest when Clean: the same schedule and
+     * closed form, with the powers of 1 + y / m taken as exp(x log(1 + y / m)) and the zero yield case chosen per lane.
+     */
+    template <bool Clean, std::size_t W>
+    static simd::pack<W> price_pack(const bond_batch& batch, const std::size_t i) {
+        using pack = simd::pack<W>;
+        const pack m = simd::load<W>(&batch.m[i]);
+        if (simd::any_of<W>(m <= 0.0)) {
+            throw std::invalid_argument("m must be positive");
+        }
+        const pack par_value = simd::load<W>(&batch.par_value[i]);
+        const pack N = simd::load<W>(&batch.years_to_maturity[i]) * m;
+        const pack fraction = N - simd::floor<W>(N);
+        const pack n = simd::ceil<W>(N);
+        const pack alpha = simd::select<W>(simd::abs<W>(fraction) < 1e-12, pack(0.0), 1.0 - fraction);
+
+        const pack r = simd::load<W>(&batch.annual_yield[i]) / m;
+        const pack b = 1.0 + r;
+        const pack C = par_value * (simd::load<W>(&batch.coupon_rate[i]) / m);
+        const pack log_b = simd::log<W>(b);
+        const pack b_neg_n = simd::exp<W>(-n * log_b);
+        const pack ann = (1.0 - b_neg_n) / (b - 1.0);
+        const pack dirty = simd::select<W>(simd::abs<W>(r) < 1e-15,
+            C * n + par_value,
+            simd::exp<W>(alpha * log_b) * (C * ann + par_value * b_neg_n));
+        if constexpr (Clean) {
+            return dirty - C * alpha;
+        }
+        return dirty;
+    }
+
+    // the first n - n % W rows in packs of W, the rest one by one with the scalar pricer
+    template <bool Clean, bool Streaming, std::size_t W>
+    static void price_loop(const bond_batch& batch, const std::span<double> out, const std::size_t distance) {
+        constexpr auto pricer = Clean ? &clean_coupon_price_from_T : &dirty_coupon_price_from_T;
+        const auto n = out.size();
+        std::size_t i = 0;
+        if constexpr (W > 1) {
+            for (; i + W <= n; i += W) {
+                prefetch_pack<W>(batch, i, n, distance);
+                simd::store<Streaming, W>(&out[i], price_pack<Clean, W>(batch, i));
+            }
+        }
+        for (; i < n; ++i) {
+            prefetch_ahead(batch, i, n, distance);
+            if (batch.m[i] <= 0) {
+                throw std::invalid_argument("m must be positive");
+            }
+            memory::store<Streaming>(&out[i],
+                pricer(batch.par_value[i],
+                    batch.coupon_rate[i],
+                    batch.annual_yield[i],
+                    batch.years_to_maturity[i],
+                    batch.m[i]));
+        }
+    }
+
+    template <bool Clean, bool Streaming>
+    static void price_lanes(const bond_batch& batch, const std::span<double> out, const memory::access_hints& hints) {
+        const auto distance = hints.prefetch_distance;
+        switch (hints.lanes) {
+        case 1:
+            return price_loop<Clean, Streaming, 1>(batch, out, distance);
+        case 4:
+            return price_loop<Clean, Streaming, 4>(batch, out, distance);
+        case 8:
+            return price_loop<Clean, Streaming, 8>(batch, out, distance);
+        case 16:
+            return price_loop<Clean, Streaming, 16>(batch, out, distance);
+        default:
+            throw std::invalid_argument("lanes must be 1, 4, 8 or 16");
+        }
+    }
+
+    template <bool Clean>
+    static void price_pass(const bond_batch& batch, const std::span<double> out, const memory::access_hints& hints) {
+        checked_size(batch, out);
+        if (hints.streaming_stores) {
+            const memory::fence_guard fence;
+            price_lanes<Clean, true>(batch, out, hints);
+        } else {
+            price_lanes<Clean, false>(batch, out, hints);
+        }
+    }
+
+    void dirty_coupon_price_from_T_batch(const bond_batch& batch,
+        const std::span<double> out,
+        const memory::access_hints& hints) {
+        const profile::scope scope("bond.dirty_coupon_price_from_T_batch", batch.size());
+        const trace::span span("bond.dirty_coupon_price_from_T_batch", "pricing", batch.size());
+        price_pass<false>(batch, out, hints);
+    }
+
+    void clean_coupon_price_from_T_batch(const bond_batch& batch,
+        const std::span<double> out,
+        const memory::access_hints& hints) {
+        const profile::scope scope("bond.clean_coupon_price_from_T_batch", batch.size());
+        const trace::span span("bond.clean_coupon_price_from_T_batch", "pricing", batch.size());
+        price_pass<true>(batch, out, hints);
+    }
+
+} // namespace pyfi::bond
@@ -0,0 +1,314 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/book.h>
+#include <pyfi/trace.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace pyfi::book {
+
+    namespace {
+        constexpr std::uint64_t book_magic = 0x4b4f4f42'49465950; // "PYFIBOOK"
+        constexpr std::uint32_t book_version = 1;
+        constexpr std::size_t cache_line = 64;
+        constexpr std::size_t option_columns = 8;
+        constexpr std::size_t bond_double_columns = 6;
+
+        struct alignas(cache_line) book_header {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t workers;
+            std::uint64_t options;
+            std::uint64_t bonds;
+            std::uint64_t bytes;
+        };
+
+        std::size_t round_up(const std::size_t bytes) {
+            return (bytes + cache_line - 1) / cache_line * cache_line;
+        }
+
+        std::size_t double_column_bytes(const std::size_t n) {
+            return round_up(n * sizeof(double));
+        }
+
+        std::size_t segment_bytes(const std::size_t options, const std::size_t bonds) {
+            return sizeof(book_header) + option_columns * double_column_bytes(options) +
+                bond_double_columns * double_column_bytes(bonds) + round_up(bonds * sizeof(int));
+        }
+
+        const book_header& header_of(void* base) {
+            return *static_cast<const book_header*>(base);
+        }
+
+        std::byte* bytes_of(void* base) {
+            return static_cast<std::byte*>(base);
+        }
+
+        [[noreturn]] void throw_errno(const std::string& what) {
+            throw std::runtime_error(what + ": " + std::strerror(errno));
+        }
+
+        void* map_segment(const int fd, const std::size_t bytes) {
+            void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (base == MAP_FAILED) {
+                throw_errno("mmap");
+            }
+            return base;
+        }
+
+        // slices are whole cache lines of doubles so neighbouring workers never share a line
+        std::pair<std::size_t, std::size_t> worker_range(const std::size_t n,
+            const std::size_t workers,
+            const std::size_t worker) {
+            if (worker >= workers) {
+                throw std::invalid_argument("worker index out of range");
+            }
+            constexpr std::size_t line = cache_line / sizeof(double);
+            const std::size_t per = (n + workers - 1) / workers;
+            const std::size_t chunk = (per + line - 1) / line * line;
+            const std::size_t begin = std::min(n, worker * chunk);
+            return {begin, std::min(n, begin + chunk)};
+        }
+
+        // a write fault on every page of the span, keeping its contents
+        template <class T>
+        void touch(const std::span<T> values) {
+            const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            auto* bytes = reinterpret_cast<volatile std::byte*>(values.data());
+            for (std::size_t offset = 0; offset < values.size_bytes(); offset += page) {
+                bytes[offset] = bytes[offset];
+            }
+        }
+    } // namespace
+
+    shared_book::shared_book(std::string name, void* base, const std::size_t bytes) :
+        name_(std::move(name)), base_(base), bytes_(bytes) {}
+
+    shared_book shared_book::create(const std::string& name,
+        const std::size_t options,
+        const std::size_t bonds,
+        const std::size_t workers) {
+        if (workers == 0) {
+            throw std::invalid_argument("workers must be positive");
+        }
+
+        const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw_errno("shm_open " + name);
+        }
+
+        const auto bytes = segment_bytes(options, bonds);
+        if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            const int err = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            errno = err;
+            throw_errno("ftruncate " + name);
+        }
+
+        void* base = nullptr;
+        try {
+            base = map_segment(fd, bytes);
+        } catch (...) {
+            close(fd);
+            shm_unlink(name.c_str());
+            throw;
+        }
+        close(fd);
+
+        auto* header = static_cast<book_header*>(base);
+        header->version = book_version;
+        header->workers = static_cast<std::uint32_t>(workers);
+        header->options = options;
+        header->bonds = bonds;
+        header->bytes = bytes;
+        header->magic = book_magic;
+
+        return {name, base, bytes};
+    }
+
+    shared_book shared_book::attach(const std::string& name) {
+        const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd < 0) {
+            throw_errno("shm_open " + name);
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw_errno("fstat " + name);
+        }
+        const auto bytes = static_cast<std::size_t>(st.st_size);
+        if (bytes < sizeof(book_header)) {
+            close(fd);
+            throw std::runtime_error(name + " is not a pyfi book");
+        }
+
+        void* base = nullptr;
+        try {
+            base = map_segment(fd, bytes);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+
+        const auto& header = header_of(base);
+        if (header.magic != book_magic || header.version != book_version || header.bytes != bytes ||
+            segment_bytes(header.options, header.bonds) != bytes) {
+            munmap(base, bytes);
+            throw std::runtime_error(name + " is not a pyfi book");
+        }
+
+        return {name, base, bytes};
+    }
+
+    shared_book::shared_book(shared_book&& other) noexcept :
+        name_(std::move(other.name_)), base_(std::exchange(other.base_, nullptr)),
+        bytes_(std::exchange(other.bytes_, 0)) {}
+
+    shared_book& shared_book::operator=(shared_book&& other) noexcept {
+        if (this != &other) {
+            if (base_ != nullptr) {
+                munmap(base_, bytes_);
+            }
+            name_ = std::move(other.name_);
+            base_ = std::exchange(other.base_, nullptr);
+            bytes_ = std::exchange(other.bytes_, 0);
+        }
+        return *this;
+    }
+
+    shared_book::~shared_book() {
+        if (base_ != nullptr) {
+            munmap(base_, bytes_);
+        }
+    }
+
+    void shared_book::unlink() const {
+        if (shm_unlink(name_.c_str()) != 0 && errno != ENOENT) {
+            throw_errno("shm_unlink " + name_);
+        }
+    }
+
+    const std::string& shared_book::name() const {
+        return name_;
+    }
+
+    std::size_t shared_book::options() const {
+        return header_of(base_).options;
+    }
+
+    std::size_t shared_book::bonds() const {
+        return header_of(base_).bonds;
+    }
+
+    std::size_t shared_book::workers() const {
+        return header_of(base_).workers;
+    }
+
+    std::span<double> shared_book::column(const option_column column) const {
+        const auto n = options();
+        const auto offset = sizeof(book_header) + static_cast<std::size_t>(column) * double_column_bytes(n);
+        return {reinterpret_cast<double*>(bytes_of(base_) + offset), n};
+    }
+
+    std::span<double> shared_book::column(const bond_column column) const {
+        const auto n = bonds();
+        const auto offset = sizeof(book_header) + option_columns * double_column_bytes(options()) +
+            static_cast<std::size_t>(column) * double_column_bytes(n);
+        return {reinterpret_cast<double*>(bytes_of(base_) + offset), n};
+    }
+
+    std::span<int> shared_book::compounding() const {
+        const auto n = bonds();
+        const auto offset = sizeof(book_header) + option_columns * double_column_bytes(options()) +
+            bond_double_columns * double_column_bytes(n);
+        return {reinterpret_cast<int*>(bytes_of(base_) + offset), n};
+    }
+
+    option::option_batch shared_book::option_inputs() const {
+        return {column(option_column::stock_price),
+            column(option_column::strike_price),
+            column(option_column::volatility),
+            column(option_column::risk_free_rate),
+            column(option_column::time),
+            column(option_column::yield_curve)};
+    }
+
+    bond::bond_batch shared_book::bond_inputs() const {
+        return {column(bond_column::par_value),
+            column(bond_column::coupon_rate),
+            column(bond_column::annual_yield),
+            column(bond_column::years_to_maturity),
+            compounding()};
+    }
+
+    std::pair<std::size_t, std::size_t> shared_book::option_range(const std::size_t worker) const {
+        return worker_range(options(), workers(), worker);
+    }
+
+    std::pair<std::size_t, std::size_t> shared_book::bond_range(const std::size_t worker) const {
+        return worker_range(bonds(), workers(), worker);
+    }
+
+    void shared_book::advise(const memory::placement& placement) const {
+        memory::advise(base_, bytes_, placement);
+    }
+
+    void shared_book::first_touch(const std::size_t worker) const {
+        const auto [option_begin, option_end] = option_range(worker);
+        for (const auto c : {option_column::stock_price,
+                 option_column::strike_price,
+                 option_column::volatility,
+                 option_column::risk_free_rate,
+                 option_column::time,
+                 option_column::yield_curve,
+                 option_column::call,
+                 option_column::put}) {
+            touch(column(c).subspan(option_begin, option_end - option_begin));
+        }
+        const auto [bond_begin, bond_end] = bond_range(worker);
+        for (const auto c : {bond_column::par_value,
+                 bond_column::coupon_rate,
+                 bond_column::annual_yield,
+                 bond_column::years_to_maturity,
+                 bond_column::dirty_price,
+                 bond_column::clean_price}) {
+            touch(column(c).subspan(bond_begin, bond_end - bond_begin));
+        }
+        touch(compounding().subspan(bond_begin, bond_end - bond_begin));
+    }
+
+    void shared_book::price_options(const std::size_t worker) const {
+        const auto [begin, end] = option_range(worker);
+        const auto count = end - begin;
+        const trace::span span("book.price_options", "pricing", count);
+        const auto batch = option_inputs().slice(begin, count);
+
+        option::black_scholes_call_batch(batch, column(option_column::call).subspan(begin, count));
+        option::black_scholes_put_batch(batch, column(option_column::put).subspan(begin, count));
+    }
+
+    void shared_book::price_bonds(const std::size_t worker) const {
+        const auto [begin, end] = bond_range(worker);
+        const auto count = end - begin;
+        const trace::span span("book.price_bonds", "pricing", count);
+        const auto batch = bond_inputs().slice(begin, count);
+
+        bond::dirty_coupon_price_from_T_batch(batch, column(bond_column::dirty_price).subspan(begin, count));
+        bond::clean_coupon_price_from_T_batch(batch, column(bond_column::clean_price).subspan(begin, count));
+    }
+
+} // namespace pyfi::book
@@ -0,0 +1,291 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/bump.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace pyfi::bump {
+
+    namespace {
+        // owned columns for a batch of scenarios built from the contracts
+        struct scenario_set {
+            std::vector<double> stock_price;
+            std::vector<double> strike_price;
+            std::vector<double> volatility;
+            std::vector<double> risk_free_rate;
+            std::vector<double> time;
+            std::vector<double> yield_curve;
+
+            explicit scenario_set(const std::size_t n) :
+                stock_price(n), strike_price(n), volatility(n), risk_free_rate(n), time(n), yield_curve(n) {}
+
+            void set(const std::size_t row,
+                const double S,
+                const double K,
+                const double sigma,
+                const double r,
+                const double T,
+                const double q) {
+                stock_price[row] = S;
+                strike_price[row] = K;
+                volatility[row] = sigma;
+                risk_free_rate[row] = r;
+                time[row] = T;
+                yield_curve[row] = q;
+            }
+
+            [[nodiscard]] option::option_batch view() const {
+                return {stock_price, strike_price, volatility, risk_free_rate, time, yield_curve};
+            }
+        };
+
+        std::size_t checked_size(const option::option_batch& contracts, const std::span<greeks> out) {
+            const auto n = contracts.size();
+            if (out.size() != n) {
+                throw std::invalid_argument("output size must match the batch size");
+            }
+            return n;
+        }
+
+        // Rolls n CRR lattices back together. Values are stored node major, [node * n + row], so every step of the
+        // induction is a contiguous sweep over the rows. If today is not empty it receives the three node values of
+        // level 2, laid out the same way.
+        template <bool American>
+        void roll_back(const option::option_batch& rows,
+            const option::option_type type,
+            const int steps,
+            const std::span<double> root,
+            const std::span<double> today) {
+            const auto n = rows.size();
+            const double sign = type == option::option_type::call ? 1.0 : -1.0;
+
+            std::vector<double> up(n);
+            std::vector<double> fair_prob(n);
+            std::vector<double> discount(n);
+            for (std::size_t s = 0; s < n; ++s) {
+                const double sigma = rows.volatility[s];
+                const double T = rows.time[s];
+                if (sigma < 1e-9 || T < 1e-9) {
+                    throw std::invalid_argument("Time or volatility cannot be zero");
+                }
+                const double dt = T / steps;
+                up[s] = std::exp(sigma * std::sqrt(dt));
+                const double down = 1.0 / up[s];
+                fair_prob[s] = (std::exp((rows.risk_free_rate[s] - rows.yield_curve[s]) * dt) - down) / (up[s] - down);
+                discount[s] = std::exp(-rows.risk_free_rate[s] * dt);
+            }
+
+            const auto nodes = static_cast<std::size_t>(steps) + 1;
+            std::vector<double> values(nodes * n);
+            std::vector<double> spot(American ? nodes * n : 0);
+            for (std::size_t j = 0; j < nodes; ++j) {
+                for (std::size_t s = 0; s < n; ++s) {
+                    const double S = rows.stock_price[s] * std::pow(up[s], 2.0 * static_cast<double>(j) - steps);
+                    values[j * n + s] = std::max(sign * (S - rows.strike_price[s]), 0.0);
+                    if constexpr (American) {
+                        spot[j * n + s] = S;
+                    }
+                }
+            }
+
+            for (int i = steps - 1; i >= 0; --i) {
+                for (std::size_t j = 0; j <= static_cast<std::size_t>(i); ++j) {
+                    double* value = values.data() + j * n;
+                    const double* value_up = value + n;
+                    for (std::size_t s = 0; s < n; ++s) {
+                        double v = discount[s] * (fair_prob[s] * value_up[s] + (1.0 - fair_prob[s]) * value[s]);
+                        if constexpr (American) {
+                            // S(i, j) = S(i + 1, j) * u since d = 1 / u
+                            double& S = spot[j * n + s];
+                            S *= up[s];
+                            v = std::max(v, sign * (S - rows.strike_price[s]));
+                        }
+                        value[s] = v;
+                    }
+                }
+                if (i == 2 && !today.empty()) {
+                    std::copy_n(values.begin(), 3 * n, today.begin());
+                }
+            }
+            std::copy_n(values.begin(), n, root.begin());
+        }
+
+        void roll_back(const option::option_batch& rows,
+            const option::option_type type,
+            const bool american,
+            const int steps,
+            const std::span<double> root,
+            const std::span<double> today = {}) {
+            if (american) {
+                roll_back<true>(rows, type, steps, root, today);
+            } else {
+                roll_back<false>(rows, type, steps, root, today);
+            }
+        }
+    } // namespace
+
+    void bump_and_reprice(const option::option_batch& contracts,
+        const scenario_pricer& pricer,
+        std::span<greeks> out,
+        const bump_sizes& bumps) {
+        const auto n = checked_size(contracts, out);
+        const profile::scope scope("risk.bump_and_reprice", n);
+        const trace::span span("risk.bump_and_reprice", "greeks", n);
+        if (n == 0) {
+            return;
+        }
+
+        // scenario k of contract i sits at row k * n + i, so each scenario kind is a contiguous block
+        enum { base, spot_up, spot_down, vol_up, vol_down, rate_up, rate_down, time_up, time_down, kinds };
+        scenario_set scenarios(kinds * n);
+        std::vector<double> vol_bump(n);
+        std::vector<double> time_bump(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const double S = contracts.stock_price[i];
+            const double K = contracts.strike_price[i];
+            const double sigma = contracts.volatility[i];
+            const double r = contracts.risk_free_rate[i];
+            const double T = contracts.time[i];
+            const double q = contracts.yield_curve[i];
+            const double hs = bumps.spot * S;
+            vol_bump[i] = std::min(bumps.volatility, 0.5 * sigma);
+            time_bump[i] = std::min(bumps.time, 0.5 * T);
+
+            scenarios.set(base * n + i, S, K, sigma, r, T, q);
+            scenarios.set(spot_up * n + i, S + hs, K, sigma, r, T, q);
+            scenarios.set(spot_down * n + i, S - hs, K, sigma, r, T, q);
+            scenarios.set(vol_up * n + i, S, K, sigma + vol_bump[i], r, T, q);
+            scenarios.set(vol_down * n + i, S, K, sigma - vol_bump[i], r, T, q);
+            scenarios.set(rate_up * n + i, S, K, sigma, r + bumps.rate, T, q);
+            scenarios.set(rate_down * n + i, S, K, sigma, r - bumps.rate, T, q);
+            scenarios.set(time_up * n + i, S, K, sigma, r, T + time_bump[i], q);
+            scenarios.set(time_down * n + i, S, K, sigma, r, T - time_bump[i], q);
+        }
+
+        std::vector<double> prices(kinds * n);
+        pricer(scenarios.view(), prices);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto at = [&](const int kind) { return prices[kind * n + i]; };
+            const double hs = bumps.spot * contracts.stock_price[i];
+            out[i] = {at(base),
+                (at(spot_up) - at(spot_down)) / (2.0 * hs),
+                (at(spot_up) - 2.0 * at(base) + at(spot_down)) / (hs * hs),
+                (at(vol_up) - at(vol_down)) / (2.0 * vol_bump[i]),
+                -(at(time_up) - at(time_down)) / (2.0 * time_bump[i]),
+                (at(rate_up) - at(rate_down)) / (2.0 * bumps.rate)};
+        }
+    }
+
+    scenario_pricer black_scholes_pricer(const option::option_type type, const memory::access_hints& hints) {
+        return [=](const option::option_batch& scenarios, const std::span<double> out) {
+            if (type == option::option_type::call) {
+                option::black_scholes_call_batch(scenarios, out, hints);
+            } else {
+                option::black_scholes_put_batch(scenarios, out, hints);
+            }
+        };
+    }
+
+    scenario_pricer binomial_pricer(const option::option_type type, const bool american, const int steps) {
+        if (steps < 1) {
+            throw std::invalid_argument("steps must be positive");
+        }
+        return [=](const option::option_batch& scenarios, const std::span<double> out) {
+            if (out.size() != scenarios.size()) {
+                throw std::invalid_argument("output size must match the batch size");
+            }
+            roll_back(scenarios, type, american, steps, out);
+        };
+    }
+
+    scenario_pricer monte_carlo_pricer(const option::option_type type,
+        const monte_carlo::payoff_style style,
+        const monte_carlo::mc_config& config) {
+        return [=](const option::option_batch& scenarios, const std::span<double> out) {
+            monte_carlo::price_batch(scenarios, type, style, config, out);
+        };
+    }
+
+    void binomial_greeks(const option::option_batch& contracts,
+        const option::option_type type,
+        const bool american,
+        const int steps,
+        std::span<greeks> out,
+        const bump_sizes& bumps) {
+        const auto n = checked_size(contracts, out);
+        const profile::scope scope("risk.binomial_greeks", n);
+        const trace::span span("risk.binomial_greeks", "greeks", n);
+        if (steps < 1) {
+            throw std::invalid_argument("steps must be positive");
+        }
+        if (n == 0) {
+            return;
+        }
+
+        // the base tree, extended two steps into the past: same dt, so the level 2 nodes are today's spot and the
+        // spots one up-down step either side of it
+        scenario_set extended(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const double T = contracts.time[i];
+            extended.set(i,
+                contracts.stock_price[i],
+                contracts.strike_price[i],
+                contracts.volatility[i],
+                contracts.risk_free_rate[i],
+                T + 2.0 * T / steps,
+                contracts.yield_curve[i]);
+        }
+        std::vector<double> root(n);
+        std::vector<double> today(3 * n);
+        roll_back(extended.view(), type, american, steps + 2, root, today);
+
+        enum { vol_up, vol_down, rate_up, rate_down, kinds };
+        scenario_set bumped(kinds * n);
+        std::vector<double> vol_bump(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const double S = contracts.stock_price[i];
+            const double K = contracts.strike_price[i];
+            const double sigma = contracts.volatility[i];
+            const double r = contracts.risk_free_rate[i];
+            const double T = contracts.time[i];
+            const double q = contracts.yield_curve[i];
+            vol_bump[i] = std::min(bumps.volatility, 0.5 * sigma);
+            bumped.set(vol_up * n + i, S, K, sigma + vol_bump[i], r, T, q);
+            bumped.set(vol_down * n + i, S, K, sigma - vol_bump[i], r, T, q);
+            bumped.set(rate_up * n + i, S, K, sigma, r + bumps.rate, T, q);
+            bumped.set(rate_down * n + i, S, K, sigma, r - bumps.rate, T, q);
+        }
+        std::vector<double> prices(kinds * n);
+        roll_back(bumped.view(), type, american, steps, prices);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const double S = contracts.stock_price[i];
+            const double dt = contracts.time[i] / steps;
+            const double u2 = std::exp(2.0 * contracts.volatility[i] * std::sqrt(dt));
+            const double s_up = S * u2;
+            const double s_down = S / u2;
+            const double v_down = today[i];
+            const double v_mid = today[n + i];
+            const double v_up = today[2 * n + i];
+
+            const double delta_up = (v_up - v_mid) / (s_up - S);
+            const double delta_down = (v_mid - v_down) / (S - s_down);
+            const auto at = [&](const int kind) { return prices[kind * n + i]; };
+            out[i] = {v_mid,
+                (v_up - v_down) / (s_up - s_down),
+                (delta_up - delta_down) / (0.5 * (s_up - s_down)),
+                (at(vol_up) - at(vol_down)) / (2.0 * vol_bump[i]),
+                (v_mid - root[i]) / (2.0 * dt),
+                (at(rate_up) - at(rate_down)) / (2.0 * bumps.rate)};
+        }
+    }
+
+} // namespace pyfi::bump
@@ -0,0 +1,140 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/convertible.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <pyfi/option.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+namespace pyfi::convertible {
+
+    namespace {
+        // [t - half_step, t + half_step) meets [start, end]
+        bool active(const provision& p, const double t, const double half_step) {
+            return p.start < t + half_step && p.end >= t - half_step;
+        }
+
+        // the terminal column of the lattice is the stock price itself
+        void stock_payoff(std::vector<double>&, double) {}
+    } // namespace
+
+    convertible_result price(const convertible_bond& bond, const market_data& market, const int steps) {
+        if (steps < 2) {
+            throw std::invalid_argument("steps must be at least 2");
+        }
+        if (!(bond.maturity > 0.0) || !(market.volatility > 0.0) || !(market.stock_price > 0.0)) {
+            throw std::invalid_argument("maturity, volatility and stock price must be positive");
+        }
+        if (bond.m <= 0) {
+            throw std::invalid_argument("m must be positive");
+        }
+        if (bond.conversion_ratio < 0.0) {
+            throw std::invalid_argument("conversion ratio cannot be negative");
+        }
+        const profile::scope scope("convertible.price", static_cast<std::size_t>(steps));
+        const trace::span span("convertible.price", "pricing", static_cast<std::size_t>(steps));
+
+        const double dt = bond.maturity / steps;
+        const double u = std::exp(market.volatility * std::sqrt(dt));
+        const double d = 1.0 / u;
+        const double p = (std::exp((market.risk_free_rate - market.yield_curve) * dt) - d) / (u - d);
+        if (!(p > 0.0 && p < 1.0)) {
+            throw std::invalid_argument("the lattice has no risk neutral probability, use more steps");
+        }
+        const double riskless = std::exp(-market.risk_free_rate * dt);
+        const double risky = std::exp(-(market.risk_free_rate + market.credit_spread) * dt);
+
+        // coupon j of the dirty_coupon_price_from_T schedule is paid at maturity - j / m, on the nearest step
+        const double coupon = bond.par_value * (bond.coupon_rate / static_cast<double>(bond.m));
+        const int coupons = static_cast<int>(std::ceil(bond.maturity * bond.m));
+        const auto coupon_step = [&](const int j) {
+            return static_cast<int>(std::lround((bond.maturity - static_cast<double>(j) / bond.m) / dt));
+        };
+        int next_coupon = 1; // coupon 0 is paid with the redemption
+
+        // the rolling columns: stock prices from the lattice, total value, its cash part and the bond floor
+        auto stock = option::binomial_tree_setup(market.stock_price, 0.0, market.volatility, steps, bond.maturity,
+            &stock_payoff);
+        std::vector<double> value(steps + 1), cash(steps + 1), floor(steps + 1, bond.par_value + coupon);
+        for (int j = 0; j <= steps; ++j) {
+            const double conversion = bond.conversion_ratio * stock[j];
+            const double redemption = bond.par_value + coupon;
+            value[j] = std::max(conversion, redemption);
+            cash[j] = conversion > redemption ? 0.0 : redemption;
+        }
+
+        // the first two columns, kept for delta and gamma
+        std::array<double, 3> value_two{}, stock_two{};
+        std::array<double, 2> value_one{}, stock_one{};
+        for (int i = steps - 1; i >= 0; --i) {
+            const double t = i * dt;
+            double call = std::numeric_limits<double>::infinity();
+            double put = -std::numeric_limits<double>::infinity();
+            for (const auto& c : bond.calls) {
+                if (active(c, t, 0.5 * dt)) {
+                    call = std::min(call, c.price);
+                }
+            }
+            for (const auto& h : bond.puts) {
+                if (active(h, t, 0.5 * dt)) {
+                    put = std::max(put, h.price);
+                }
+            }
+            double paid = 0.0;
+            for (; next_coupon < coupons && coupon_step(next_coupon) >= i; ++next_coupon) {
+                paid += coupon;
+            }
+
+            for (int j = 0; j <= i; ++j) {
+                const double equity = riskless * (p * (value[j + 1] - cash[j + 1]) + (1.0 - p) * (value[j] - cash[j]));
+                double debt = risky * (p * cash[j + 1] + (1.0 - p) * cash[j]);
+                floor[j] = risky * (p * floor[j + 1] + (1.0 - p) * floor[j]) + paid;
+                stock[j] *= u; // S0 u^j d^(i - j) from S0 u^j d^(i + 1 - j)
+
+                double v = equity + debt;
+                const double conversion = bond.conversion_ratio * stock[j];
+                if (v > call) {
+                    v = std::max(call, conversion);
+                    debt = conversion >= call ? 0.0 : call;
+                }
+                if (v < put) {
+                    v = put;
+                    debt = put;
+                }
+                if (conversion > v) {
+                    v = conversion;
+                    debt = 0.0;
+                }
+                value[j] = v + paid;
+                cash[j] = debt + paid;
+            }
+
+            if (i == 2) {
+                std::copy_n(value.begin(), 3, value_two.begin());
+                std::copy_n(stock.begin(), 3, stock_two.begin());
+            } else if (i == 1) {
+                std::copy_n(value.begin(), 2, value_one.begin());
+                std::copy_n(stock.begin(), 2, stock_one.begin());
+            }
+        }
+
+        const double delta_up = (value_two[2] - value_two[1]) / (stock_two[2] - stock_two[1]);
+        const double delta_down = (value_two[1] - value_two[0]) / (stock_two[1] - stock_two[0]);
+        return {value[0],
+            value[0] - cash[0],
+            cash[0],
+            floor[0],
+            bond.conversion_ratio * market.stock_price,
+            (value_one[1] - value_one[0]) / (stock_one[1] - stock_one[0]),
+            (delta_up - delta_down) / (0.5 * (stock_two[2] - stock_two[0]))};
+    }
+
+} // namespace pyfi::convertible
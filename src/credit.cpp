@@ -0,0 +1,369 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/credit.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+namespace pyfi::credit {
+
+    namespace {
+        constexpr std::size_t rows_per_chunk = 512;
+
+        void check_recovery(const double recovery) {
+            if (!(recovery >= 0.0 && recovery < 1.0)) {
+                throw std::invalid_argument("recovery must be in [0, 1)");
+            }
+        }
+
+        void check_schedule(const double maturity, const int m) {
+            if (m <= 0) {
+                throw std::invalid_argument("m must be positive");
+            }
+            if (!(maturity > 0.0)) {
+                throw std::invalid_argument("maturity must be positive");
+            }
+        }
+
+        // dates maturity - j / m in time order: date k of n is maturity - (n - 1 - k) / m
+        int date_count(const double maturity, const int m) {
+            return static_cast<int>(std::ceil(maturity * static_cast<double>(m)));
+        }
+
+        double date(const double maturity, const int m, const int n, const int k) {
+            return maturity - static_cast<double>(n - 1 - k) / m;
+        }
+
+        // the first count pillars of a hazard curve and the integral of the hazard to each
+        struct hazard_nodes {
+            const std::vector<double>& times;
+            const std::vector<double>& hazards;
+            const std::vector<double>& cumulative;
+            std::size_t count;
+        };
+
+        std::vector<double> cumulative_hazards(const std::vector<double>& times, const std::vector<double>& hazards) {
+            std::vector<double> cumulative(times.size());
+            for (std::size_t i = 0; i < times.size(); ++i) {
+                const double before = i == 0 ? 0.0 : times[i - 1];
+                cumulative[i] = (i == 0 ? 0.0 : cumulative[i - 1]) + hazards[i] * (times[i] - before);
+            }
+            return cumulative;
+        }
+
+        // the pillar whose interval (times[i - 1], times[i]] holds t, the last one past the end
+        std::size_t segment(const hazard_nodes& h, const double t) {
+            const auto end = h.times.begin() + static_cast<std::ptrdiff_t>(h.count);
+            const auto at = std::lower_bound(h.times.begin(), end, t);
+            return at == end ? h.count - 1 : static_cast<std::size_t>(at - h.times.begin());
+        }
+
+        double survival(const hazard_nodes& h, const double t) {
+            if (!(t > 0.0)) {
+                return 1.0;
+            }
+            const auto i = segment(h, t);
+            const double before = i == 0 ? 0.0 : h.times[i - 1];
+            const double base = i == 0 ? 0.0 : h.cumulative[i - 1];
+            return std::exp(-(base + h.hazards[i] * (t - before)));
+        }
+
+        // the next knot of either curve after t, or end
+        double next_knot(const std::vector<double>& zero_times,
+            const hazard_nodes& h,
+            const double t,
+            const double end) {
+            double knot = end;
+            const auto zero = std::upper_bound(zero_times.begin(), zero_times.end(), t);
+            if (zero != zero_times.end()) {
+                knot = std::min(knot, *zero);
+            }
+            const auto hazard_end = h.times.begin() + static_cast<std::ptrdiff_t>(h.count);
+            const auto hazard = std::upper_bound(h.times.begin(), hazard_end, t);
+            if (hazard != hazard_end) {
+                knot = std::min(knot, *hazard);
+            }
+            return knot;
+        }
+
+        // integrals over the premium periods of default at time t, discounted, and of (t - period start) with it
+        struct legs {
+            double annuity = 0.0; // sum of accrual D S at each date plus the accrual paid on default
+            double default_value = 0.0; // integral of D(t) dPD(t), the protection per unit of loss
+        };
+
+        /*
+         * The periods [from, to) of the dates of (maturity, m), the first starting today. Between knots D(t) S(t)
+         * decays at a constant c = forward + hazard, so with L the piece's length and u the time into it
+         *
+         *   integral of hazard D S du = hazard D S(a) (1 - exp(-c L)) / c
+         *   integral of hazard u D S du = hazard D S(a) (1 - exp(-c L) (1 + c L)) / c^2
+         *
+         * with their series where c L is small.
+         */
+        legs period_legs(const curve::zero_curve& discount,
+            const hazard_nodes& h,
+            const double maturity,
+            const int m,
+            const int from,
+            const int to) {
+            const int n = date_count(maturity, m);
+            const auto& zero_times = discount.times();
+            legs out;
+            for (int k = from; k < to; ++k) {
+                const double start = k == 0 ? 0.0 : date(maturity, m, n, k - 1);
+                const double end = date(maturity, m, n, k);
+                double a = start;
+                double value_a = discount.discount(a) * survival(h, a);
+                while (a < end) {
+                    const double b = next_knot(zero_times, h, a, end);
+                    const double value_b = discount.discount(b) * survival(h, b);
+                    const double L = b - a;
+                    const double hazard = h.hazards[segment(h, 0.5 * (a + b))];
+                    const double cL = std::log(value_a / value_b);
+                    double first;
+                    double second;
+                    if (std::abs(cL) < 1e-4) {
+                        first = L * (1.0 - cL / 2.0 + cL * cL / 6.0);
+                        second = L * L * (0.5 - cL / 3.0 + cL * cL / 8.0);
+                    } else {
+                        const double c = cL / L;
+                        first = -std::expm1(-cL) / c;
+                        second = (-std::expm1(-cL) - cL * std::exp(-cL)) / (c * c);
+                    }
+                    out.default_value += hazard * value_a * first;
+                    out.annuity += hazard * value_a * ((a - start) * first + second);
+                    a = b;
+                    value_a = value_b;
+                }
+                out.annuity += (end - start) * value_a;
+            }
+            return out;
+        }
+
+        /*
+         * The batch a chunk at a time: the risky yields of the chunk, the government bond kernel on them into a price
+         * buffer, and the recovery leg added on the way to out, so out is written once, streaming or not.
+         */
+        template <bool Streaming>
+        void risky_chunks(const bond::bond_batch& batch,
+            const std::span<const double> hazard_rate,
+            const std::span<const double> recovery,
+            const std::span<double> out,
+            const memory::access_hints& hints) {
+            const memory::access_hints kernel{hints.prefetch_distance, false, hints.lanes};
+            std::array<double, rows_per_chunk> yield{};
+            std::array<double, rows_per_chunk> price{};
+            const auto n = out.size();
+            for (std::size_t offset = 0; offset < n; offset += rows_per_chunk) {
+                const auto count = std::min(rows_per_chunk, n - offset);
+                for (std::size_t k = 0; k < count; ++k) {
+                    const auto i = offset + k;
+                    if (batch.m[i] <= 0) {
+                        throw std::invalid_argument("m must be positive");
+                    }
+                    if (!(hazard_rate[i] >= 0.0)) {
+                        throw std::invalid_argument("hazard rates cannot be negative");
+                    }
+                    check_recovery(recovery[i]);
+                    const double m = batch.m[i];
+                    const double r = batch.annual_yield[i] / m;
+                    yield[k] = m * ((1.0 + r) * std::expm1(hazard_rate[i] / m) + r);
+                }
+
+                auto chunk = batch.slice(offset, count);
+                chunk.annual_yield = std::span<const double>(yield.data(), count);
+                bond::dirty_coupon_price_from_T_batch(chunk, std::span<double>(price.data(), count), kernel);
+
+                for (std::size_t k = 0; k < count; ++k) {
+                    const auto i = offset + k;
+                    const double m = batch.m[i];
+                    const double lambda = hazard_rate[i];
+                    const double T = batch.years_to_maturity[i];
+                    const double x = (m * std::log1p(batch.annual_yield[i] / m) + lambda) * T;
+                    const double default_value = lambda * T * (std::abs(x) < 1e-12 ? 1.0 : -std::expm1(-x) / x);
+                    memory::store<Streaming>(
+                        &out[i], price[k] + recovery[i] * batch.par_value[i] * default_value);
+                }
+            }
+        }
+    } // namespace
+
+    hazard_curve::hazard_curve(std::vector<double> times, std::vector<double> hazards) :
+        times_(std::move(times)), hazards_(std::move(hazards)) {
+        if (times_.empty() || times_.size() != hazards_.size()) {
+            throw std::invalid_argument("a hazard curve needs one hazard per pillar and at least one pillar");
+        }
+        for (std::size_t i = 0; i < times_.size(); ++i) {
+            if (!(times_[i] > (i == 0 ? 0.0 : times_[i - 1]))) {
+                throw std::invalid_argument("pillar times must be positive and increasing");
+            }
+            if (!(hazards_[i] >= 0.0)) {
+                throw std::invalid_argument("hazard rates cannot be negative");
+            }
+        }
+        cumulative_ = cumulative_hazards(times_, hazards_);
+    }
+
+    double hazard_curve::hazard(const double time) const {
+        return hazards_[segment({times_, hazards_, cumulative_, times_.size()}, time)];
+    }
+
+    double hazard_curve::survival(const double time) const {
+        return credit::survival({times_, hazards_, cumulative_, times_.size()}, time);
+    }
+
+    const std::vector<double>& hazard_curve::times() const {
+        return times_;
+    }
+
+    const std::vector<double>& hazard_curve::hazards() const {
+        return hazards_;
+    }
+
+    cds_value price_cds(const curve::zero_curve& discount,
+        const hazard_curve& hazard,
+        const cds& contract,
+        const double recovery) {
+        check_schedule(contract.maturity, contract.m);
+        check_recovery(recovery);
+        const profile::scope scope("credit.price_cds");
+        const trace::span span("credit.price_cds", "credit");
+
+        const auto cumulative = cumulative_hazards(hazard.times(), hazard.hazards());
+        const hazard_nodes h{hazard.times(), hazard.hazards(), cumulative, cumulative.size()};
+        const auto l =
+            period_legs(discount, h, contract.maturity, contract.m, 0, date_count(contract.maturity, contract.m));
+
+        const double protection = (1.0 - recovery) * l.default_value;
+        const double premium = contract.spread * l.annuity;
+        return {premium, protection, l.annuity, protection - premium, protection / l.annuity};
+    }
+
+    hazard_curve bootstrap(const curve::zero_curve& discount,
+        const std::span<const cds> quotes,
+        const double recovery) {
+        const auto n = quotes.size();
+        if (n == 0) {
+            throw std::invalid_argument("bootstrap needs at least one quote");
+        }
+        check_recovery(recovery);
+        const profile::scope scope("credit.bootstrap", n);
+        const trace::span span("credit.bootstrap", "credit", n);
+
+        std::vector<double> times(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            check_schedule(quotes[i].maturity, quotes[i].m);
+            if (i > 0 && !(quotes[i].maturity > quotes[i - 1].maturity)) {
+                throw std::invalid_argument("quote maturities must be increasing");
+            }
+            times[i] = quotes[i].maturity;
+        }
+
+        std::vector<double> hazards(n, 0.0);
+        std::vector<double> cumulative(n, 0.0);
+        for (std::size_t k = 0; k < n; ++k) {
+            const auto& quote = quotes[k];
+            const double previous = k == 0 ? 0.0 : times[k - 1];
+            const double base = k == 0 ? 0.0 : cumulative[k - 1];
+            const hazard_nodes h{times, hazards, cumulative, k + 1};
+            const auto set = [&](const double hazard) {
+                hazards[k] = hazard;
+                cumulative[k] = base + hazard * (quote.maturity - previous);
+            };
+
+            // periods ending by the previous pillar only see the hazards already solved for
+            const int dates = date_count(quote.maturity, quote.m);
+            int fixed = 0;
+            while (fixed < dates && date(quote.maturity, quote.m, dates, fixed) <= previous + 1e-12) {
+                ++fixed;
+            }
+            const auto before = period_legs(discount, h, quote.maturity, quote.m, 0, fixed);
+            const auto pv = [&](const double hazard) {
+                set(hazard);
+                const auto after = period_legs(discount, h, quote.maturity, quote.m, fixed, dates);
+                return (1.0 - recovery) * (before.default_value + after.default_value) -
+                    quote.spread * (before.annuity + after.annuity);
+            };
+
+            // secant from the credit triangle spread = hazard (1 - recovery)
+            double x0 = quote.spread / (1.0 - recovery);
+            double x1 = x0 * 1.01 + 1e-6;
+            double f0 = pv(x0);
+            bool solved = f0 == 0.0;
+            double x = x0;
+            for (int iteration = 0; iteration < 100 && !solved; ++iteration) {
+                const double f1 = pv(x1);
+                const double step = f1 * (x1 - x0) / (f1 - f0);
+                if (!std::isfinite(step)) {
+                    break;
+                }
+                x0 = x1;
+                f0 = f1;
+                x1 -= step;
+                x = x1;
+                solved = std::abs(step) < 1e-15 || std::abs(f1) < 1e-16;
+            }
+            if (!solved || x < 0.0) {
+                throw std::invalid_argument("bootstrap failed at maturity " + std::to_string(quote.maturity));
+            }
+            set(x);
+        }
+        return {std::move(times), std::move(hazards)};
+    }
+
+    double risky_bond_price(const curve::zero_curve& discount,
+        const hazard_curve& hazard,
+        const double par_value,
+        const double coupon_rate,
+        const double years_to_maturity,
+        const int m,
+        const double recovery) {
+        check_schedule(years_to_maturity, m);
+        check_recovery(recovery);
+        const profile::scope scope("credit.risky_bond_price");
+        const trace::span span("credit.risky_bond_price", "credit");
+
+        const auto cumulative = cumulative_hazards(hazard.times(), hazard.hazards());
+        const hazard_nodes h{hazard.times(), hazard.hazards(), cumulative, cumulative.size()};
+
+        const int n = date_count(years_to_maturity, m);
+        const double coupon = par_value * (coupon_rate / static_cast<double>(m));
+        double price = 0.0;
+        for (int k = 0; k < n; ++k) {
+            const double t = date(years_to_maturity, m, n, k);
+            price += (k == n - 1 ? par_value + coupon : coupon) * discount.discount(t) * survival(h, t);
+        }
+        return price + recovery * par_value * period_legs(discount, h, years_to_maturity, m, 0, n).default_value;
+    }
+
+    void risky_dirty_price_batch(const bond::bond_batch& batch,
+        const std::span<const double> hazard_rate,
+        const std::span<const double> recovery,
+        const std::span<double> out,
+        const memory::access_hints& hints) {
+        const auto n = batch.size();
+        if (hazard_rate.size() != n || recovery.size() != n || out.size() != n) {
+            throw std::invalid_argument("hazard, recovery and output sizes must match the batch size");
+        }
+        const profile::scope scope("credit.risky_dirty_price_batch", n);
+        const trace::span span("credit.risky_dirty_price_batch", "pricing", n);
+
+        if (hints.streaming_stores) {
+            const memory::fence_guard fence;
+            risky_chunks<true>(batch, hazard_rate, recovery, out, hints);
+        } else {
+            risky_chunks<false>(batch, hazard_rate, recovery, out, hints);
+        }
+    }
+
+} // namespace pyfi::credit
@@ -0,0 +1,353 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/csv.h>
+#include <pyfi/trace.h>
+
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pyfi::csv {
+
+    namespace {
+        constexpr std::size_t block_bytes = 1 << 20;
+        constexpr std::size_t lane = 64;
+
+        // bit i is set when p[i] is the delimiter, a newline or a quote
+        std::uint64_t separator_mask(const char* p, const std::size_t n, const char delimiter) {
+#if defined(__SSE2__)
+            if (n == lane) {
+                const __m128i delim = _mm_set1_epi8(delimiter);
+                const __m128i newline = _mm_set1_epi8('\n');
+                const __m128i quote = _mm_set1_epi8('"');
+                std::uint64_t mask = 0;
+                for (std::size_t k = 0; k < lane; k += 16) {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + k));
+                    const __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, delim), _mm_cmpeq_epi8(v, newline)),
+                        _mm_cmpeq_epi8(v, quote));
+                    mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(hit))) << k;
+                }
+                return mask;
+            }
+#endif
+            std::uint64_t mask = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const char c = p[i];
+                if (c == delimiter || c == '\n' || c == '"') {
+                    mask |= std::uint64_t{1} << i;
+                }
+            }
+            return mask;
+        }
+
+        // walks the separators of [begin, end) in order, one 64 byte mask at a time
+        class scanner {
+        public:
+            scanner(const char* begin, const char* end, const char delimiter) :
+                block_(begin), end_(end), delimiter_(delimiter) {
+                load();
+            }
+
+            const char* next() {
+                while (mask_ == 0) {
+                    block_ += lane;
+                    if (block_ >= end_) {
+                        return end_;
+                    }
+                    load();
+                }
+                const auto bit = std::countr_zero(mask_);
+                mask_ &= mask_ - 1;
+                return block_ + bit;
+            }
+
+        private:
+            void load() {
+                const auto left = static_cast<std::size_t>(end_ - block_);
+                mask_ = block_ < end_ ? separator_mask(block_, left < lane ? left : lane, delimiter_) : 0;
+            }
+
+            const char* block_;
+            const char* end_;
+            char delimiter_;
+            std::uint64_t mask_ = 0;
+        };
+
+        std::string_view trim(const char* begin, const char* end) {
+            while (begin < end && (*begin == ' ' || *begin == '\t')) {
+                ++begin;
+            }
+            while (end > begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) {
+                --end;
+            }
+            return {begin, static_cast<std::size_t>(end - begin)};
+        }
+    } // namespace
+
+    reader::reader(std::FILE* from, std::vector<column_spec> columns, const char delimiter) :
+        from_(from), columns_(std::move(columns)), delimiter_(delimiter) {
+        if (columns_.empty()) {
+            throw std::invalid_argument("no columns requested");
+        }
+        slot_.resize(columns_.size());
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            for (std::size_t other = 0; other < c; ++other) {
+                if (columns_[other].name == columns_[c].name) {
+                    throw std::invalid_argument("column " + columns_[c].name + " requested twice");
+                }
+            }
+            if (columns_[c].type == column_type::real) {
+                slot_[c] = reals_.size();
+                reals_.emplace_back();
+            } else {
+                slot_[c] = integers_.size();
+                integers_.emplace_back();
+            }
+        }
+        seen_.assign(columns_.size(), 0);
+    }
+
+    std::size_t reader::read(const std::size_t max_rows) {
+        const trace::span span("csv.read", "parsing");
+        for (auto& column : reals_) {
+            column.clear();
+        }
+        for (auto& column : integers_) {
+            column.clear();
+        }
+        rows_ = 0;
+
+        while (rows_ < max_rows) {
+            const char* data = buffer_.data();
+            auto complete = buffer_.size();
+            if (!eof_) {
+                // only whole lines are parsed until the input is exhausted
+                while (complete > offset_ && data[complete - 1] != '\n') {
+                    --complete;
+                }
+            }
+            if (complete > offset_) {
+                offset_ += parse(data + offset_, data + complete, max_rows - rows_);
+                continue;
+            }
+            if (eof_) {
+                break;
+            }
+            refill(); // at end of input the unterminated last line is parsed on the next pass
+        }
+        return rows_;
+    }
+
+    std::span<const double> reader::real(const std::size_t column) const {
+        if (column >= columns_.size() || columns_[column].type != column_type::real) {
+            throw std::invalid_argument("not a real column");
+        }
+        return reals_[slot_[column]];
+    }
+
+    std::span<const int> reader::integer(const std::size_t column) const {
+        if (column >= columns_.size() || columns_[column].type != column_type::integer) {
+            throw std::invalid_argument("not an integer column");
+        }
+        return integers_[slot_[column]];
+    }
+
+    std::size_t reader::bytes() const {
+        return bytes_;
+    }
+
+    bool reader::refill() {
+        buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(offset_));
+        offset_ = 0;
+        const auto old = buffer_.size();
+        buffer_.resize(old + block_bytes);
+        const auto got = std::fread(buffer_.data() + old, 1, block_bytes, from_);
+        buffer_.resize(old + got);
+        bytes_ += got;
+        if (got == 0) {
+            if (std::ferror(from_)) {
+                throw std::runtime_error(std::string("read failed: ") + std::strerror(errno));
+            }
+            eof_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    void reader::parse_header(const char* begin, const char* end) {
+        std::vector<std::string_view> names;
+        scanner separators(begin, end, delimiter_);
+        const char* field = begin;
+        while (true) {
+            const char* sep = separators.next();
+            if (sep < end && *sep == '"') {
+                throw std::runtime_error("line " + std::to_string(line_) + ": quoted fields are not supported");
+            }
+            names.push_back(trim(field, sep));
+            if (sep >= end) {
+                break;
+            }
+            field = sep + 1;
+        }
+
+        field_to_column_.assign(names.size(), -1);
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            bool found = false;
+            for (std::size_t f = 0; f < names.size(); ++f) {
+                if (names[f] == columns_[c].name) {
+                    field_to_column_[f] = static_cast<int>(c);
+                    found = true;
+                    break;
+                }
+            }
+            if (!found && columns_[c].required) {
+                throw std::runtime_error("header has no column " + columns_[c].name);
+            }
+            seen_[c] = found ? 0 : 2; // 2 marks a column filled with its default
+        }
+        header_done_ = true;
+    }
+
+    void reader::finish_row() {
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            if (seen_[c] == 2) {
+                if (columns_[c].type == column_type::real) {
+                    reals_[slot_[c]].push_back(columns_[c].fill);
+                } else {
+                    integers_[slot_[c]].push_back(static_cast<int>(columns_[c].fill));
+                }
+                continue;
+            }
+            if (seen_[c] == 0) {
+                throw std::runtime_error("line " + std::to_string(line_) + ": missing column " + columns_[c].name);
+            }
+            seen_[c] = 0;
+        }
+        ++rows_;
+    }
+
+    void reader::store(const std::size_t column, const std::string_view text, const std::size_t line) {
+        const auto* text_end = text.data() + text.size();
+        if (columns_[column].type == column_type::real) {
+            double value = 0.0;
+            const auto [ptr, ec] = std::from_chars(text.data(), text_end, value);
+            if (ec != std::errc() || ptr != text_end) {
+                throw std::runtime_error("line " + std::to_string(line) + ": bad number '" + std::string(text) +
+                    "' in column " + columns_[column].name);
+            }
+            reals_[slot_[column]].push_back(value);
+        } else {
+            int value = 0;
+            const auto [ptr, ec] = std::from_chars(text.data(), text_end, value);
+            if (ec != std::errc() || ptr != text_end) {
+                throw std::runtime_error("line " + std::to_string(line) + ": bad integer '" + std::string(text) +
+                    "' in column " + columns_[column].name);
+            }
+            integers_[slot_[column]].push_back(value);
+        }
+        seen_[column] = 1;
+    }
+
+    std::size_t reader::parse(const char* begin, const char* end, const std::size_t max_rows) {
+        scanner separators(begin, end, delimiter_);
+        const char* line = begin;
+        const char* field = begin;
+        std::size_t index = 0;
+        std::size_t parsed = 0;
+
+        while (true) {
+            const char* sep = separators.next();
+            if (sep < end && *sep == '"') {
+                throw std::runtime_error("line " + std::to_string(line_ + 1) + ": quoted fields are not supported");
+            }
+
+            // a line with one empty field is blank and skipped, so nothing is stored for it
+            const bool line_end = sep >= end || *sep == '\n';
+            const bool blank = index == 0 && line_end && trim(field, sep).empty();
+            if (!blank && header_done_ && index < field_to_column_.size() && field_to_column_[index] >= 0) {
+                store(static_cast<std::size_t>(field_to_column_[index]), trim(field, sep), line_ + 1);
+            }
+            ++index;
+
+            if (!line_end) {
+                field = sep + 1;
+                continue;
+            }
+
+            ++line_;
+            if (!blank) {
+                if (!header_done_) {
+                    parse_header(line, sep);
+                } else {
+                    finish_row();
+                    ++parsed;
+                }
+            }
+            if (sep >= end) {
+                return static_cast<std::size_t>(end - begin);
+            }
+            field = sep + 1;
+            line = field;
+            index = 0;
+            if (parsed == max_rows || field == end) {
+                return static_cast<std::size_t>(field - begin);
+            }
+        }
+    }
+
+    std::size_t read_file(const std::string& path,
+        const std::vector<column_spec>& columns,
+        std::vector<std::vector<double>>& reals,
+        std::vector<std::vector<int>>& integers,
+        const char delimiter) {
+        std::FILE* from = std::fopen(path.c_str(), "rb");
+        if (from == nullptr) {
+            throw std::runtime_error("cannot open " + path + ": " + std::strerror(errno));
+        }
+
+        reals.clear();
+        integers.clear();
+        for (const auto& column : columns) {
+            if (column.type == column_type::real) {
+                reals.emplace_back();
+            } else {
+                integers.emplace_back();
+            }
+        }
+
+        std::size_t total = 0;
+        try {
+            reader csv(from, columns, delimiter);
+            while (const auto rows = csv.read(1 << 16)) {
+                std::size_t r = 0;
+                std::size_t i = 0;
+                for (std::size_t c = 0; c < columns.size(); ++c) {
+                    if (columns[c].type == column_type::real) {
+                        const auto values = csv.real(c);
+                        auto& to = reals[r++];
+                        to.insert(to.end(), values.begin(), values.end());
+                    } else {
+                        const auto values = csv.integer(c);
+                        auto& to = integers[i++];
+                        to.insert(to.end(), values.begin(), values.end());
+                    }
+                }
+                total += rows;
+            }
+        } catch (...) {
+            std::fclose(from);
+            throw;
+        }
+        std::fclose(from);
+        return total;
+    }
+
+} // namespace pyfi::csv
@@ -0,0 +1,299 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/curve.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <pyfi/parallel.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+namespace pyfi::curve {
+
+    namespace {
+        constexpr std::size_t rows_per_chunk = 1024;
+
+        // z(t) t = lower z[index] + upper z[index + 1], over the first count pillars
+        struct weights {
+            std::size_t index;
+            double lower;
+            double upper;
+        };
+
+        weights interpolate(const std::vector<double>& times, const std::size_t count, const double t) {
+            const auto after = std::upper_bound(times.begin(), times.begin() + static_cast<std::ptrdiff_t>(count), t);
+            if (after == times.begin()) {
+                return {0, t, 0.0};
+            }
+            const auto index = static_cast<std::size_t>(after - times.begin()) - 1;
+            if (index + 1 == count) {
+                return {index, t, 0.0};
+            }
+            const double w = (t - times[index]) / (times[index + 1] - times[index]);
+            return {index, (1.0 - w) * times[index], w * times[index + 1]};
+        }
+
+        double total_rate(const weights& w, const std::vector<double>& zero_rates) {
+            return w.lower * zero_rates[w.index] + (w.upper != 0.0 ? w.upper * zero_rates[w.index + 1] : 0.0);
+        }
+
+        // the dirty_coupon_price_from_T schedule: n coupons at maturity - j / m, and the fraction of the current
+        // period already accrued
+        struct schedule {
+            int coupons;
+            double accrued;
+        };
+
+        schedule coupon_schedule(const double maturity, const int m) {
+            const double N = maturity * static_cast<double>(m);
+            const double fraction = N - std::floor(N);
+            return {static_cast<int>(std::ceil(N)), std::abs(fraction) < 1e-12 ? 0.0 : 1.0 - fraction};
+        }
+
+        // calls visit(time, amount) for every cash flow of one unit of par
+        template <typename Visit>
+        void cash_flows(const double maturity, const double coupon_rate, const int m, const Visit& visit) {
+            const auto s = coupon_schedule(maturity, m);
+            const double coupon = coupon_rate / m;
+            for (int j = s.coupons - 1; j >= 0; --j) {
+                const double t = maturity - static_cast<double>(j) / m;
+                visit(t, j == 0 ? 1.0 + coupon : coupon);
+            }
+        }
+
+        void check_bond(const double maturity, const int m) {
+            if (m <= 0) {
+                throw std::invalid_argument("m must be positive");
+            }
+            if (!(maturity > 0.0)) {
+                throw std::invalid_argument("maturity must be positive");
+            }
+        }
+
+        // [first, last] pillars a bond's cash flows touch
+        std::pair<std::size_t, std::size_t> pillar_range(const std::vector<double>& times,
+            const double maturity,
+            const int m) {
+            const auto s = coupon_schedule(maturity, m);
+            const auto first = interpolate(times, times.size(), maturity - static_cast<double>(s.coupons - 1) / m);
+            const auto last = interpolate(times, times.size(), maturity);
+            return {first.index, last.index + (last.upper != 0.0 ? 1 : 0)};
+        }
+    } // namespace
+
+    zero_curve::zero_curve(std::vector<double> times, std::vector<double> zero_rates) :
+        times_(std::move(times)), zero_rates_(std::move(zero_rates)) {
+        if (times_.empty() || times_.size() != zero_rates_.size()) {
+            throw std::invalid_argument("a zero curve needs one rate per pillar and at least one pillar");
+        }
+        for (std::size_t i = 0; i < times_.size(); ++i) {
+            if (!(times_[i] > (i == 0 ? 0.0 : times_[i - 1]))) {
+                throw std::invalid_argument("pillar times must be positive and increasing");
+            }
+        }
+    }
+
+    double zero_curve::zero_rate(const double time) const {
+        if (!(time > 0.0)) {
+            return zero_rates_.front();
+        }
+        return total_rate(interpolate(times_, times_.size(), time), zero_rates_) / time;
+    }
+
+    double zero_curve::discount(const double time) const {
+        return std::exp(-total_rate(interpolate(times_, times_.size(), time), zero_rates_));
+    }
+
+    const std::vector<double>& zero_curve::times() const {
+        return times_;
+    }
+
+    const std::vector<double>& zero_curve::zero_rates() const {
+        return zero_rates_;
+    }
+
+    bootstrap_result bootstrap(const std::span<const par_instrument> instruments) {
+        const auto n = instruments.size();
+        if (n == 0) {
+            throw std::invalid_argument("bootstrap needs at least one instrument");
+        }
+        const profile::scope scope("curve.bootstrap", n);
+        const trace::span span("curve.bootstrap", "curve", n);
+
+        std::vector<double> times(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            check_bond(instruments[i].maturity, instruments[i].m);
+            if (i > 0 && !(instruments[i].maturity > instruments[i - 1].maturity)) {
+                throw std::invalid_argument("instrument maturities must be increasing");
+            }
+            times[i] = instruments[i].maturity;
+        }
+
+        std::vector<double> zero(n, 0.0);
+        std::vector<double> jacobian(n * n, 0.0);
+        std::vector<double> slope(n); // d par condition / d zero_j of the current instrument
+        for (std::size_t k = 0; k < n; ++k) {
+            const auto& instrument = instruments[k];
+            const auto accrued = coupon_schedule(instrument.maturity, instrument.m).accrued;
+            // par condition: the cash flows' present value less accrued interest is 1
+            const auto condition = [&](std::vector<double>* gradient, double* annuity) {
+                double value = -1.0 - instrument.par_rate / instrument.m * accrued;
+                double coupons = -accrued;
+                cash_flows(instrument.maturity, instrument.par_rate, instrument.m, [&](const double t, const double c) {
+                    const auto w = interpolate(times, k + 1, t);
+                    const double d = std::exp(-total_rate(w, zero));
+                    value += c * d;
+                    coupons += d;
+                    if (gradient != nullptr) {
+                        (*gradient)[w.index] -= c * w.lower * d;
+                        if (w.upper != 0.0) {
+                            (*gradient)[w.index + 1] -= c * w.upper * d;
+                        }
+                    }
+                });
+                if (annuity != nullptr) {
+                    *annuity = coupons / instrument.m;
+                }
+                return value;
+            };
+
+            zero[k] = k == 0 ? instrument.m * std::log1p(instrument.par_rate / instrument.m) : zero[k - 1];
+            bool solved = false;
+            for (int iteration = 0; iteration < 100 && !solved; ++iteration) {
+                std::fill(slope.begin(), slope.end(), 0.0);
+                const double value = condition(&slope, nullptr);
+                const double step = value / slope[k];
+                if (!std::isfinite(step)) {
+                    break;
+                }
+                zero[k] -= step;
+                solved = std::abs(step) < 1e-14 || std::abs(value) < 1e-15;
+            }
+            if (!solved) {
+                throw std::invalid_argument("bootstrap failed at maturity " + std::to_string(instrument.maturity));
+            }
+
+            // implicit function theorem on the par condition at the solution:
+            // sum_j slope_j d zero_j / d par_l + d condition / d par_k [l == k] = 0, so row k follows from rows j < k
+            std::fill(slope.begin(), slope.end(), 0.0);
+            double annuity = 0.0;
+            condition(&slope, &annuity);
+            for (std::size_t l = 0; l <= k; ++l) {
+                double sum = l == k ? annuity : 0.0;
+                for (std::size_t j = l; j < k; ++j) {
+                    sum += slope[j] * jacobian[j * n + l];
+                }
+                jacobian[k * n + l] = -sum / slope[k];
+            }
+        }
+        return {zero_curve(std::move(times), std::move(zero)), std::move(jacobian)};
+    }
+
+    sparse_matrix zero_sensitivities(const zero_curve& curve,
+        const std::span<const double> par_value,
+        const std::span<const double> coupon_rate,
+        const std::span<const double> years_to_maturity,
+        const std::span<const int> m,
+        const std::span<double> price) {
+        const auto rows = par_value.size();
+        if (coupon_rate.size() != rows || years_to_maturity.size() != rows || m.size() != rows ||
+            (!price.empty() && price.size() != rows)) {
+            throw std::invalid_argument("bond columns must have the same length");
+        }
+        const profile::scope scope("curve.zero_sensitivities", rows);
+        const trace::span span("curve.zero_sensitivities", "curve", rows);
+        const auto& times = curve.times();
+        const auto& zero = curve.zero_rates();
+
+        // the pillars each row touches are known from its first and last cash flow, which fixes the layout up front
+        sparse_matrix out;
+        out.rows = rows;
+        out.columns = times.size();
+        out.row_start.assign(rows + 1, 0);
+        for (std::size_t i = 0; i < rows; ++i) {
+            check_bond(years_to_maturity[i], m[i]);
+            const auto [first, last] = pillar_range(times, years_to_maturity[i], m[i]);
+            out.row_start[i + 1] = out.row_start[i] + (last - first + 1);
+        }
+        out.column.resize(out.row_start.back());
+        out.value.resize(out.row_start.back());
+
+        parallel::parallel_for(rows, rows_per_chunk, [&](const std::size_t begin, const std::size_t end) {
+            std::vector<double> row(times.size(), 0.0);
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto [first, last] = pillar_range(times, years_to_maturity[i], m[i]);
+                double value = 0.0;
+                cash_flows(years_to_maturity[i], coupon_rate[i], m[i], [&](const double t, const double c) {
+                    const auto w = interpolate(times, times.size(), t);
+                    const double pv = par_value[i] * c * std::exp(-total_rate(w, zero));
+                    value += pv;
+                    row[w.index] -= w.lower * pv;
+                    if (w.upper != 0.0) {
+                        row[w.index + 1] -= w.upper * pv;
+                    }
+                });
+                auto at = out.row_start[i];
+                for (auto j = first; j <= last; ++j, ++at) {
+                    out.column[at] = static_cast<std::uint32_t>(j);
+                    out.value[at] = row[j];
+                    row[j] = 0.0;
+                }
+                if (!price.empty()) {
+                    price[i] = value;
+                }
+            }
+        });
+        return out;
+    }
+
+    sparse_matrix par_sensitivities(const sparse_matrix& zero_risk, const bootstrap_result& curve) {
+        const auto n = curve.curve.times().size();
+        if (zero_risk.columns != n || zero_risk.row_start.size() != zero_risk.rows + 1) {
+            throw std::invalid_argument("zero risk must have one column per pillar of the curve");
+        }
+        const profile::scope scope("curve.par_sensitivities", zero_risk.rows);
+        const trace::span span("curve.par_sensitivities", "curve", zero_risk.rows);
+        const auto& jacobian = curve.jacobian;
+
+        // a row ending on pillar j fills instruments 0 to j, since the Jacobian is lower triangular
+        sparse_matrix out;
+        out.rows = zero_risk.rows;
+        out.columns = n;
+        out.row_start.assign(zero_risk.rows + 1, 0);
+        for (std::size_t r = 0; r < zero_risk.rows; ++r) {
+            const auto begin = zero_risk.row_start[r];
+            const auto end = zero_risk.row_start[r + 1];
+            out.row_start[r + 1] = out.row_start[r] + (end > begin ? zero_risk.column[end - 1] + std::size_t{1} : 0);
+        }
+        out.column.resize(out.row_start.back());
+        out.value.resize(out.row_start.back());
+
+        parallel::parallel_for(zero_risk.rows, rows_per_chunk, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t r = begin; r < end; ++r) {
+                const auto first = out.row_start[r];
+                const auto width = out.row_start[r + 1] - first;
+                double* row = &out.value[first];
+                std::fill_n(row, width, 0.0);
+                for (auto at = zero_risk.row_start[r]; at < zero_risk.row_start[r + 1]; ++at) {
+                    const auto j = zero_risk.column[at];
+                    const double g = zero_risk.value[at];
+                    const double* jacobian_row = &jacobian[j * n];
+                    for (std::size_t l = 0; l <= j; ++l) {
+                        row[l] += g * jacobian_row[l];
+                    }
+                }
+                for (std::size_t l = 0; l < width; ++l) {
+                    out.column[first + l] = static_cast<std::uint32_t>(l);
+                }
+            }
+        });
+        return out;
+    }
+
+} // namespace pyfi::curve
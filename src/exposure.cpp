@@ -0,0 +1,356 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/exposure.h>
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+
+#include <pyfi/bond.h>
+#include <pyfi/parallel.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+namespace pyfi::exposure {
+
+    namespace {
+        constexpr std::size_t max_buckets = 2048;
+
+        // zero coupon bond of the Vasicek model, P(t, t + tau) = exp(log_a - b r(t))
+        struct vasicek_bond {
+            double log_a;
+            double b;
+        };
+
+        vasicek_bond zero_bond(const market_model& model, const double tau) {
+            const double a = model.mean_reversion;
+            const double sigma = model.rate_volatility;
+            if (std::abs(a) < 1e-12) {
+                return {sigma * sigma * tau * tau * tau / 6.0, tau};
+            }
+            const double b = -std::expm1(-a * tau) / a;
+            const double log_a =
+                (model.long_rate - sigma * sigma / (2.0 * a * a)) * (b - tau) - sigma * sigma * b * b / (4.0 * a);
+            return {log_a, b};
+        }
+
+        void validate(const market_model& model, const portfolio& netting_set, const exposure_config& config) {
+            if (config.dates.empty()) {
+                throw std::invalid_argument("exposure dates must not be empty");
+            }
+            for (std::size_t i = 0; i < config.dates.size(); ++i) {
+                if (!(config.dates[i] > (i == 0 ? 0.0 : config.dates[i - 1]))) {
+                    throw std::invalid_argument("exposure dates must be positive and increasing");
+                }
+            }
+            for (const double q : config.quantiles) {
+                if (!(q >= 0.0 && q <= 1.0)) {
+                    throw std::invalid_argument("quantiles must be in [0, 1]");
+                }
+            }
+            if (config.paths == 0 || config.block == 0) {
+                throw std::invalid_argument("paths and block must be positive");
+            }
+            if (!(model.spot > 0.0) || !(model.volatility > 0.0)) {
+                throw std::invalid_argument("spot and volatility must be positive");
+            }
+            if (!(std::abs(model.correlation) <= 1.0)) {
+                throw std::invalid_argument("correlation must be in [-1, 1]");
+            }
+            for (const auto& p : netting_set.proxies) {
+                if (p.proxy == nullptr) {
+                    throw std::invalid_argument("proxy position without a proxy");
+                }
+            }
+            for (const auto& b : netting_set.bonds) {
+                if (b.m <= 0) {
+                    throw std::invalid_argument("m must be positive");
+                }
+            }
+        }
+
+        // risk factors and repricing columns of one block of paths, reused from date to date
+        struct scenarios {
+            explicit scenarios(const std::size_t n) :
+                spot(n), rate(n), value(n), volatility(n), yield_curve(n), strike(n), par_value(n), coupon_rate(n),
+                m(n), time(n), zero_rate(n), clamped_spot(n), clamped_volatility(n), out(n) {}
+
+            std::vector<double> spot;
+            std::vector<double> rate;
+            std::vector<double> value;
+            std::vector<double> volatility;
+            std::vector<double> yield_curve;
+            // columns of the position being repriced
+            std::vector<double> strike;
+            std::vector<double> par_value;
+            std::vector<double> coupon_rate;
+            std::vector<int> m;
+            std::vector<double> time;
+            std::vector<double> zero_rate;
+            std::vector<double> clamped_spot;
+            std::vector<double> clamped_volatility;
+            std::vector<double> out;
+        };
+
+        // adds the value of every position alive at t to s.value
+        void reprice(const market_model& model, const portfolio& netting_set, const double t, scenarios& s) {
+            const auto n = s.spot.size();
+            std::fill(s.value.begin(), s.value.end(), 0.0);
+            const auto zero_rates = [&](const double tau) {
+                const auto bond = zero_bond(model, tau);
+                for (std::size_t k = 0; k < n; ++k) {
+                    s.zero_rate[k] = (bond.b * s.rate[k] - bond.log_a) / tau;
+                }
+            };
+            const auto accumulate = [&](const double quantity) {
+                for (std::size_t k = 0; k < n; ++k) {
+                    s.value[k] += quantity * s.out[k];
+                }
+            };
+
+            for (const auto& p : netting_set.options) {
+                const double tau = p.maturity - t;
+                if (tau <= 0.0) {
+                    continue;
+                }
+                zero_rates(tau);
+                std::fill(s.strike.begin(), s.strike.end(), p.strike_price);
+                std::fill(s.time.begin(), s.time.end(), tau);
+                const option::option_batch batch{s.spot, s.strike, s.volatility, s.zero_rate, s.time, s.yield_curve};
+                if (p.type == option::option_type::call) {
+                    option::black_scholes_call_batch(batch, s.out);
+                } else {
+                    option::black_scholes_put_batch(batch, s.out);
+                }
+                accumulate(p.quantity);
+            }
+
+            for (const auto& p : netting_set.bonds) {
+                const double tau = p.maturity - t;
+                if (tau <= 0.0) {
+                    continue;
+                }
+                zero_rates(tau);
+                // the continuously compounded zero rate as a yield compounded m times a year
+                for (std::size_t k = 0; k < n; ++k) {
+                    s.zero_rate[k] = p.m * std::expm1(s.zero_rate[k] / p.m);
+                }
+                std::fill(s.par_value.begin(), s.par_value.end(), p.par_value);
+                std::fill(s.coupon_rate.begin(), s.coupon_rate.end(), p.coupon_rate);
+                std::fill(s.time.begin(), s.time.end(), tau);
+                std::fill(s.m.begin(), s.m.end(), p.m);
+                bond::dirty_coupon_price_from_T_batch({s.par_value, s.coupon_rate, s.zero_rate, s.time, s.m}, s.out);
+                accumulate(p.quantity);
+            }
+
+            for (const auto& p : netting_set.proxies) {
+                const double tau = p.maturity - t;
+                if (tau <= 0.0) {
+                    continue;
+                }
+                const auto& box = p.proxy->config();
+                std::fill(s.time.begin(), s.time.end(), std::clamp(tau, box.time.lower, box.time.upper));
+                std::fill(s.clamped_volatility.begin(),
+                    s.clamped_volatility.end(),
+                    std::clamp(model.volatility, box.volatility.lower, box.volatility.upper));
+                for (std::size_t k = 0; k < n; ++k) {
+                    s.clamped_spot[k] = std::clamp(s.spot[k], box.spot.lower, box.spot.upper);
+                }
+                p.proxy->evaluate_batch(s.clamped_spot, s.clamped_volatility, s.time, s.out);
+                accumulate(p.quantity);
+            }
+        }
+    } // namespace
+
+    quantile_sketch::quantile_sketch(const double relative_accuracy) : accuracy_(relative_accuracy) {
+        if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0)) {
+            throw std::invalid_argument("relative_accuracy must be in (0, 1)");
+        }
+        log_gamma_ = std::log((1.0 + relative_accuracy) / (1.0 - relative_accuracy));
+    }
+
+    void quantile_sketch::add(const double value) {
+        if (!(value > 0.0)) {
+            ++zeros_;
+            ++count_;
+            return;
+        }
+        add_to_bucket(static_cast<int>(std::ceil(std::log(value) / log_gamma_)), 1);
+    }
+
+    void quantile_sketch::add_to_bucket(int index, const std::uint64_t count) {
+        count_ += count;
+        if (counts_.empty()) {
+            offset_ = index;
+            counts_.assign(1, count);
+            return;
+        }
+        if (index < offset_) {
+            const auto grow = static_cast<std::size_t>(offset_ - index);
+            if (counts_.size() + grow > max_buckets) {
+                // no room below: the value joins the lowest bucket
+                counts_.front() += count;
+                return;
+            }
+            counts_.insert(counts_.begin(), grow, 0);
+            offset_ = index;
+        } else if (index >= offset_ + static_cast<int>(counts_.size())) {
+            const int lowest = index - static_cast<int>(max_buckets) + 1;
+            if (lowest > offset_) {
+                // make room above by merging every bucket below lowest into it
+                std::vector<std::uint64_t> moved(max_buckets, 0);
+                for (std::size_t i = 0; i < counts_.size(); ++i) {
+                    const int bucket = std::max(offset_ + static_cast<int>(i), lowest);
+                    moved[static_cast<std::size_t>(bucket - lowest)] += counts_[i];
+                }
+                counts_ = std::move(moved);
+                offset_ = lowest;
+            } else {
+                counts_.resize(static_cast<std::size_t>(index - offset_) + 1, 0);
+            }
+        }
+        counts_[static_cast<std::size_t>(index - offset_)] += count;
+    }
+
+    void quantile_sketch::merge(const quantile_sketch& other) {
+        if (other.accuracy_ != accuracy_) {
+            throw std::invalid_argument("cannot merge sketches of different accuracies");
+        }
+        zeros_ += other.zeros_;
+        count_ += other.zeros_;
+        for (std::size_t i = 0; i < other.counts_.size(); ++i) {
+            if (other.counts_[i] > 0) {
+                add_to_bucket(other.offset_ + static_cast<int>(i), other.counts_[i]);
+            }
+        }
+    }
+
+    double quantile_sketch::quantile(const double q) const {
+        if (!(q >= 0.0 && q <= 1.0)) {
+            throw std::invalid_argument("q must be in [0, 1]");
+        }
+        if (count_ == 0) {
+            return 0.0;
+        }
+        const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count_ - 1));
+        std::uint64_t seen = zeros_;
+        if (rank < seen) {
+            return 0.0;
+        }
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (rank < seen) {
+                // the middle of bucket (gamma^(index - 1), gamma^index] in relative terms
+                const double gamma = std::exp(log_gamma_);
+                return 2.0 * std::exp(log_gamma_ * (offset_ + static_cast<int>(i))) / (gamma + 1.0);
+            }
+        }
+        return 0.0;
+    }
+
+    std::uint64_t quantile_sketch::count() const {
+        return count_;
+    }
+
+    exposure_profile simulate(const market_model& model, const portfolio& netting_set, const exposure_config& config) {
+        validate(model, netting_set, config);
+        const auto& dates = config.dates;
+        const auto n_dates = dates.size();
+        const auto blocks = (config.paths + config.block - 1) / config.block;
+        const profile::scope scope("exposure.simulate", config.paths * n_dates);
+        const trace::span span("exposure.simulate", "pricing", config.paths * n_dates);
+
+        // per block sums summed in block order afterwards, and sketches merged by exact counts, so neither depends on
+        // which thread ran which block
+        std::vector<double> sums(blocks * n_dates, 0.0);
+        std::vector<quantile_sketch> sketches(n_dates, quantile_sketch(config.relative_accuracy));
+        std::mutex sketch_mutex;
+
+        parallel::parallel_for(blocks, 1, [&](const std::size_t begin, const std::size_t end) {
+            std::vector<quantile_sketch> local(n_dates, quantile_sketch(config.relative_accuracy));
+            for (std::size_t block = begin; block < end; ++block) {
+                const auto first = block * config.block;
+                const auto n = std::min(config.block, config.paths - first);
+                std::seed_seq seed{static_cast<std::uint32_t>(config.seed),
+                    static_cast<std::uint32_t>(config.seed >> 32),
+                    static_cast<std::uint32_t>(block),
+                    static_cast<std::uint32_t>(block >> 32)};
+                std::mt19937_64 rng(seed);
+                std::normal_distribution<double> normal;
+
+                scenarios s(n);
+                std::fill(s.spot.begin(), s.spot.end(), model.spot);
+                std::fill(s.rate.begin(), s.rate.end(), model.short_rate);
+                std::fill(s.volatility.begin(), s.volatility.end(), model.volatility);
+                std::fill(s.yield_curve.begin(), s.yield_curve.end(), model.yield_curve);
+
+                const double a = model.mean_reversion;
+                const double sigma = model.volatility;
+                const double rho = model.correlation;
+                const double orthogonal = std::sqrt(1.0 - rho * rho);
+                double t = 0.0;
+                for (std::size_t d = 0; d < n_dates; ++d) {
+                    const double dt = dates[d] - t;
+                    // exact Vasicek transition; the spot drift uses the average short rate over the step
+                    const double decay = std::abs(a) < 1e-12 ? 1.0 : std::exp(-a * dt);
+                    const double rate_variance = std::abs(a) < 1e-12 ? dt : -std::expm1(-2.0 * a * dt) / (2.0 * a);
+                    const double rate_sd = model.rate_volatility * std::sqrt(rate_variance);
+                    const double spot_sd = sigma * std::sqrt(dt);
+                    for (std::size_t k = 0; k < n; ++k) {
+                        const double z_rate = normal(rng);
+                        const double z_spot = rho * z_rate + orthogonal * normal(rng);
+                        const double r0 = s.rate[k];
+                        const double r1 = r0 * decay + model.long_rate * (1.0 - decay) + rate_sd * z_rate;
+                        s.rate[k] = r1;
+                        s.spot[k] *= std::exp((0.5 * (r0 + r1) - model.yield_curve - 0.5 * sigma * sigma) * dt +
+                                              spot_sd * z_spot);
+                    }
+                    t = dates[d];
+
+                    reprice(model, netting_set, t, s);
+                    double sum = 0.0;
+                    for (std::size_t k = 0; k < n; ++k) {
+                        const double exposure = std::max(s.value[k], 0.0);
+                        sum += exposure;
+                        local[d].add(exposure);
+                    }
+                    sums[block * n_dates + d] = sum;
+                }
+            }
+            std::lock_guard lock(sketch_mutex);
+            for (std::size_t d = 0; d < n_dates; ++d) {
+                sketches[d].merge(local[d]);
+            }
+        });
+
+        exposure_profile result;
+        result.dates = dates;
+        result.expected_exposure.assign(n_dates, 0.0);
+        for (std::size_t block = 0; block < blocks; ++block) {
+            for (std::size_t d = 0; d < n_dates; ++d) {
+                result.expected_exposure[d] += sums[block * n_dates + d];
+            }
+        }
+        result.expected_positive_exposure = 0.0;
+        for (std::size_t d = 0; d < n_dates; ++d) {
+            result.expected_exposure[d] /= static_cast<double>(config.paths);
+            result.expected_positive_exposure +=
+                result.expected_exposure[d] * (dates[d] - (d == 0 ? 0.0 : dates[d - 1]));
+        }
+        result.expected_positive_exposure /= dates.back();
+
+        for (const double q : config.quantiles) {
+            auto& row = result.potential_future_exposure.emplace_back(n_dates);
+            for (std::size_t d = 0; d < n_dates; ++d) {
+                row[d] = sketches[d].quantile(q);
+            }
+            result.peak_exposure.push_back(*std::max_element(row.begin(), row.end()));
+        }
+        return result;
+    }
+
+} // namespace pyfi::exposure
@@ -0,0 +1,238 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/futures.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <pyfi/parallel.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+namespace pyfi::futures {
+
+    namespace {
+        constexpr std::size_t pairs_per_chunk = 256;
+
+        // the dirty_coupon_price_from_T schedule: n coupons left and the fraction of the current period accrued
+        struct schedule {
+            int coupons;
+            double accrued;
+        };
+
+        schedule coupon_schedule(const double maturity, const int m) {
+            const double N = maturity * static_cast<double>(m);
+            const double fraction = N - std::floor(N);
+            return {static_cast<int>(std::ceil(N)), std::abs(fraction) < 1e-12 ? 0.0 : 1.0 - fraction};
+        }
+
+        // everything about a (contract, deliverable) pair that does not move with the yield
+        struct delivery_pair {
+            std::size_t deliverable;
+            double par_value;
+            double coupon_rate;
+            double annual_yield;
+            int m;
+            schedule today;
+            double price; // of the futures
+            double delivery;
+            double repo_rate;
+            double factor;
+            double accrued_today;
+            double accrued_delivery;
+            double coupons; // sum C over the coupons paid up to delivery
+            double coupons_time; // sum C (tau - t_i) over the same coupons
+        };
+
+        delivery_pair make_pair(const bond::bond_batch& deliverables, const contract& c, const std::size_t i) {
+            const int m = deliverables.m[i];
+            if (m <= 0) {
+                throw std::invalid_argument("m must be positive");
+            }
+            const double maturity = deliverables.years_to_maturity[i];
+            const double par_value = deliverables.par_value[i];
+            const double coupon_rate = deliverables.coupon_rate[i];
+
+            delivery_pair p{};
+            p.deliverable = i;
+            p.par_value = par_value;
+            p.coupon_rate = coupon_rate;
+            p.annual_yield = deliverables.annual_yield[i];
+            p.m = m;
+            p.today = coupon_schedule(maturity, m);
+            p.price = c.price;
+            p.delivery = c.delivery;
+            p.repo_rate = c.repo_rate;
+            p.factor = conversion_factor(coupon_rate, maturity - c.delivery, m, c.notional_coupon, c.maturity_rounding);
+            p.accrued_today = bond::accrued_interest(par_value, coupon_rate, m, p.today.accrued);
+            p.accrued_delivery =
+                bond::accrued_interest(par_value, coupon_rate, m, coupon_schedule(maturity - c.delivery, m).accrued);
+
+            // coupon j is paid at maturity - j / m, and those with j >= (maturity - delivery) m fall before delivery
+            const double C = par_value * (coupon_rate / static_cast<double>(m));
+            const auto first = static_cast<int>(std::ceil((maturity - c.delivery) * m - 1e-9));
+            p.coupons = 0.0;
+            p.coupons_time = 0.0;
+            for (int j = first; j < p.today.coupons; ++j) {
+                p.coupons += C;
+                p.coupons_time += C * (c.delivery - (maturity - static_cast<double>(j) / m));
+            }
+            return p;
+        }
+
+        double dirty_price(const delivery_pair& p, const double shift) {
+            return bond::dirty_coupon_price(
+                p.par_value, p.coupon_rate, p.annual_yield + shift, p.today.coupons, p.m, p.today.accrued);
+        }
+
+        // clean price at delivery that breaks even with buying at dirty today and financing to delivery
+        double forward_clean(const delivery_pair& p, const double dirty) {
+            return dirty * (1.0 + p.repo_rate * p.delivery) - p.coupons - p.repo_rate * p.coupons_time -
+                p.accrued_delivery;
+        }
+
+        // the pairs of every contract, contract by contract, and the first row of each
+        std::vector<delivery_pair> make_pairs(const bond::bond_batch& deliverables,
+            const std::span<const contract> contracts,
+            std::vector<std::size_t>& row_start) {
+            const auto n = deliverables.size();
+            row_start.assign(contracts.size() + 1, 0);
+            for (std::size_t k = 0; k < contracts.size(); ++k) {
+                const auto& c = contracts[k];
+                if (c.count == 0 || c.first > n || c.count > n - c.first) {
+                    throw std::invalid_argument("a basket must be a non empty range of the deliverables");
+                }
+                if (!(c.delivery > 0.0)) {
+                    throw std::invalid_argument("delivery must be positive");
+                }
+                row_start[k + 1] = row_start[k] + c.count;
+            }
+
+            std::vector<delivery_pair> pairs(row_start.back());
+            parallel::parallel_for(contracts.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t k = begin; k < end; ++k) {
+                    for (std::size_t j = 0; j < contracts[k].count; ++j) {
+                        pairs[row_start[k] + j] = make_pair(deliverables, contracts[k], contracts[k].first + j);
+                    }
+                }
+            });
+            return pairs;
+        }
+    } // namespace
+
+    double conversion_factor(const double coupon_rate,
+        const double years_to_maturity,
+        const int m,
+        const double notional_coupon,
+        const double maturity_rounding) {
+        if (m <= 0) {
+            throw std::invalid_argument("m must be positive");
+        }
+        if (!(maturity_rounding > 0.0)) {
+            throw std::invalid_argument("maturity_rounding must be positive");
+        }
+        const double rounded = std::floor(years_to_maturity / maturity_rounding + 1e-9) * maturity_rounding;
+        if (!(rounded > 0.0)) {
+            throw std::invalid_argument("a deliverable must outlive the delivery date by a rounding period");
+        }
+        const auto s = coupon_schedule(rounded, m);
+        const double clean = bond::dirty_coupon_price(1.0, coupon_rate, notional_coupon, s.coupons, m, s.accrued) -
+            bond::accrued_interest(1.0, coupon_rate, m, s.accrued);
+        return std::round(clean * 1e4) / 1e4;
+    }
+
+    basis_analytics basis(const bond::bond_batch& deliverables, const std::span<const contract> contracts) {
+        const profile::scope scope("futures.basis", contracts.size());
+        const trace::span span("futures.basis", "futures", contracts.size());
+
+        basis_analytics out;
+        const auto pairs = make_pairs(deliverables, contracts, out.row_start);
+        const auto rows = pairs.size();
+        out.deliverable.resize(rows);
+        out.conversion_factor.resize(rows);
+        out.clean_price.resize(rows);
+        out.dirty_price.resize(rows);
+        out.invoice_price.resize(rows);
+        out.gross_basis.resize(rows);
+        out.carry.resize(rows);
+        out.net_basis.resize(rows);
+        out.implied_repo.resize(rows);
+
+        parallel::parallel_for(rows, pairs_per_chunk, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto& p = pairs[i];
+                const double dirty = dirty_price(p, 0.0);
+                const double clean = dirty - p.accrued_today;
+                const double invoice = p.price * p.factor + p.accrued_delivery;
+                const double gross = clean - p.price * p.factor;
+                const double financing = dirty * p.repo_rate * p.delivery;
+                const double carry = p.accrued_delivery - p.accrued_today + p.coupons +
+                    p.repo_rate * p.coupons_time - financing;
+
+                out.deliverable[i] = p.deliverable;
+                out.conversion_factor[i] = p.factor;
+                out.clean_price[i] = clean;
+                out.dirty_price[i] = dirty;
+                out.invoice_price[i] = invoice;
+                out.gross_basis[i] = gross;
+                out.carry[i] = carry;
+                out.net_basis[i] = gross - carry;
+                out.implied_repo[i] = (invoice + p.coupons - dirty) / (dirty * p.delivery - p.coupons_time);
+            }
+        });
+
+        out.cheapest.resize(contracts.size());
+        for (std::size_t k = 0; k < contracts.size(); ++k) {
+            auto best = out.row_start[k];
+            for (auto i = best + 1; i < out.row_start[k + 1]; ++i) {
+                if (out.implied_repo[i] > out.implied_repo[best]) {
+                    best = i;
+                }
+            }
+            out.cheapest[k] = out.deliverable[best];
+        }
+        return out;
+    }
+
+    ctd_switch ctd_switch_analysis(const bond::bond_batch& deliverables,
+        const std::span<const contract> contracts,
+        const std::span<const double> yield_shifts) {
+        const auto cells = contracts.size() * yield_shifts.size();
+        const profile::scope scope("futures.ctd_switch_analysis", cells);
+        const trace::span span("futures.ctd_switch_analysis", "futures", cells);
+
+        std::vector<std::size_t> row_start;
+        const auto pairs = make_pairs(deliverables, contracts, row_start);
+
+        ctd_switch out;
+        out.shifts.assign(yield_shifts.begin(), yield_shifts.end());
+        out.cheapest.resize(cells);
+        out.futures_price.resize(cells);
+        const auto shifts = yield_shifts.size();
+        const auto grain = std::max<std::size_t>(1, pairs_per_chunk / std::max<std::size_t>(1, pairs.size()));
+        parallel::parallel_for(cells, grain, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t cell = begin; cell < end; ++cell) {
+                const auto k = cell / shifts;
+                const double shift = yield_shifts[cell % shifts];
+                double lowest = std::numeric_limits<double>::infinity();
+                std::size_t cheapest = pairs[row_start[k]].deliverable;
+                for (auto i = row_start[k]; i < row_start[k + 1]; ++i) {
+                    const auto& p = pairs[i];
+                    const double adjusted = forward_clean(p, dirty_price(p, shift)) / p.factor;
+                    if (adjusted < lowest) {
+                        lowest = adjusted;
+                        cheapest = p.deliverable;
+                    }
+                }
+                out.cheapest[cell] = cheapest;
+                out.futures_price[cell] = lowest;
+            }
+        });
+        return out;
+    }
+
+} // namespace pyfi::futures
@@ -0,0 +1,138 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/memory.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+#include <pyfi/parallel.h>
+
+namespace pyfi::memory {
+
+    namespace {
+        constexpr std::size_t default_huge_page = std::size_t{2} << 20;
+
+        [[noreturn]] void throw_errno(const std::string& what) {
+            throw std::runtime_error(what + ": " + std::strerror(errno));
+        }
+
+        std::size_t page_size() {
+            return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        }
+
+        std::size_t round_up(const std::size_t bytes, const std::size_t align) {
+            return (bytes + align - 1) / align * align;
+        }
+
+#if defined(__linux__)
+        void bind_pages(void* data, const std::size_t bytes, const int mode, const unsigned long mask) {
+            // maxnode counts one past the highest bit the kernel reads
+            constexpr unsigned long max_node = sizeof(mask) * 8 + 1;
+            if (syscall(SYS_mbind, data, bytes, mode, &mask, max_node, 0) != 0) {
+                throw_errno("mbind");
+            }
+        }
+#endif
+    } // namespace
+
+    std::size_t huge_page_size() {
+        static const std::size_t size = [] {
+            std::ifstream in("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+            std::size_t bytes = 0;
+            return in >> bytes && bytes > 0 ? bytes : default_huge_page;
+        }();
+        return size;
+    }
+
+    std::pair<void*, std::size_t> map(const std::size_t bytes, const placement& placement) {
+        const auto align = placement.huge_pages ? huge_page_size() : page_size();
+        const auto size = round_up(std::max<std::size_t>(bytes, 1), align);
+        // over map by one huge page and trim, so the range starts on a huge page boundary
+        const auto mapped = placement.huge_pages ? size + align : size;
+
+        void* base = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            throw_errno("mmap");
+        }
+        auto* data = static_cast<std::byte*>(base);
+        if (placement.huge_pages) {
+            const auto address = reinterpret_cast<std::uintptr_t>(base);
+            auto* aligned = data + (round_up(address, align) - address);
+            if (aligned != data) {
+                munmap(data, static_cast<std::size_t>(aligned - data));
+            }
+            if (aligned + size != data + mapped) {
+                munmap(aligned + size, static_cast<std::size_t>(data + mapped - (aligned + size)));
+            }
+            data = aligned;
+        }
+
+        try {
+            advise(data, size, placement);
+        } catch (...) {
+            munmap(data, size);
+            throw;
+        }
+        return {data, size};
+    }
+
+    void unmap(void* data, const std::size_t bytes) {
+        if (data != nullptr) {
+            munmap(data, bytes);
+        }
+    }
+
+    void advise(void* data, const std::size_t bytes, const placement& placement) {
+#if defined(__linux__)
+        // only hints, the kernel may have transparent huge pages disabled; with them set to always a range has to
+        // opt out explicitly to stay on normal pages
+        madvise(data, bytes, placement.huge_pages ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+        switch (placement.numa) {
+            case numa_policy::local:
+                break;
+            case numa_policy::bind:
+                if (placement.node < 0 || placement.node >= static_cast<int>(sizeof(unsigned long) * 8)) {
+                    throw std::invalid_argument("NUMA node out of range");
+                }
+                bind_pages(data, bytes, MPOL_BIND, 1UL << placement.node);
+                break;
+            case numa_policy::interleave:
+                // the kernel keeps only the nodes with memory this process may use
+                bind_pages(data, bytes, MPOL_INTERLEAVE, ~0UL);
+                break;
+        }
+#else
+        if (placement.numa == numa_policy::bind) {
+            throw std::runtime_error("NUMA binding is only supported on Linux");
+        }
+#endif
+    }
+
+    void first_touch(void* data, const std::size_t bytes, const std::size_t grain) {
+        const auto page = page_size();
+        const auto pages = (bytes + page - 1) / page;
+        auto* base = static_cast<volatile std::byte*>(data);
+        parallel::parallel_for(pages, grain / page, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t p = begin; p < end; ++p) {
+                // a write fault, so the page is allocated here and not shared with the zero page
+                base[p * page] = base[p * page];
+            }
+        });
+    }
+
+} // namespace pyfi::memory
@@ -0,0 +1,311 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/monte_carlo.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace pyfi::monte_carlo {
+
+    namespace {
+        // per row constants of the log-Euler scheme, which is exact for geometric Brownian motion
+        struct row {
+            double spot;
+            double log_spot;
+            double strike;
+            double volatility;
+            double dt;
+            double drift; // (r - q - sigma^2 / 2) dt
+            double diffusion; // sigma sqrt(dt)
+            double discount;
+            double sign; // +1 for calls, -1 for puts
+        };
+
+        // running sum and sum of squares of one estimator
+        struct moments {
+            double sum = 0.0;
+            double sum_sq = 0.0;
+
+            void add(const double sample) {
+                sum += sample;
+                sum_sq += sample * sample;
+            }
+
+            [[nodiscard]] estimate result(const std::size_t samples, const double scale) const {
+                const auto count = static_cast<double>(samples);
+                const double mean = sum / count;
+                const double variance = samples > 1 ? std::max(0.0, (sum_sq - count * mean * mean) / (count - 1.0)) : 0.0;
+                return {scale * mean, scale * std::sqrt(variance / count)};
+            }
+        };
+
+        std::vector<row> make_rows(const option::option_batch& batch,
+            const option::option_type type,
+            const mc_config& config) {
+            if (config.paths == 0 || config.steps == 0) {
+                throw std::invalid_argument("paths and steps must be positive");
+            }
+            const auto n = batch.size();
+            std::vector<row> rows(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                const double sigma = batch.volatility[i];
+                const double T = batch.time[i];
+                if (sigma < 1e-9 || T < 1e-9) {
+                    throw std::invalid_argument("Time or volatility cannot be zero");
+                }
+                const double dt = T / static_cast<double>(config.steps);
+                rows[i] = {batch.stock_price[i],
+                    std::log(batch.stock_price[i]),
+                    batch.strike_price[i],
+                    sigma,
+                    dt,
+                    (batch.risk_free_rate[i] - batch.yield_curve[i] - 0.5 * sigma * sigma) * dt,
+                    sigma * std::sqrt(dt),
+                    std::exp(-batch.risk_free_rate[i] * T),
+                    type == option::option_type::call ? 1.0 : -1.0};
+            }
+            return rows;
+        }
+
+        // an antithetic pair is one sample: the mean of the path and its mirror image
+        std::size_t sample_count(const mc_config& config) {
+            return config.antithetic ? std::max<std::size_t>(1, config.paths / 2) : config.paths;
+        }
+
+        // draws the next path as running sums of unit normals, one per monitoring date
+        void draw(std::mt19937_64& rng, std::normal_distribution<double>& normal, std::vector<double>& walk) {
+            double running = 0.0;
+            for (auto& w : walk) {
+                running += normal(rng);
+                w = running;
+            }
+        }
+
+        // payoff of one row along one path, given the running sums of the normal draws
+        double path_payoff(const row& r, const std::vector<double>& walk, const double direction, const payoff_style style) {
+            const auto steps = walk.size();
+            double underlying;
+            if (style == payoff_style::european) {
+                underlying = std::exp(r.log_spot + static_cast<double>(steps) * r.drift + direction * r.diffusion * walk.back());
+            } else {
+                underlying = 0.0;
+                for (std::size_t k = 0; k < steps; ++k) {
+                    underlying += std::exp(r.log_spot + static_cast<double>(k + 1) * r.drift + direction * r.diffusion * walk[k]);
+                }
+                underlying /= static_cast<double>(steps);
+            }
+            return std::max(r.sign * (underlying - r.strike), 0.0);
+        }
+
+        struct path_greeks {
+            double price;
+            double delta;
+            double gamma;
+            double vega;
+        };
+
+        // Undiscounted payoff and Greek samples of one row along one path. Every spot on the path is proportional to
+        // S0, so the pathwise delta is the in the money indicator times A / S0, and dS_k / dsigma = S_k (W_k - sigma t_k).
+        // The likelihood ratio weights use the first normal of the path for the spot (the only draw whose density
+        // depends on S0) and every draw for the volatility. A European payoff only sees W_T, so it is treated as a
+        // single step of length T.
+        path_greeks path_sample(const row& r,
+            const std::vector<double>& walk,
+            const double direction,
+            const payoff_style style,
+            const greek_estimator estimator) {
+            const auto steps = walk.size();
+            const double sqrt_dt = std::sqrt(r.dt);
+
+            double underlying = 0.0;
+            double underlying_vega = 0.0;
+            double first_normal;
+            double first_dt;
+            if (style == payoff_style::european) {
+                const double T = r.dt * static_cast<double>(steps);
+                const double brownian = direction * sqrt_dt * walk.back();
+                underlying = std::exp(r.log_spot + static_cast<double>(steps) * r.drift + r.volatility * brownian);
+                underlying_vega = underlying * (brownian - r.volatility * T);
+                first_normal = brownian / std::sqrt(T);
+                first_dt = T;
+            } else {
+                for (std::size_t k = 0; k < steps; ++k) {
+                    const double t = static_cast<double>(k + 1) * r.dt;
+                    const double brownian = direction * sqrt_dt * walk[k];
+                    const double spot = std::exp(r.log_spot + static_cast<double>(k + 1) * r.drift + r.volatility * brownian);
+                    underlying += spot;
+                    underlying_vega += spot * (brownian - r.volatility * t);
+                }
+                underlying /= static_cast<double>(steps);
+                underlying_vega /= static_cast<double>(steps);
+                first_normal = direction * walk[0];
+                first_dt = r.dt;
+            }
+
+            const double intrinsic = r.sign * (underlying - r.strike);
+            const double payoff = std::max(intrinsic, 0.0);
+            const double vol_sqrt_dt = r.volatility * std::sqrt(first_dt);
+            const double spot_score = first_normal / (r.spot * vol_sqrt_dt);
+
+            if (estimator == greek_estimator::pathwise) {
+                const double delta = intrinsic > 0.0 ? r.sign * underlying / r.spot : 0.0;
+                const double vega = intrinsic > 0.0 ? r.sign * underlying_vega : 0.0;
+                // likelihood ratio on the pathwise delta, whose explicit 1 / S0 contributes the -delta / S0 term
+                return {payoff, delta, delta * (spot_score - 1.0 / r.spot), vega};
+            }
+
+            double vol_score;
+            if (style == payoff_style::european) {
+                vol_score = (first_normal * first_normal - 1.0) / r.volatility - first_normal * std::sqrt(first_dt);
+            } else {
+                vol_score = 0.0;
+                double previous = 0.0;
+                for (std::size_t k = 0; k < steps; ++k) {
+                    const double z = direction * walk[k] - previous;
+                    previous = direction * walk[k];
+                    vol_score += (z * z - 1.0) / r.volatility - z * sqrt_dt;
+                }
+            }
+            const double gamma_score =
+                ((first_normal * first_normal - 1.0) / (vol_sqrt_dt * vol_sqrt_dt) - first_normal / vol_sqrt_dt) /
+                (r.spot * r.spot);
+            return {payoff, payoff * spot_score, payoff * gamma_score, payoff * vol_score};
+        }
+    } // namespace
+
+    void price_batch(const option::option_batch& batch,
+        const option::option_type type,
+        const payoff_style style,
+        const mc_config& config,
+        std::span<double> out,
+        std::span<double> standard_error) {
+        const auto n = batch.size();
+        const profile::scope scope("monte_carlo.price_batch", n);
+        const trace::span span("monte_carlo.price_batch", "pricing", n);
+        if (out.size() != n || (!standard_error.empty() && standard_error.size() != n)) {
+            throw std::invalid_argument("output size must match the batch size");
+        }
+        const auto rows = make_rows(batch, type, config);
+
+        const auto samples = sample_count(config);
+        std::vector<moments> price(n);
+        std::vector<double> walk(config.steps);
+        std::mt19937_64 rng(config.seed);
+        std::normal_distribution<double> normal;
+
+        for (std::size_t path = 0; path < samples; ++path) {
+            draw(rng, normal, walk);
+            for (std::size_t i = 0; i < n; ++i) {
+                double sample = path_payoff(rows[i], walk, 1.0, style);
+                if (config.antithetic) {
+                    sample = 0.5 * (sample + path_payoff(rows[i], walk, -1.0, style));
+                }
+                price[i].add(sample);
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto result = price[i].result(samples, rows[i].discount);
+            out[i] = result.value;
+            if (!standard_error.empty()) {
+                standard_error[i] = result.standard_error;
+            }
+        }
+    }
+
+    void greeks_batch(const option::option_batch& batch,
+        const option::option_type type,
+        const payoff_style style,
+        const mc_config& config,
+        const greek_estimator estimator,
+        std::span<mc_greeks> out) {
+        const auto n = batch.size();
+        const profile::scope scope("monte_carlo.greeks_batch", n);
+        const trace::span span("monte_carlo.greeks_batch", "greeks", n);
+        if (out.size() != n) {
+            throw std::invalid_argument("output size must match the batch size");
+        }
+        const auto rows = make_rows(batch, type, config);
+
+        const auto samples = sample_count(config);
+        std::vector<moments> price(n), delta(n), gamma(n), vega(n);
+        std::vector<double> walk(config.steps);
+        std::mt19937_64 rng(config.seed);
+        std::normal_distribution<double> normal;
+
+        for (std::size_t path = 0; path < samples; ++path) {
+            draw(rng, normal, walk);
+            for (std::size_t i = 0; i < n; ++i) {
+                auto sample = path_sample(rows[i], walk, 1.0, style, estimator);
+                if (config.antithetic) {
+                    const auto mirror = path_sample(rows[i], walk, -1.0, style, estimator);
+                    sample = {0.5 * (sample.price + mirror.price),
+                        0.5 * (sample.delta + mirror.delta),
+                        0.5 * (sample.gamma + mirror.gamma),
+                        0.5 * (sample.vega + mirror.vega)};
+                }
+                price[i].add(sample.price);
+                delta[i].add(sample.delta);
+                gamma[i].add(sample.gamma);
+                vega[i].add(sample.vega);
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const double discount = rows[i].discount;
+            out[i] = {price[i].result(samples, discount),
+                delta[i].result(samples, discount),
+                gamma[i].result(samples, discount),
+                vega[i].result(samples, discount)};
+        }
+    }
+
+    mc_result price(const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const double yield_curve,
+        const option::option_type type,
+        const payoff_style style,
+        const mc_config& config) {
+        const option::option_batch batch{{&stock_price, 1},
+            {&strike_price, 1},
+            {&volatility, 1},
+            {&risk_free_rate, 1},
+            {&time, 1},
+            {&yield_curve, 1}};
+        mc_result result{};
+        price_batch(batch, type, style, config, {&result.price, 1}, {&result.standard_error, 1});
+        return result;
+    }
+
+    mc_greeks greeks(const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const double yield_curve,
+        const option::option_type type,
+        const payoff_style style,
+        const greek_estimator estimator,
+        const mc_config& config) {
+        const option::option_batch batch{{&stock_price, 1},
+            {&strike_price, 1},
+            {&volatility, 1},
+            {&risk_free_rate, 1},
+            {&time, 1},
+            {&yield_curve, 1}};
+        mc_greeks result{};
+        greeks_batch(batch, type, style, config, estimator, {&result, 1});
+        return result;
+    }
+
+} // namespace pyfi::monte_carlo
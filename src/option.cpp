@@ -2,19 +2,17 @@
 // Created by Nikolay Tsonev on 30/10/2025.
 //
 
-#include <boost/math/distributions/normal.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 
 #include "../include/pyfi/option.h"
 
 
 namespace pyfi::option {
 
-    inline double Phi(const double x) {
-        static const boost::math::normal Z(0.0, 1.0);
-        return boost::math::cdf(Z, x);
-    }
-
-    inline double black_scholes_x(const double stock_price,
+    double black_scholes_x(const double stock_price,
         const double strike_price,
         const double volatility,
         const double risk_free_rate,
@@ -33,15 +31,8 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double time,
         const double yield_curve) {
-        if (volatility < 1e-9 || time < 1e-9) {
-            throw std::invalid_argument("Time or volatility cannot be zero");
-        }
-
-        const auto x = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time, yield_curve);
-        const auto s_phi = stock_price * Phi(x);
-        const auto k_phi = strike_price * std::exp(-(risk_free_rate * time)) * Phi(x - volatility * std::sqrt(time));
-
-        return s_phi - k_phi;
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, yield_curve)
+            .price(option_type::call);
     }
 
     double black_scholes_put(const double stock_price,
@@ -50,16 +41,8 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double time,
         const double yield_curve) {
-        if (volatility < 1e-9 || time < 1e-9) {
-            throw std::invalid_argument("Time or volatility cannot be zero");
-        }
-
-        const double sqrtT = std::sqrt(time);
-        const double d1 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time, yield_curve);
-        const double d2 = d1 - volatility * sqrtT;
-
-        const double pvK = strike_price * std::exp(-risk_free_rate * time);
-        return pvK * Phi(-d2) - stock_price * Phi(-d1);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, yield_curve)
+            .price(option_type::put);
     }
 
 
@@ -163,6 +146,69 @@ namespace pyfi::option {
         return options[0];
     }
 
+    using binomial_pricer = double (*)(double, double, double, double, int, double, payoff_func);
+
+    static binomial_estimate adaptive_binomial(const binomial_pricer pricer,
+        const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const payoff_func payoff,
+        const binomial_tolerance& tolerance) {
+        if (!(tolerance.tolerance > 0.0)) {
+            throw std::invalid_argument("tolerance must be positive");
+        }
+        if (tolerance.min_steps < 1 || tolerance.max_steps < tolerance.min_steps) {
+            throw std::invalid_argument("steps must satisfy 1 <= min_steps <= max_steps");
+        }
+        // the n and n + 1 step trees straddle the odd-even oscillation of the lattice
+        const auto level = [&](const int steps) {
+            return 0.5 * (pricer(stock_price, strike_price, volatility, risk_free_rate, steps, time, payoff) +
+                pricer(stock_price, strike_price, volatility, risk_free_rate, steps + 1, time, payoff));
+        };
+
+        int steps = tolerance.min_steps;
+        double price = level(steps);
+        double error = std::numeric_limits<double>::infinity();
+        double last_difference = std::numeric_limits<double>::infinity();
+        while (steps <= tolerance.max_steps / 2) {
+            steps *= 2;
+            const double finer = level(steps);
+            const double difference = std::abs(finer - price);
+            // a lucky crossing of two oscillating levels must not stop the search on its own
+            error = std::max(difference, 0.5 * last_difference);
+            last_difference = difference;
+            price = finer;
+            if (error <= tolerance.tolerance) {
+                return {price, error, steps, true};
+            }
+        }
+        return {price, error, steps, false};
+    }
+
+    binomial_estimate binomial_eu_option_adaptive(const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const payoff_func payoff,
+        const binomial_tolerance& tolerance) {
+        return adaptive_binomial(
+            &binomial_eu_option, stock_price, strike_price, volatility, risk_free_rate, time, payoff, tolerance);
+    }
+
+    binomial_estimate binomial_us_option_adaptive(const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const payoff_func payoff,
+        const binomial_tolerance& tolerance) {
+        return adaptive_binomial(
+            &binomial_us_option, stock_price, strike_price, volatility, risk_free_rate, time, payoff, tolerance);
+    }
+
     double forward_from_yield(const double spot_price,
         const double risk_free_rate,
         const double time,
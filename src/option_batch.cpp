@@ -0,0 +1,318 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <cmath>
+#include <stdexcept>
+
+#include "../include/pyfi/option.h"
+#include "../include/pyfi/profile.h"
+#include "../include/pyfi/simd.h"
+#include "../include/pyfi/trace.h"
+
+namespace pyfi::option {
+
+    std::size_t option_batch::size() const {
+        const auto n = stock_price.size();
+        if (strike_price.size() != n || volatility.size() != n || risk_free_rate.size() != n || time.size() != n ||
+            yield_curve.size() != n) {
+            throw std::invalid_argument("option_batch columns must have the same length");
+        }
+        return n;
+    }
+
+    option_batch option_batch::slice(const std::size_t offset, const std::size_t count) const {
+        if (offset + count > size()) {
+            throw std::invalid_argument("option_batch slice out of range");
+        }
+        return {stock_price.subspan(offset, count),
+            strike_price.subspan(offset, count),
+            volatility.subspan(offset, count),
+            risk_free_rate.subspan(offset, count),
+            time.subspan(offset, count),
+            yield_curve.subspan(offset, count)};
+    }
+
+    static std::size_t checked_size(const option_batch& batch, const std::span<double> out) {
+        const auto n = batch.size();
+        if (out.size() != n) {
+            throw std::invalid_argument("output size must match the batch size");
+        }
+        return n;
+    }
+
+    // prefetches row i + distance of every input column, once per cache line of rows
+    static void prefetch_ahead(const option_batch& batch,
+        const std::size_t i,
+        const std::size_t n,
+        const std::size_t distance) {
+        const auto ahead = i + distance;
+        if (distance == 0 || ahead >= n || ahead % memory::line_doubles != 0) {
+            return;
+        }
+        memory::prefetch(&batch.stock_price[ahead]);
+        memory::prefetch(&batch.strike_price[ahead]);
+        memory::prefetch(&batch.volatility[ahead]);
+        memory::prefetch(&batch.risk_free_rate[ahead]);
+        memory::prefetch(&batch.time[ahead]);
+        memory::prefetch(&batch.yield_curve[ahead]);
+    }
+
+    namespace {
+        // the simd.h functions for bs_terms<simd::pack<W>>::evaluate, where the tail choice is made per lane
+        template <std::size_t W>
+        struct pack_math {
+            using pack = simd::pack<W>;
+
+            static pack sqrt(const pack& x) {
+                return simd::sqrt<W>(x);
+            }
+
+            static pack log(const pack& x) {
+                return simd::log<W>(x);
+            }
+
+            static pack exp(const pack& x) {
+                return simd::exp<W>(x);
+            }
+
+            static pack norm_pdf(const pack& x) {
+                return simd::norm_pdf<W>(x);
+            }
+
+            static pack Phi(const pack& x) {
+                return simd::Phi<W>(x);
+            }
+
+            static pack abs(const pack& x) {
+                return simd::abs<W>(x);
+            }
+
+            static pack select(const simd::mask<W>& condition, const pack& if_true, const pack& if_false) {
+                return simd::select<W>(condition, if_true, if_false);
+            }
+
+            static bool any_of(const simd::mask<W>& condition) {
+                return simd::any_of<W>(condition);
+            }
+        };
+
+        // bs_kernel on a pack of W contracts: the same bs_terms, evaluated with the pack functions of simd.h
+        template <std::size_t W>
+        struct bs_pack : bs_terms<simd::pack<W>> {
+            bs_pack(const option_batch& batch, const std::size_t i) {
+                this->stock_price = simd::load<W>(&batch.stock_price[i]);
+                this->strike_price = simd::load<W>(&batch.strike_price[i]);
+                this->volatility = simd::load<W>(&batch.volatility[i]);
+                this->risk_free_rate = simd::load<W>(&batch.risk_free_rate[i]);
+                this->cost_of_carry = this->risk_free_rate - simd::load<W>(&batch.yield_curve[i]);
+                this->time = simd::load<W>(&batch.time[i]);
+                this->template evaluate<pack_math<W>>();
+            }
+        };
+    } // namespace
+
+    static bs_kernel row_kernel(const option_batch& batch, const std::size_t i) {
+        return {batch.stock_price[i],
+            batch.strike_price[i],
+            batch.volatility[i],
+            batch.risk_free_rate[i],
+            batch.time[i],
+            batch.yield_curve[i]};
+    }
+
+    // prefetches for rows [i, i + W), which crosses at most one prefetch point per input line
+    template <std::size_t W>
+    static void prefetch_pack(const option_batch& batch,
+        const std::size_t i,
+        const std::size_t n,
+        const std::size_t distance) {
+        for (std::size_t j = i; j < i + W; ++j) {
+            prefetch_ahead(batch, j, n, distance);
+        }
+    }
+
+    // the first n - n % W rows in packs of W, the rest one by one with bs_kernel
+    template <option_type Type, bool Streaming, std::size_t W>
+    static void price_loop(const option_batch& batch, const std::span<double> out, const std::size_t distance) {
+        const auto n = out.size();
+        std::size_t i = 0;
+        if constexpr (W > 1) {
+            for (; i + W <= n; i += W) {
+                prefetch_pack<W>(batch, i, n, distance);
+                simd::store<Streaming, W>(&out[i], bs_pack<W>(batch, i).price(Type));
+            }
+        }
+        for (; i < n; ++i) {
+            prefetch_ahead(batch, i, n, distance);
+            memory::store<Streaming>(&out[i], row_kernel(batch, i).price(Type));
+        }
+    }
+
+    // each width is its own instantiation, so the pack operations inline into straight vector code for it
+    template <option_type Type, bool Streaming>
+    static void price_lanes(const option_batch& batch, const std::span<double> out, const memory::access_hints& hints) {
+        const auto distance = hints.prefetch_distance;
+        switch (hints.lanes) {
+        case 1:
+            return price_loop<Type, Streaming, 1>(batch, out, distance);
+        case 4:
+            return price_loop<Type, Streaming, 4>(batch, out, distance);
+        case 8:
+            return price_loop<Type, Streaming, 8>(batch, out, distance);
+        case 16:
+            return price_loop<Type, Streaming, 16>(batch, out, distance);
+        default:
+            throw std::invalid_argument("lanes must be 1, 4, 8 or 16");
+        }
+    }
+
+    template <option_type Type>
+    static void price_pass(const option_batch& batch, const std::span<double> out, const memory::access_hints& hints) {
+        checked_size(batch, out);
+        if (hints.streaming_stores) {
+            const memory::fence_guard fence;
+            price_lanes<Type, true>(batch, out, hints);
+        } else {
+            price_lanes<Type, false>(batch, out, hints);
+        }
+    }
+
+    void black_scholes_call_batch(const option_batch& batch,
+        const std::span<double> out,
+        const memory::access_hints& hints) {
+        const profile::scope scope("option.black_scholes_call_batch", batch.size());
+        const trace::span span("option.black_scholes_call_batch", "pricing", batch.size());
+        price_pass<option_type::call>(batch, out, hints);
+    }
+
+    void black_scholes_put_batch(const option_batch& batch,
+        const std::span<double> out,
+        const memory::access_hints& hints) {
+        const profile::scope scope("option.black_scholes_put_batch", batch.size());
+        const trace::span span("option.black_scholes_put_batch", "pricing", batch.size());
+        price_pass<option_type::put>(batch, out, hints);
+    }
+
+    // writes the requested columns of rows [i, i + W) from a bs_kernel or a bs_pack<W>
+    template <option_type Type, bool Streaming, std::size_t W, typename Kernel>
+    static void store_greeks(const greeks_batch& out, const std::size_t i, const Kernel& k) {
+        const auto store = [](double* address, const auto& value) {
+            if constexpr (W == 1) {
+                memory::store<Streaming>(address, value);
+            } else {
+                simd::store<Streaming, W>(address, value);
+            }
+        };
+        if (!out.price.empty()) {
+            store(&out.price[i], k.price(Type));
+        }
+        if (!out.delta.empty()) {
+            store(&out.delta[i], k.delta(Type));
+        }
+        if (!out.gamma.empty()) {
+            store(&out.gamma[i], k.gamma());
+        }
+        if (!out.theta.empty()) {
+            store(&out.theta[i], k.theta(Type));
+        }
+        if (!out.vega.empty()) {
+            store(&out.vega[i], k.vega());
+        }
+        if (!out.rho.empty()) {
+            store(&out.rho[i], k.rho(Type));
+        }
+        if (!out.vanna.empty()) {
+            store(&out.vanna[i], k.vanna());
+        }
+        if (!out.volga.empty()) {
+            store(&out.volga[i], k.volga());
+        }
+        if (!out.charm.empty()) {
+            store(&out.charm[i], k.charm(Type));
+        }
+        if (!out.speed.empty()) {
+            store(&out.speed[i], k.speed());
+        }
+        if (!out.color.empty()) {
+            store(&out.color[i], k.color());
+        }
+    }
+
+    template <option_type Type, bool Streaming, std::size_t W>
+    static void greeks_loop(const option_batch& batch, const greeks_batch& out, const std::size_t distance) {
+        const auto n = batch.size();
+        std::size_t i = 0;
+        if constexpr (W > 1) {
+            for (; i + W <= n; i += W) {
+                prefetch_pack<W>(batch, i, n, distance);
+                store_greeks<Type, Streaming, W>(out, i, bs_pack<W>(batch, i));
+            }
+        }
+        for (; i < n; ++i) {
+            prefetch_ahead(batch, i, n, distance);
+            store_greeks<Type, Streaming, 1>(out, i, row_kernel(batch, i));
+        }
+    }
+
+    template <option_type Type, bool Streaming>
+    static void greeks_lanes(const option_batch& batch, const greeks_batch& out, const memory::access_hints& hints) {
+        const auto distance = hints.prefetch_distance;
+        switch (hints.lanes) {
+        case 1:
+            return greeks_loop<Type, Streaming, 1>(batch, out, distance);
+        case 4:
+            return greeks_loop<Type, Streaming, 4>(batch, out, distance);
+        case 8:
+            return greeks_loop<Type, Streaming, 8>(batch, out, distance);
+        case 16:
+            return greeks_loop<Type, Streaming, 16>(batch, out, distance);
+        default:
+            throw std::invalid_argument("lanes must be 1, 4, 8 or 16");
+        }
+    }
+
+    template <option_type Type>
+    static void greeks_pass(const option_batch& batch, const greeks_batch& out, const memory::access_hints& hints) {
+        const auto n = batch.size();
+        for (const auto column : {out.price,
+                 out.delta,
+                 out.gamma,
+                 out.theta,
+                 out.vega,
+                 out.rho,
+                 out.vanna,
+                 out.volga,
+                 out.charm,
+                 out.speed,
+                 out.color}) {
+            if (!column.empty() && column.size() != n) {
+                throw std::invalid_argument("output size must match the batch size");
+            }
+        }
+
+        if (hints.streaming_stores) {
+            const memory::fence_guard fence;
+            greeks_lanes<Type, true>(batch, out, hints);
+        } else {
+            greeks_lanes<Type, false>(batch, out, hints);
+        }
+    }
+
+    void black_scholes_call_greeks_batch(const option_batch& batch,
+        const greeks_batch& out,
+        const memory::access_hints& hints) {
+        const profile::scope scope("option.black_scholes_call_greeks_batch", batch.size());
+        const trace::span span("option.black_scholes_call_greeks_batch", "greeks", batch.size());
+        greeks_pass<option_type::call>(batch, out, hints);
+    }
+
+    void black_scholes_put_greeks_batch(const option_batch& batch,
+        const greeks_batch& out,
+        const memory::access_hints& hints) {
+        const profile::scope scope("option.black_scholes_put_greeks_batch", batch.size());
+        const trace::span span("option.black_scholes_put_greeks_batch", "greeks", batch.size());
+        greeks_pass<option_type::put>(batch, out, hints);
+    }
+
+} // namespace pyfi::option
@@ -3,6 +3,7 @@
 //
 
 #include <math.h>
+#include <stdexcept>
 #include "../include/pyfi/option.h"
 
 namespace pyfi::option {
@@ -17,13 +18,77 @@ namespace pyfi::option {
         return inv_sqrt_2pi * std::exp(-0.5 * x * x);
     }
 
-    double norm_pdf(const double x) {
-        const double inv_sqrt_2pi = 1.0 / std::sqrt(2.0 * M_PI);
-        return inv_sqrt_2pi * std::exp(-0.5 * x * x);
+    namespace {
+        // the standard library functions for bs_terms<double>::evaluate
+        struct scalar_math {
+            static double sqrt(const double x) {
+                return std::sqrt(x);
+            }
+
+            static double log(const double x) {
+                return std::log(x);
+            }
+
+            static double exp(const double x) {
+                return std::exp(x);
+            }
+
+            static double norm_pdf(const double x) {
+                return option::norm_pdf(x);
+            }
+
+            static double Phi(const double x) {
+                return option::Phi(x);
+            }
+
+            static double abs(const double x) {
+                return std::abs(x);
+            }
+
+            static double select(const bool condition, const double if_true, const double if_false) {
+                return condition ? if_true : if_false;
+            }
+
+            static bool any_of(const bool condition) {
+                return condition;
+            }
+        };
+    } // namespace
+
+    bs_kernel::bs_kernel(const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const double dividend_yield) {
+        this->stock_price = stock_price;
+        this->strike_price = strike_price;
+        this->volatility = volatility;
+        this->risk_free_rate = risk_free_rate;
+        this->cost_of_carry = risk_free_rate - dividend_yield;
+        this->time = time;
+        evaluate();
+    }
+
+    bs_kernel bs_kernel::with_carry(const double stock_price,
+        const double strike_price,
+        const double volatility,
+        const double risk_free_rate,
+        const double time,
+        const double cost_of_carry) {
+        bs_kernel kernel;
+        kernel.stock_price = stock_price;
+        kernel.strike_price = strike_price;
+        kernel.volatility = volatility;
+        kernel.risk_free_rate = risk_free_rate;
+        kernel.cost_of_carry = cost_of_carry;
+        kernel.time = time;
+        kernel.evaluate();
+        return kernel;
     }
 
-    inline double norm_cdf(const double x) {
-        return 0.5 * (1.0 + std::erf(x / std::sqrt(2.0)));
+    void bs_kernel::evaluate() {
+        bs_terms::evaluate<scalar_math>();
     }
 
     double bs_call_delta(const double stock_price,
@@ -32,8 +97,8 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double dividend_yield,
         const double time) {
-        const double d1 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time);
-        return std::exp(-dividend_yield * time) * norm_cdf(d1);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield)
+            .delta(option_type::call);
     }
 
     double bs_put_delta(const double stock_price,
@@ -42,9 +107,8 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double dividend_yield,
         const double time) {
-
-        const double d1 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time);
-        return std::exp(-dividend_yield * time) * norm_cdf(d1);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield)
+            .delta(option_type::put);
     }
 
     double bs_gamma(const double stock_price,
@@ -53,9 +117,7 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double dividend_yield,
         const double time) {
-
-        const double d1 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time);
-        return std::exp(-dividend_yield * time) * (norm_pdf(d1) - 1.0);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield).gamma();
     }
 
     double bs_call_theta(const double stock_price,
@@ -64,19 +126,8 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double dividend_yield,
         const double time) {
-
-        const auto x1 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time);
-        const auto x2 = x1 - volatility * std::pow(time, 1 / 2);
-        const auto n_x1 = norm_pdf(x1);
-        const auto n_x2 = norm_pdf(x2);
-
-        const auto right_side = (risk_free_rate * stock_price * std::exp(-(risk_free_rate * time)) * n_x2) +
-            (dividend_yield * strike_price * std::exp(-(dividend_yield * time)) * n_x1);
-
-        const auto neg_fraction =
-            -((stock_price * volatility * std::exp(-(dividend_yield * time))) / (2 * std::sqrt(time)) * n_x1);
-
-        return 1.0 / time * (neg_fraction - right_side);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield)
+            .theta(option_type::call);
     }
 
     double bs_put_theta(const double stock_price,
@@ -85,19 +136,8 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double dividend_yield,
         const double time) {
-
-        const auto x1 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time);
-        const auto x2 = x1 - volatility * std::pow(time, 1 / 2);
-        const auto n_x1 = norm_pdf(x1);
-        const auto n_x2 = norm_pdf(x2);
-
-        const auto right_side = (risk_free_rate * stock_price * std::exp(-(risk_free_rate * time)) * n_x2) +
-            (dividend_yield * strike_price * std::exp(-(dividend_yield * time)) * n_x1);
-
-        const auto neg_fraction =
-            -((stock_price * volatility * std::exp(-(dividend_yield * time))) / (2 * std::sqrt(time)) * n_x1);
-
-        return 1.0 / time * (neg_fraction - right_side);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield)
+            .theta(option_type::put);
     }
 
     double bs_vega(const double stock_price,
@@ -106,38 +146,27 @@ namespace pyfi::option {
         const double risk_free_rate,
         const double dividend_yield,
         const double time) {
-        const auto n_x1 = norm_pdf(stock_price, strike_price, volatility, risk_free_rate, time);
-        const auto expo = std::exp(-(dividend_yield * time));
-
-        return 1.0 / 100 * stock_price * expo * std::sqrt(time) * n_x1;
-    }
-
-    inline double
-    bs_rho_calculation(const double strike_price, const double risk_free_rate, const double time, const double x2) {
-        return 1.0 / 100 * strike_price * time * std::exp(-(risk_free_rate * time)) * x2;
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield).vega();
     }
 
     double bs_call_rho(const double stock_price,
         const double strike_price,
         const double volatility,
         const double risk_free_rate,
+        const double dividend_yield,
         const double time) {
-        const auto x2 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time) -
-            risk_free_rate * std::sqrt(time);
-
-        return bs_rho_calculation(strike_price, risk_free_rate, time, x2);
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield)
+            .rho(option_type::call);
     }
 
     double bs_put_rho(const double stock_price,
         const double strike_price,
         const double volatility,
         const double risk_free_rate,
+        const double dividend_yield,
         const double time) {
-
-        const auto x2 = black_scholes_x(stock_price, strike_price, volatility, risk_free_rate, time) -
-            risk_free_rate * std::sqrt(time);
-
-        return (-1 * bs_rho_calculation(strike_price, risk_free_rate, time, -x2));
+        return bs_kernel(stock_price, strike_price, volatility, risk_free_rate, time, dividend_yield)
+            .rho(option_type::put);
     }
 
 } // namespace pyfi::option
@@ -0,0 +1,129 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "../include/pyfi/option.h"
+#include "../include/pyfi/profile.h"
+#include "../include/pyfi/trace.h"
+
+namespace pyfi::option {
+
+    static constexpr double min_volatility = 1e-6;
+    static constexpr double max_volatility = 10.0;
+
+    // Inverts the undiscounted Black price of an out of the money option. Newton on vega inside a bracket that every
+    // evaluation tightens; a step that leaves the bracket or a vanishing vega falls back to bisection.
+    static double solve_black(const double price,
+        const double forward,
+        const double strike,
+        const double time,
+        const option_type type,
+        const double guess) {
+        const double ceiling = type == option_type::call ? forward : strike;
+        if (!(price > 0.0) || !(price < ceiling)) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double low = min_volatility;
+        double high = max_volatility;
+        if (bs_kernel::with_carry(forward, strike, high, 0.0, time, 0.0).price(type) < price) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        // Brenner-Subrahmanyam at the money approximation when no usable guess is given
+        double sigma = guess > low && guess < high ? guess
+                                                   : std::clamp(std::sqrt(2.0 * M_PI / time) * price / forward, 0.01, 2.0);
+        for (int iteration = 0; iteration < 100; ++iteration) {
+            const auto kernel = bs_kernel::with_carry(forward, strike, sigma, 0.0, time, 0.0);
+            const double error = kernel.price(type) - price;
+            if (std::abs(error) <= 1e-13 * price) {
+                return sigma;
+            }
+            if (error > 0.0) {
+                high = sigma;
+            } else {
+                low = sigma;
+            }
+            const double vega = kernel.vega();
+            double next = sigma - error / vega;
+            if (!(vega > 0.0) || !(next > low && next < high)) {
+                next = 0.5 * (low + high);
+            }
+            if (std::abs(next - sigma) <= 1e-15 * sigma) {
+                return next;
+            }
+            sigma = next;
+        }
+        return sigma;
+    }
+
+    static double implied_or_nan(const double price,
+        const double stock_price,
+        const double strike_price,
+        const double risk_free_rate,
+        const double time,
+        const double yield_curve,
+        const option_type type,
+        const double guess) {
+        if (!(stock_price > 0.0) || !(strike_price > 0.0) || !(time > 0.0)) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        const double discount = std::exp(-risk_free_rate * time);
+        const double forward = stock_price * std::exp((risk_free_rate - yield_curve) * time);
+        const double undiscounted = price / discount;
+
+        // C - P = F - K on the forward, so either side can be quoted as the out of the money one
+        if (strike_price >= forward) {
+            const double call = type == option_type::call ? undiscounted : undiscounted + forward - strike_price;
+            return solve_black(call, forward, strike_price, time, option_type::call, guess);
+        }
+        const double put = type == option_type::put ? undiscounted : undiscounted - forward + strike_price;
+        return solve_black(put, forward, strike_price, time, option_type::put, guess);
+    }
+
+    double implied_volatility(const double price,
+        const double stock_price,
+        const double strike_price,
+        const double risk_free_rate,
+        const double time,
+        const double yield_curve,
+        const option_type type) {
+        if (!(stock_price > 0.0) || !(strike_price > 0.0) || !(time > 0.0)) {
+            throw std::invalid_argument("spot, strike and time must be positive");
+        }
+        const double sigma =
+            implied_or_nan(price, stock_price, strike_price, risk_free_rate, time, yield_curve, type, 0.0);
+        if (std::isnan(sigma)) {
+            throw std::invalid_argument("price is outside the no-arbitrage bounds");
+        }
+        return sigma;
+    }
+
+    void implied_volatility_batch(const std::span<const double> price,
+        const option_batch& batch,
+        const option_type type,
+        const std::span<double> out) {
+        const auto n = batch.size();
+        const profile::scope scope("option.implied_volatility_batch", n);
+        const trace::span span("option.implied_volatility_batch", "implied", n);
+        if (price.size() != n || out.size() != n) {
+            throw std::invalid_argument("output size must match the batch size");
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = implied_or_nan(price[i],
+                batch.stock_price[i],
+                batch.strike_price[i],
+                batch.risk_free_rate[i],
+                batch.time[i],
+                batch.yield_curve[i],
+                type,
+                batch.volatility[i]);
+        }
+    }
+
+} // namespace pyfi::option
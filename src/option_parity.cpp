@@ -0,0 +1,238 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/pyfi/option.h"
+#include "../include/pyfi/profile.h"
+#include "../include/pyfi/trace.h"
+#include "../include/pyfi/parallel.h"
+
+namespace pyfi::option {
+
+    std::size_t parity_chain::size() const {
+        const auto n = underlying.size();
+        if (time.size() != n || strike_price.size() != n || call_price.size() != n || put_price.size() != n) {
+            throw std::invalid_argument("parity_chain columns must have the same length");
+        }
+        return n;
+    }
+
+    // Huber tuning constant, 95% efficient when the residuals are normal
+    static constexpr double huber_k = 1.345;
+
+    static double median_abs(std::vector<double> values) {
+        for (auto& v : values) {
+            v = std::abs(v);
+        }
+        const auto mid = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        std::nth_element(values.begin(), mid, values.end());
+        if (values.size() % 2 == 1) {
+            return *mid;
+        }
+        return 0.5 * (*mid + *std::max_element(values.begin(), mid));
+    }
+
+    // Fits C - P = a + b K by iteratively reweighted least squares with Huber weights, so pairs whose residual is
+    // beyond huber_k robust standard deviations get a weight inversely proportional to it.
+    carry_point implied_carry(const std::span<const double> strike_price,
+        const std::span<const double> call_price,
+        const std::span<const double> put_price,
+        const double spot,
+        const double time) {
+        const auto n = strike_price.size();
+        if (call_price.size() != n || put_price.size() != n) {
+            throw std::invalid_argument("strike, call and put columns must have the same length");
+        }
+        if (!(spot > 0.0) || !(time > 0.0)) {
+            throw std::invalid_argument("spot price and time must be positive");
+        }
+        if (n < 2 || std::all_of(strike_price.begin(), strike_price.end(), [&](const double k) {
+                return k == strike_price.front();
+            })) {
+            throw std::invalid_argument("put-call parity needs at least two distinct strikes");
+        }
+
+        std::vector<double> spread(n), weight(n, 1.0), residual(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            spread[i] = call_price[i] - put_price[i];
+        }
+
+        double intercept = 0.0;
+        double slope = 0.0;
+        double scale = 0.0;
+        for (int iteration = 0; iteration < 50; ++iteration) {
+            double sum_w = 0.0, mean_k = 0.0, mean_y = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                sum_w += weight[i];
+                mean_k += weight[i] * strike_price[i];
+                mean_y += weight[i] * spread[i];
+            }
+            mean_k /= sum_w;
+            mean_y /= sum_w;
+
+            double s_kk = 0.0, s_ky = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const double dk = strike_price[i] - mean_k;
+                s_kk += weight[i] * dk * dk;
+                s_ky += weight[i] * dk * (spread[i] - mean_y);
+            }
+            const double previous = slope;
+            slope = s_ky / s_kk;
+            intercept = mean_y - slope * mean_k;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                residual[i] = spread[i] - intercept - slope * strike_price[i];
+            }
+            // MAD scale, 1.4826 makes it a standard deviation for normal residuals
+            scale = 1.4826 * median_abs(residual);
+            if (scale <= 1e-12 * (std::abs(mean_y) + 1.0) ||
+                (iteration > 0 && std::abs(slope - previous) <= 1e-12 * std::abs(slope))) {
+                break;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                const double r = std::abs(residual[i]);
+                weight[i] = r <= huber_k * scale ? 1.0 : huber_k * scale / r;
+            }
+        }
+
+        const double discount = -slope;
+        const double forward = intercept / discount;
+        if (!(discount > 0.0) || !(forward > 0.0)) {
+            throw std::invalid_argument(
+                "put-call parity fit gives a non positive discount or forward at time " + std::to_string(time));
+        }
+        const double rate = -std::log(discount) / time;
+        return {0, time, forward, discount, rate, rate - std::log(forward / spot) / time, scale, n};
+    }
+
+    static carry_point fit_expiry(const parity_chain& chain, const std::vector<std::size_t>& rows, const double spot) {
+        std::vector<double> strike, call, put;
+        for (const auto row : rows) {
+            strike.push_back(chain.strike_price[row]);
+            call.push_back(chain.call_price[row]);
+            put.push_back(chain.put_price[row]);
+        }
+        const int id = chain.underlying[rows.front()];
+        try {
+            auto point = implied_carry(strike, call, put, spot, chain.time[rows.front()]);
+            point.underlying = id;
+            return point;
+        } catch (const std::invalid_argument& error) {
+            throw std::invalid_argument(std::string(error.what()) + " for underlying " + std::to_string(id));
+        }
+    }
+
+    std::vector<carry_point> implied_carry_batch(const parity_chain& chain, const std::span<const double> spot) {
+        const auto n = chain.size();
+        const profile::scope scope("option.implied_carry_batch", n);
+        const trace::span span("option.implied_carry_batch", "curve", n);
+
+        // bucket the pairs by underlying so that each underlying is one parallel task
+        std::vector<std::vector<std::size_t>> by_underlying(spot.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            const int id = chain.underlying[i];
+            if (id < 0 || static_cast<std::size_t>(id) >= spot.size()) {
+                throw std::invalid_argument("underlying index out of range: " + std::to_string(id));
+            }
+            if (!(chain.time[i] > 0.0)) {
+                throw std::invalid_argument("time must be positive");
+            }
+            by_underlying[id].push_back(i);
+        }
+
+        std::vector<std::vector<carry_point>> curves(spot.size());
+        parallel::parallel_for(spot.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t u = begin; u < end; ++u) {
+                auto& rows = by_underlying[u];
+                if (rows.empty()) {
+                    continue;
+                }
+                if (!(spot[u] > 0.0)) {
+                    throw std::invalid_argument("spot price must be positive");
+                }
+                std::sort(rows.begin(), rows.end(), [&](const std::size_t a, const std::size_t b) {
+                    return chain.time[a] != chain.time[b] ? chain.time[a] < chain.time[b]
+                                                          : chain.strike_price[a] < chain.strike_price[b];
+                });
+
+                std::vector<std::size_t> expiry;
+                for (std::size_t first = 0; first < rows.size();) {
+                    auto last = first;
+                    while (last < rows.size() && chain.time[rows[last]] == chain.time[rows[first]]) {
+                        ++last;
+                    }
+                    // rows of an expiry are sorted by strike, so distinct strikes differ at the ends
+                    if (chain.strike_price[rows[first]] != chain.strike_price[rows[last - 1]]) {
+                        expiry.assign(rows.begin() + static_cast<std::ptrdiff_t>(first),
+                            rows.begin() + static_cast<std::ptrdiff_t>(last));
+                        curves[u].push_back(fit_expiry(chain, expiry, spot[u]));
+                    }
+                    first = last;
+                }
+            }
+        });
+
+        std::vector<carry_point> points;
+        for (auto& curve : curves) {
+            points.insert(points.end(), curve.begin(), curve.end());
+        }
+        return points;
+    }
+
+    carry_curve::carry_curve(std::vector<carry_point> points) : points_(std::move(points)) {
+        std::sort(points_.begin(), points_.end(), [](const carry_point& a, const carry_point& b) {
+            return a.underlying != b.underlying ? a.underlying < b.underlying : a.time < b.time;
+        });
+    }
+
+    double carry_curve::yield(const int underlying, const double time) const {
+        const auto first = std::lower_bound(points_.begin(),
+            points_.end(),
+            underlying,
+            [](const carry_point& p, const int id) { return p.underlying < id; });
+        const auto last = std::upper_bound(first, points_.end(), underlying, [](const int id, const carry_point& p) {
+            return id < p.underlying;
+        });
+        if (first == last) {
+            throw std::invalid_argument("no carry pillar for underlying " + std::to_string(underlying));
+        }
+        if (time <= first->time) {
+            return first->yield_curve;
+        }
+        if (time >= (last - 1)->time) {
+            return (last - 1)->yield_curve;
+        }
+        const auto upper = std::upper_bound(first, last, time, [](const double t, const carry_point& p) {
+            return t < p.time;
+        });
+        const auto lower = upper - 1;
+        // linear in the total carry q * T, so ln F is linear in time between pillars
+        const double weight = (time - lower->time) / (upper->time - lower->time);
+        const double total = lower->yield_curve * lower->time +
+            weight * (upper->yield_curve * upper->time - lower->yield_curve * lower->time);
+        return total / time;
+    }
+
+    void carry_curve::yield_batch(const std::span<const int> underlying,
+        const std::span<const double> time,
+        const std::span<double> out) const {
+        if (underlying.size() != time.size() || out.size() != time.size()) {
+            throw std::invalid_argument("output size must match the batch size");
+        }
+        for (std::size_t i = 0; i < time.size(); ++i) {
+            out[i] = yield(underlying[i], time[i]);
+        }
+    }
+
+    const std::vector<carry_point>& carry_curve::points() const {
+        return points_;
+    }
+
+} // namespace pyfi::option
@@ -0,0 +1,173 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/parallel.h>
+#include <pyfi/trace.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <string>
+
+namespace pyfi::parallel {
+
+    namespace {
+        // the pool whose chunk this thread is running, so a nested loop on it runs inline instead of waiting on
+        // loop_mutex_, which its own caller holds
+        thread_local const thread_pool* running = nullptr;
+
+        class running_scope {
+        public:
+            explicit running_scope(const thread_pool* pool) : outer_(running) {
+                running = pool;
+            }
+
+            running_scope(const running_scope&) = delete;
+            running_scope& operator=(const running_scope&) = delete;
+
+            ~running_scope() {
+                running = outer_;
+            }
+
+        private:
+            const thread_pool* outer_;
+        };
+    } // namespace
+
+    struct thread_pool::job {
+        std::size_t n;
+        std::size_t grain;
+        const range_func* body;
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+    };
+
+    thread_pool::thread_pool(std::size_t threads) {
+        if (threads == 0) {
+            threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+        workers_.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i) {
+            workers_.emplace_back([this, i] {
+                trace::set_thread_name("pool worker " + std::to_string(i));
+                worker_loop();
+            });
+        }
+    }
+
+    thread_pool::~thread_pool() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    std::size_t thread_pool::size() const {
+        return workers_.size() + 1;
+    }
+
+    void thread_pool::work(job& current) {
+        const running_scope scope(this);
+        while (!current.failed.load(std::memory_order_relaxed)) {
+            const auto begin = current.next.fetch_add(current.grain, std::memory_order_relaxed);
+            if (begin >= current.n) {
+                return;
+            }
+            const auto end = std::min(current.n, begin + current.grain);
+            try {
+                const trace::span span("parallel_for.chunk", "pool", end - begin);
+                (*current.body)(begin, end);
+            } catch (...) {
+                std::lock_guard lock(current.error_mutex);
+                if (!current.error) {
+                    current.error = std::current_exception();
+                }
+                current.failed = true;
+            }
+        }
+    }
+
+    void thread_pool::worker_loop() {
+        std::size_t seen = 0;
+        while (true) {
+            job* current = nullptr;
+            {
+                std::unique_lock lock(mutex_);
+                wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                if (stopping_) {
+                    return;
+                }
+                seen = generation_;
+                current = job_;
+                if (current == nullptr) {
+                    continue; // woke after the loop already finished
+                }
+                ++busy_;
+            }
+            work(*current);
+            {
+                std::lock_guard lock(mutex_);
+                --busy_;
+            }
+            done_.notify_all();
+        }
+    }
+
+    void thread_pool::parallel_for(const std::size_t n, std::size_t grain, const range_func& body) {
+        if (n == 0) {
+            return;
+        }
+        if (grain == 0) {
+            grain = (n + size() - 1) / size();
+        }
+        if (workers_.empty() || grain >= n || running == this) {
+            for (std::size_t begin = 0; begin < n; begin += grain) {
+                body(begin, std::min(n, begin + grain));
+            }
+            return;
+        }
+
+        std::lock_guard loop_lock(loop_mutex_);
+        const trace::span span("parallel_for", "pool", n);
+        job current{};
+        current.n = n;
+        current.grain = grain;
+        current.body = &body;
+        {
+            std::lock_guard lock(mutex_);
+            job_ = &current;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        work(current);
+
+        {
+            // workers that never picked the job up see an exhausted counter and leave at once
+            std::unique_lock lock(mutex_);
+            done_.wait(lock, [&] { return busy_ == 0; });
+            job_ = nullptr;
+        }
+
+        if (current.error) {
+            std::rethrow_exception(current.error);
+        }
+    }
+
+    thread_pool& default_pool() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    void parallel_for(const std::size_t n, const std::size_t grain, const range_func& body) {
+        default_pool().parallel_for(n, grain, body);
+    }
+
+} // namespace pyfi::parallel
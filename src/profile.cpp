@@ -0,0 +1,259 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/profile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pyfi::profile {
+
+    namespace {
+        std::atomic<int> open_sessions{0};
+
+        std::mutex registry_mutex;
+        std::map<std::string, counters, std::less<>> registry;
+
+        std::vector<entry> snapshot() {
+            std::lock_guard lock(registry_mutex);
+            std::vector<entry> out;
+            out.reserve(registry.size());
+            for (const auto& [name, totals] : registry) {
+                out.push_back({name, totals});
+            }
+            return out;
+        }
+
+#if defined(__linux__)
+        // one counter group per thread, opened the first time the thread is profiled and closed when it exits
+        class thread_events {
+        public:
+            thread_events() {
+                constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, event_count> config{{
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                }};
+                for (std::size_t i = 0; i < event_count; ++i) {
+                    perf_event_attr attr{};
+                    attr.size = sizeof(attr);
+                    attr.type = config[i].first;
+                    attr.config = config[i].second;
+                    attr.read_format =
+                        PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    const int leader = i == 0 ? -1 : fds_[0];
+                    fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0));
+                    if (fds_[i] < 0) {
+                        // all or nothing, so every call that has events has all of them
+                        release();
+                        return;
+                    }
+                }
+            }
+
+            thread_events(const thread_events&) = delete;
+            thread_events& operator=(const thread_events&) = delete;
+
+            ~thread_events() {
+                release();
+            }
+
+            // events, then time enabled and time running
+            bool read(std::array<std::uint64_t, event_count + 2>& out) const {
+                if (fds_[0] < 0) {
+                    return false;
+                }
+                std::array<std::uint64_t, event_count + 3> buffer{};
+                const auto bytes = ::read(fds_[0], buffer.data(), sizeof(buffer));
+                if (bytes != static_cast<ssize_t>(sizeof(buffer)) || buffer[0] != event_count) {
+                    return false;
+                }
+                std::copy_n(buffer.begin() + 3, event_count, out.begin());
+                out[event_count] = buffer[1];
+                out[event_count + 1] = buffer[2];
+                return true;
+            }
+
+        private:
+            void release() {
+                for (auto& fd : fds_) {
+                    if (fd >= 0) {
+                        close(fd);
+                        fd = -1;
+                    }
+                }
+            }
+
+            std::array<int, event_count> fds_{-1, -1, -1, -1, -1, -1};
+        };
+
+        bool read_events(std::array<std::uint64_t, event_count + 2>& out) {
+            static thread_local const thread_events events;
+            return events.read(out);
+        }
+#else
+        bool read_events(std::array<std::uint64_t, event_count + 2>&) {
+            return false;
+        }
+#endif
+    } // namespace
+
+    double counters::ipc() const {
+        const auto cycles = (*this)[event::cycles];
+        return cycles == 0 ? 0.0 : static_cast<double>((*this)[event::instructions]) / static_cast<double>(cycles);
+    }
+
+    counters& counters::operator+=(const counters& other) {
+        calls += other.calls;
+        rows += other.rows;
+        seconds += other.seconds;
+        hardware_calls += other.hardware_calls;
+        for (std::size_t i = 0; i < event_count; ++i) {
+            events[i] += other.events[i];
+        }
+        return *this;
+    }
+
+    counters& counters::operator-=(const counters& other) {
+        calls -= other.calls;
+        rows -= other.rows;
+        seconds -= other.seconds;
+        hardware_calls -= other.hardware_calls;
+        for (std::size_t i = 0; i < event_count; ++i) {
+            events[i] -= other.events[i];
+        }
+        return *this;
+    }
+
+    bool enabled() {
+        return open_sessions.load(std::memory_order_relaxed) > 0;
+    }
+
+    bool hardware_available() {
+        std::array<std::uint64_t, event_count + 2> events{};
+        return read_events(events);
+    }
+
+    scope::scope(const std::string_view name, const std::size_t rows) : name_(name), rows_(rows) {
+        if (!enabled()) {
+            return;
+        }
+        active_ = true;
+        hardware_ = read_events(start_events_);
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    scope::~scope() {
+        if (!active_) {
+            return;
+        }
+        const auto end = std::chrono::steady_clock::now();
+        std::array<std::uint64_t, event_count + 2> end_events{};
+        const bool hardware = hardware_ && read_events(end_events);
+
+        counters call;
+        call.calls = 1;
+        call.rows = rows_;
+        call.seconds = std::chrono::duration<double>(end - start_).count();
+        if (hardware) {
+            call.hardware_calls = 1;
+            const auto enabled_time = end_events[event_count] - start_events_[event_count];
+            const auto running_time = end_events[event_count + 1] - start_events_[event_count + 1];
+            // the group was time sliced with other events for part of the call
+            const double scale = running_time > 0 && running_time < enabled_time
+                ? static_cast<double>(enabled_time) / static_cast<double>(running_time)
+                : 1.0;
+            for (std::size_t i = 0; i < event_count; ++i) {
+                const auto delta = static_cast<double>(end_events[i] - start_events_[i]);
+                call.events[i] = static_cast<std::uint64_t>(delta * scale);
+            }
+        }
+
+        std::lock_guard lock(registry_mutex);
+        auto it = registry.find(name_);
+        if (it == registry.end()) {
+            it = registry.emplace(std::string(name_), counters{}).first;
+        }
+        it->second += call;
+    }
+
+    session::session() {
+        baseline_ = snapshot();
+        open_sessions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    session::~session() {
+        open_sessions.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    std::vector<entry> session::results() const {
+        auto current = snapshot();
+        std::vector<entry> out;
+        // both lists are sorted by name and the registry only grows
+        auto base = baseline_.begin();
+        for (auto& [name, totals] : current) {
+            while (base != baseline_.end() && base->name < name) {
+                ++base;
+            }
+            if (base != baseline_.end() && base->name == name) {
+                totals -= base->totals;
+            }
+            if (totals.calls > 0) {
+                out.push_back({std::move(name), totals});
+            }
+        }
+        return out;
+    }
+
+    std::string format(const std::vector<entry>& results) {
+        std::size_t width = 10;
+        for (const auto& e : results) {
+            width = std::max(width, e.name.size() + 2);
+        }
+        std::ostringstream out;
+        out << std::left << std::setw(static_cast<int>(width)) << "function" << std::right << std::setw(10) << "calls"
+            << std::setw(14) << "ns/call" << std::setw(10) << "ns/row" << std::setw(16) << "cycles" << std::setw(7)
+            << "IPC" << std::setw(13) << "cache miss %" << std::setw(14) << "mispredict %" << "\n";
+        for (const auto& [name, totals] : results) {
+            const auto calls = static_cast<double>(totals.calls);
+            out << std::left << std::setw(static_cast<int>(width)) << name << std::right << std::fixed
+                << std::setw(10) << totals.calls << std::setprecision(0) << std::setw(14)
+                << totals.seconds * 1e9 / calls;
+            if (totals.rows > 0) {
+                out << std::setprecision(2) << std::setw(10) << totals.seconds * 1e9 / static_cast<double>(totals.rows);
+            } else {
+                out << std::setw(10) << "-";
+            }
+            if (totals.hardware_calls == 0) {
+                out << std::setw(16) << "n/a" << std::setw(7) << "n/a" << std::setw(13) << "n/a" << std::setw(14)
+                    << "n/a" << "\n";
+                continue;
+            }
+            const auto rate = [](const std::uint64_t part, const std::uint64_t whole) {
+                return whole == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(whole);
+            };
+            out << std::setw(16) << totals[event::cycles] << std::setprecision(2) << std::setw(7) << totals.ipc()
+                << std::setw(13) << rate(totals[event::cache_misses], totals[event::cache_references]) << std::setw(14)
+                << rate(totals[event::branch_misses], totals[event::branches]) << "\n";
+        }
+        return out.str();
+    }
+
+} // namespace pyfi::profile
@@ -0,0 +1,239 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/proxy.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+
+#include <pyfi/parallel.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+namespace pyfi::proxy {
+
+    namespace {
+        constexpr int max_nodes = 64;
+
+        void check_axis(const axis& a) {
+            if (!(a.lower < a.upper)) {
+                throw std::invalid_argument("proxy axis needs lower < upper");
+            }
+            if (a.nodes < 2 || a.nodes > max_nodes) {
+                throw std::invalid_argument("proxy axis needs between 2 and 64 nodes");
+            }
+        }
+
+        // Chebyshev extrema, x_k = cos(pi k / (n - 1)), mapped onto the axis
+        double node(const axis& a, const int k) {
+            const double x = std::cos(std::numbers::pi * k / (a.nodes - 1));
+            return 0.5 * (a.lower + a.upper) + 0.5 * (a.upper - a.lower) * x;
+        }
+
+        // the point on [-1, 1]; a hair outside is rounding and is clamped
+        double to_unit(const axis& a, const double value) {
+            const double x = (2.0 * value - (a.lower + a.upper)) / (a.upper - a.lower);
+            if (!(std::abs(x) <= 1.0 + 1e-12)) {
+                throw std::invalid_argument("point is outside the proxy box");
+            }
+            return std::clamp(x, -1.0, 1.0);
+        }
+
+        void chebyshev_values(const double x, const int n, std::array<double, max_nodes>& out) {
+            out[0] = 1.0;
+            out[1] = x;
+            for (int k = 2; k < n; ++k) {
+                out[k] = 2.0 * x * out[k - 1] - out[k - 2];
+            }
+        }
+
+        // in place DCT-I along one axis of a row major n0 x n1 x n2 tensor, turning samples at the Chebyshev extrema
+        // into the coefficients of the interpolating series
+        void transform(std::vector<double>& values, const std::array<int, 3>& shape, const int dimension) {
+            const int n = shape[dimension];
+            std::vector<double> basis(static_cast<std::size_t>(n) * n);
+            for (int j = 0; j < n; ++j) {
+                for (int k = 0; k < n; ++k) {
+                    const double end_weight = k == 0 || k == n - 1 ? 0.5 : 1.0;
+                    const double scale = j == 0 || j == n - 1 ? 0.5 : 1.0;
+                    basis[j * n + k] =
+                        scale * end_weight * 2.0 / (n - 1) * std::cos(std::numbers::pi * j * k / (n - 1));
+                }
+            }
+
+            std::array<std::size_t, 3> stride{
+                static_cast<std::size_t>(shape[1]) * shape[2], static_cast<std::size_t>(shape[2]), 1};
+            const auto step = stride[dimension];
+            std::vector<double> line(n);
+            for (std::size_t start = 0; start < values.size(); ++start) {
+                // visit each line along the dimension once, from the element whose index on it is 0
+                if (start / step % n != 0) {
+                    continue;
+                }
+                for (int j = 0; j < n; ++j) {
+                    double sum = 0.0;
+                    for (int k = 0; k < n; ++k) {
+                        sum += basis[j * n + k] * values[start + k * step];
+                    }
+                    line[j] = sum;
+                }
+                for (int j = 0; j < n; ++j) {
+                    values[start + j * step] = line[j];
+                }
+            }
+        }
+    } // namespace
+
+    chebyshev_proxy::chebyshev_proxy(const pricer& price, const proxy_config& config) : config_(config) {
+        check_axis(config.spot);
+        check_axis(config.volatility);
+        check_axis(config.time);
+        if (!(config.drop_tolerance >= 0.0)) {
+            throw std::invalid_argument("drop_tolerance must not be negative");
+        }
+        const std::array<int, 3> shape{config.spot.nodes, config.volatility.nodes, config.time.nodes};
+        const auto total = static_cast<std::size_t>(shape[0]) * shape[1] * shape[2];
+        const profile::scope scope("proxy.build", total);
+        const trace::span span("proxy.build", "pricing", total);
+
+        std::vector<double> values(total);
+        parallel::parallel_for(total, 1, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto a = static_cast<int>(i / (shape[1] * shape[2]));
+                const auto b = static_cast<int>(i / shape[2] % shape[1]);
+                const auto c = static_cast<int>(i % shape[2]);
+                values[i] = price(node(config.spot, a), node(config.volatility, b), node(config.time, c));
+            }
+        });
+        for (int dimension = 0; dimension < 3; ++dimension) {
+            transform(values, shape, dimension);
+        }
+
+        // one row per (spot, volatility) order with its time coefficients up to the last one kept, so evaluation is a
+        // contiguous dot product per row
+        std::array<double, 3> tail{};
+        const auto n_time = static_cast<std::size_t>(shape[2]);
+        for (int a = 0; a < shape[0]; ++a) {
+            for (int b = 0; b < shape[1]; ++b) {
+                const auto* row = &values[(static_cast<std::size_t>(a) * shape[1] + b) * n_time];
+                std::size_t length = 0;
+                for (std::size_t c = 0; c < n_time; ++c) {
+                    const double magnitude = std::abs(row[c]);
+                    // the shell of highest orders estimates the truncated tail of the series
+                    if (a == shape[0] - 1) {
+                        tail[0] += magnitude;
+                    }
+                    if (b == shape[1] - 1) {
+                        tail[1] += magnitude;
+                    }
+                    if (c == n_time - 1) {
+                        tail[2] += magnitude;
+                    }
+                    if (magnitude >= config.drop_tolerance) {
+                        length = c + 1;
+                    }
+                }
+                for (std::size_t c = 0; c < n_time; ++c) {
+                    if (c >= length || std::abs(row[c]) < config.drop_tolerance) {
+                        dropped_error_ += std::abs(row[c]);
+                    }
+                }
+                if (length == 0) {
+                    continue;
+                }
+                rows_.push_back({static_cast<std::uint8_t>(a),
+                    static_cast<std::uint8_t>(b),
+                    static_cast<std::uint32_t>(coefficient_.size()),
+                    static_cast<std::uint32_t>(length)});
+                for (std::size_t c = 0; c < length; ++c) {
+                    // small coefficients inside a kept row cost nothing extra to keep, but they are not counted as kept
+                    coefficient_.push_back(std::abs(row[c]) < config.drop_tolerance ? 0.0 : row[c]);
+                }
+            }
+        }
+        truncation_error_ = tail[0] + tail[1] + tail[2];
+    }
+
+    double chebyshev_proxy::evaluate(const double spot, const double volatility, const double time) const {
+        std::array<double, max_nodes> s, v, t;
+        chebyshev_values(to_unit(config_.spot, spot), config_.spot.nodes, s);
+        chebyshev_values(to_unit(config_.volatility, volatility), config_.volatility.nodes, v);
+        chebyshev_values(to_unit(config_.time, time), config_.time.nodes, t);
+
+        double sum = 0.0;
+        for (const auto& r : rows_) {
+            const double* c = &coefficient_[r.offset];
+            // four independent sums, so the adds pipeline instead of waiting on each other
+            std::array<double, 4> dot{};
+            std::uint32_t k = 0;
+            for (; k + 4 <= r.length; k += 4) {
+                dot[0] += c[k] * t[k];
+                dot[1] += c[k + 1] * t[k + 1];
+                dot[2] += c[k + 2] * t[k + 2];
+                dot[3] += c[k + 3] * t[k + 3];
+            }
+            for (; k < r.length; ++k) {
+                dot[0] += c[k] * t[k];
+            }
+            sum += s[r.spot] * v[r.volatility] * ((dot[0] + dot[1]) + (dot[2] + dot[3]));
+        }
+        return sum;
+    }
+
+    double chebyshev_proxy::operator()(const double spot, const double volatility, const double time) const {
+        return evaluate(spot, volatility, time);
+    }
+
+    void chebyshev_proxy::evaluate_batch(const std::span<const double> spot,
+        const std::span<const double> volatility,
+        const std::span<const double> time,
+        const std::span<double> out) const {
+        const auto n = spot.size();
+        if (volatility.size() != n || time.size() != n || out.size() != n) {
+            throw std::invalid_argument("input and output sizes must match");
+        }
+        const profile::scope scope("proxy.evaluate_batch", n);
+        const trace::span span("proxy.evaluate_batch", "pricing", n);
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = evaluate(spot[i], volatility[i], time[i]);
+        }
+    }
+
+    double chebyshev_proxy::error_estimate() const {
+        return truncation_error_ + dropped_error_;
+    }
+
+    double chebyshev_proxy::max_error(const pricer& price, const std::size_t points, const std::uint64_t seed) const {
+        std::mt19937_64 rng(seed);
+        const auto uniform = [&rng](const axis& a) {
+            return std::uniform_real_distribution<double>(a.lower, a.upper)(rng);
+        };
+        std::vector<double> spot(points), volatility(points), time(points), error(points);
+        for (std::size_t i = 0; i < points; ++i) {
+            spot[i] = uniform(config_.spot);
+            volatility[i] = uniform(config_.volatility);
+            time[i] = uniform(config_.time);
+        }
+        parallel::parallel_for(points, 1, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                error[i] = std::abs(price(spot[i], volatility[i], time[i]) - evaluate(spot[i], volatility[i], time[i]));
+            }
+        });
+        return points == 0 ? 0.0 : *std::max_element(error.begin(), error.end());
+    }
+
+    std::size_t chebyshev_proxy::coefficients() const {
+        return static_cast<std::size_t>(
+            std::count_if(coefficient_.begin(), coefficient_.end(), [](const double c) { return c != 0.0; }));
+    }
+
+    const proxy_config& chebyshev_proxy::config() const {
+        return config_;
+    }
+
+} // namespace pyfi::proxy
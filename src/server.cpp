@@ -0,0 +1,467 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/server.h>
+
+#include <pyfi/bond.h>
+#include <pyfi/option.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace pyfi::server {
+
+    namespace {
+        using clock = std::chrono::steady_clock;
+
+        [[noreturn]] void throw_errno(const std::string& what) {
+            throw std::runtime_error(what + ": " + std::strerror(errno));
+        }
+
+        sockaddr_un socket_address(const std::string& path) {
+            sockaddr_un addr{};
+            if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+                throw std::invalid_argument("socket path is empty or too long");
+            }
+            addr.sun_family = AF_UNIX;
+            std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+            return addr;
+        }
+
+        void set_nonblocking(const int fd) {
+            const int flags = fcntl(fd, F_GETFL, 0);
+            if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+                throw_errno("fcntl");
+            }
+        }
+
+        response_status validate(const price_request& request) {
+            switch (request.kind) {
+                case request_kind::call:
+                case request_kind::put:
+                    // same domain as black_scholes_call/put
+                    if (!(request.fields[2] >= 1e-9) || !(request.fields[4] >= 1e-9)) {
+                        return response_status::bad_input;
+                    }
+                    return response_status::ok;
+                case request_kind::bond_dirty:
+                case request_kind::bond_clean:
+                    return request.m > 0 ? response_status::ok : response_status::bad_input;
+            }
+            return response_status::bad_kind;
+        }
+
+        struct connection {
+            std::vector<char> in;
+            std::vector<char> out;
+            std::size_t out_offset = 0;
+        };
+
+        struct pending_request {
+            std::uint64_t connection;
+            price_request request;
+            response_status status;
+        };
+
+        // columns of one request kind, reused between batches
+        struct kind_columns {
+            std::vector<std::size_t> index;
+            std::vector<double> fields[6];
+            std::vector<int> m;
+            std::vector<double> out;
+
+            void clear() {
+                index.clear();
+                for (auto& field : fields) {
+                    field.clear();
+                }
+                m.clear();
+            }
+
+            void push(const std::size_t i, const price_request& request) {
+                index.push_back(i);
+                for (std::size_t f = 0; f < 6; ++f) {
+                    fields[f].push_back(request.fields[f]);
+                }
+                m.push_back(request.m);
+            }
+
+            [[nodiscard]] option::option_batch options() const {
+                return {fields[0], fields[1], fields[2], fields[3], fields[4], fields[5]};
+            }
+
+            [[nodiscard]] bond::bond_batch bonds() const {
+                return {fields[0], fields[1], fields[2], fields[3], m};
+            }
+        };
+    } // namespace
+
+    struct pricing_server::state {
+        std::atomic<bool> stopping{false};
+        std::atomic<std::uint64_t> requests{0};
+        std::atomic<std::uint64_t> batches{0};
+        std::atomic<std::uint64_t> connections{0};
+        std::atomic<std::int64_t> window_us{0};
+
+        std::unordered_map<int, std::uint64_t> fd_to_id;
+        std::unordered_map<std::uint64_t, std::pair<int, connection>> open;
+        std::uint64_t next_id = 0;
+
+        std::vector<pending_request> pending;
+        clock::time_point first_arrival{};
+        clock::time_point last_flush = clock::now();
+        double arrival_rate = 0.0; // requests per microsecond, EWMA
+
+        kind_columns columns[4];
+    };
+
+    pricing_server::pricing_server(server_config config) : config_(std::move(config)) {
+        if (config_.target_batch == 0 || config_.max_batch < config_.target_batch) {
+            throw std::invalid_argument("need 0 < target_batch <= max_batch");
+        }
+        if (config_.min_window.count() < 0 || config_.max_window < config_.min_window) {
+            throw std::invalid_argument("need 0 <= min_window <= max_window");
+        }
+
+        const auto addr = socket_address(config_.socket_path);
+        listen_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd_ < 0) {
+            throw_errno("socket");
+        }
+        ::unlink(config_.socket_path.c_str());
+        if (bind(listen_fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            listen(listen_fd_, SOMAXCONN) != 0 || pipe(wake_fds_) != 0) {
+            const int err = errno;
+            close(listen_fd_);
+            errno = err;
+            throw_errno("bind " + config_.socket_path);
+        }
+        set_nonblocking(listen_fd_);
+        set_nonblocking(wake_fds_[0]);
+
+        state_ = std::make_unique<state>();
+        state_->window_us = config_.min_window.count();
+    }
+
+    pricing_server::~pricing_server() {
+        for (const auto& [id, conn] : state_->open) {
+            close(conn.first);
+        }
+        close(listen_fd_);
+        close(wake_fds_[0]);
+        close(wake_fds_[1]);
+        ::unlink(config_.socket_path.c_str());
+    }
+
+    void pricing_server::stop() const {
+        state_->stopping = true;
+        const char byte = 1;
+        [[maybe_unused]] const auto written = write(wake_fds_[1], &byte, 1);
+    }
+
+    server_stats pricing_server::stats() const {
+        return {state_->requests.load(), state_->batches.load(), state_->connections.load()};
+    }
+
+    std::chrono::microseconds pricing_server::window() const {
+        return std::chrono::microseconds(state_->window_us.load());
+    }
+
+    void pricing_server::run() {
+        auto& s = *state_;
+        std::vector<pollfd> fds;
+
+        const auto close_connection = [&s](const int fd) {
+            const auto it = s.fd_to_id.find(fd);
+            if (it != s.fd_to_id.end()) {
+                s.open.erase(it->second);
+                s.fd_to_id.erase(it);
+            }
+            close(fd);
+        };
+
+        const auto write_out = [&](const int fd, connection& conn) {
+            while (conn.out_offset < conn.out.size()) {
+                const auto n = ::send(fd,
+                    conn.out.data() + conn.out_offset,
+                    conn.out.size() - conn.out_offset,
+                    MSG_NOSIGNAL);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return errno == EAGAIN || errno == EWOULDBLOCK;
+                }
+                conn.out_offset += static_cast<std::size_t>(n);
+            }
+            conn.out.clear();
+            conn.out_offset = 0;
+            return true;
+        };
+
+        const auto flush = [&] {
+            const auto now = clock::now();
+            const auto count = s.pending.size();
+
+            for (auto& columns : s.columns) {
+                columns.clear();
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto& p = s.pending[i];
+                if (p.status == response_status::ok) {
+                    s.columns[static_cast<std::size_t>(p.request.kind)].push(i, p.request);
+                }
+            }
+
+            for (std::size_t k = 0; k < 4; ++k) {
+                auto& columns = s.columns[k];
+                columns.out.resize(columns.index.size());
+                if (columns.index.empty()) {
+                    continue;
+                }
+                switch (static_cast<request_kind>(k)) {
+                    case request_kind::call:
+                        option::black_scholes_call_batch(columns.options(), columns.out);
+                        break;
+                    case request_kind::put:
+                        option::black_scholes_put_batch(columns.options(), columns.out);
+                        break;
+                    case request_kind::bond_dirty:
+                        bond::dirty_coupon_price_from_T_batch(columns.bonds(), columns.out);
+                        break;
+                    case request_kind::bond_clean:
+                        bond::clean_coupon_price_from_T_batch(columns.bonds(), columns.out);
+                        break;
+                }
+            }
+
+            std::vector<double> values(count, std::numeric_limits<double>::quiet_NaN());
+            for (const auto& columns : s.columns) {
+                for (std::size_t j = 0; j < columns.index.size(); ++j) {
+                    values[columns.index[j]] = columns.out[j];
+                }
+            }
+
+            std::vector<std::uint64_t> touched;
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto& p = s.pending[i];
+                const auto it = s.open.find(p.connection);
+                if (it == s.open.end()) {
+                    continue; // client went away
+                }
+                const price_response response{p.request.id, p.status, 0, values[i]};
+                auto& out = it->second.second.out;
+                const auto* bytes = reinterpret_cast<const char*>(&response);
+                out.insert(out.end(), bytes, bytes + sizeof(response));
+                if (touched.empty() || touched.back() != p.connection) {
+                    touched.push_back(p.connection);
+                }
+            }
+            for (const auto id : touched) {
+                const auto it = s.open.find(id);
+                if (it != s.open.end() && !write_out(it->second.first, it->second.second)) {
+                    close_connection(it->second.first);
+                }
+            }
+
+            // adapt the window to the arrival rate seen since the previous flush
+            const auto elapsed = std::chrono::duration<double, std::micro>(now - s.last_flush).count();
+            if (elapsed > 0.0) {
+                const double rate = static_cast<double>(count) / elapsed;
+                s.arrival_rate = s.arrival_rate == 0.0 ? rate : 0.8 * s.arrival_rate + 0.2 * rate;
+            }
+            const auto min_us = static_cast<double>(config_.min_window.count());
+            const auto max_us = static_cast<double>(config_.max_window.count());
+            const double wanted =
+                s.arrival_rate > 0.0 ? static_cast<double>(config_.target_batch) / s.arrival_rate : max_us + 1.0;
+            s.window_us = static_cast<std::int64_t>(wanted > max_us ? min_us : std::max(min_us, wanted));
+            s.last_flush = now;
+
+            s.requests += count;
+            s.batches += 1;
+            s.pending.clear();
+        };
+
+        while (!s.stopping) {
+            fds.clear();
+            fds.push_back({wake_fds_[0], POLLIN, 0});
+            fds.push_back({listen_fd_, POLLIN, 0});
+            for (const auto& [id, conn] : s.open) {
+                const short events = conn.second.out.empty() ? POLLIN : static_cast<short>(POLLIN | POLLOUT);
+                fds.push_back({conn.first, events, 0});
+            }
+
+            // ppoll sleeps to the microsecond, so sub-millisecond windows wait for their deadline instead of spinning
+            timespec wait{};
+            const timespec* timeout = nullptr;
+            if (!s.pending.empty()) {
+                const auto deadline = s.first_arrival + std::chrono::microseconds(s.window_us.load());
+                const auto left = std::chrono::duration_cast<std::chrono::microseconds>(deadline - clock::now());
+                const auto us = std::max<std::int64_t>(0, left.count());
+                wait.tv_sec = static_cast<time_t>(us / 1000000);
+                wait.tv_nsec = static_cast<long>(us % 1000000 * 1000);
+                timeout = &wait;
+            }
+
+            if (ppoll(fds.data(), fds.size(), timeout, nullptr) < 0 && errno != EINTR) {
+                throw_errno("ppoll");
+            }
+
+            if (fds[0].revents & POLLIN) {
+                char drain[64];
+                while (read(wake_fds_[0], drain, sizeof(drain)) > 0) {
+                }
+            }
+
+            if (fds[1].revents & POLLIN) {
+                while (true) {
+                    const int fd = accept(listen_fd_, nullptr, nullptr);
+                    if (fd < 0) {
+                        break;
+                    }
+                    set_nonblocking(fd);
+                    const auto id = s.next_id++;
+                    s.fd_to_id[fd] = id;
+                    s.open[id] = {fd, connection{}};
+                    s.connections += 1;
+                }
+            }
+
+            for (std::size_t i = 2; i < fds.size(); ++i) {
+                const auto fd = fds[i].fd;
+                const auto revents = fds[i].revents;
+                if (revents == 0) {
+                    continue;
+                }
+                const auto id_it = s.fd_to_id.find(fd);
+                if (id_it == s.fd_to_id.end()) {
+                    continue;
+                }
+                const auto id = id_it->second;
+                auto& conn = s.open[id].second;
+
+                if ((revents & POLLOUT) && !write_out(fd, conn)) {
+                    close_connection(fd);
+                    continue;
+                }
+                if (!(revents & (POLLIN | POLLHUP | POLLERR))) {
+                    continue;
+                }
+
+                // read no more than the batch has room for, the rest waits in the socket for the next round
+                const auto room = config_.max_batch - std::min(config_.max_batch, s.pending.size());
+                const auto wanted = room * sizeof(price_request);
+                bool closed = false;
+                char buffer[64 * 1024];
+                while (conn.in.size() < wanted) {
+                    const auto n = recv(fd, buffer, std::min(sizeof(buffer), wanted - conn.in.size()), 0);
+                    if (n > 0) {
+                        conn.in.insert(conn.in.end(), buffer, buffer + n);
+                        continue;
+                    }
+                    if (n < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    closed = n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+                    break;
+                }
+
+                // conn.in never holds more than room requests, so the batch stays within max_batch
+                const auto whole = conn.in.size() / sizeof(price_request);
+                if (whole > 0 && s.pending.empty()) {
+                    s.first_arrival = clock::now();
+                }
+                for (std::size_t r = 0; r < whole; ++r) {
+                    price_request request{};
+                    std::memcpy(&request, conn.in.data() + r * sizeof(price_request), sizeof(price_request));
+                    s.pending.push_back({id, request, validate(request)});
+                }
+                conn.in.erase(conn.in.begin(),
+                    conn.in.begin() + static_cast<std::ptrdiff_t>(whole * sizeof(price_request)));
+
+                if (closed) {
+                    close_connection(fd);
+                }
+            }
+
+            if (!s.pending.empty()) {
+                const auto deadline = s.first_arrival + std::chrono::microseconds(s.window_us.load());
+                if (s.pending.size() >= config_.max_batch || clock::now() >= deadline) {
+                    flush();
+                }
+            }
+        }
+
+        if (!s.pending.empty()) {
+            flush();
+        }
+    }
+
+    pricing_client::pricing_client(const std::string& socket_path) {
+        const auto addr = socket_address(socket_path);
+        fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd_ < 0) {
+            throw_errno("socket");
+        }
+        if (connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            const int err = errno;
+            close(fd_);
+            errno = err;
+            throw_errno("connect " + socket_path);
+        }
+    }
+
+    pricing_client::~pricing_client() {
+        close(fd_);
+    }
+
+    void pricing_client::send(const std::span<const price_request> requests) const {
+        const auto* bytes = reinterpret_cast<const char*>(requests.data());
+        std::size_t left = requests.size_bytes();
+        while (left > 0) {
+            const auto n = ::send(fd_, bytes, left, MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw_errno("send");
+            }
+            bytes += n;
+            left -= static_cast<std::size_t>(n);
+        }
+    }
+
+    void pricing_client::receive(const std::span<price_response> responses) const {
+        auto* bytes = reinterpret_cast<char*>(responses.data());
+        std::size_t left = responses.size_bytes();
+        while (left > 0) {
+            const auto n = recv(fd_, bytes, left, 0);
+            if (n == 0) {
+                throw std::runtime_error("server closed the connection");
+            }
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw_errno("recv");
+            }
+            bytes += n;
+            left -= static_cast<std::size_t>(n);
+        }
+    }
+
+} // namespace pyfi::server
@@ -0,0 +1,304 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/surface.h>
+#include <pyfi/profile.h>
+#include <pyfi/trace.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+
+#include <pyfi/option.h>
+#include <pyfi/parallel.h>
+
+namespace pyfi::surface {
+
+    std::size_t quote_chain::size() const {
+        const auto n = time.size();
+        if (strike_price.size() != n || call_bid.size() != n || call_ask.size() != n || put_bid.size() != n ||
+            put_ask.size() != n) {
+            throw std::invalid_argument("quote_chain columns must have the same length");
+        }
+        return n;
+    }
+
+    double smile::volatility_at(const double k) const {
+        if (k <= moneyness.front()) {
+            return volatility.front();
+        }
+        if (k >= moneyness.back()) {
+            return volatility.back();
+        }
+        const auto upper = static_cast<std::size_t>(
+            std::upper_bound(moneyness.begin(), moneyness.end(), k) - moneyness.begin());
+        const auto lower = upper - 1;
+        const double weight = (k - moneyness[lower]) / (moneyness[upper] - moneyness[lower]);
+        const double variance = volatility[lower] * volatility[lower] +
+            weight * (volatility[upper] * volatility[upper] - volatility[lower] * volatility[lower]);
+        return std::sqrt(variance);
+    }
+
+    double vol_surface::volatility_at(const double t, const double k) const {
+        if (smiles.empty()) {
+            throw std::invalid_argument("the surface has no smiles");
+        }
+        if (t <= smiles.front().time) {
+            return smiles.front().volatility_at(k);
+        }
+        if (t >= smiles.back().time) {
+            return smiles.back().volatility_at(k);
+        }
+        const auto upper = std::upper_bound(smiles.begin(), smiles.end(), t, [](const double x, const smile& s) {
+            return x < s.time;
+        });
+        const auto lower = upper - 1;
+        const double v_lower = lower->volatility_at(k);
+        const double v_upper = upper->volatility_at(k);
+        const double weight = (t - lower->time) / (upper->time - lower->time);
+        const double total = v_lower * v_lower * lower->time +
+            weight * (v_upper * v_upper * upper->time - v_lower * v_lower * lower->time);
+        return std::sqrt(total / t);
+    }
+
+    namespace {
+        std::optional<double> mid(const double bid, const double ask, const double max_relative_spread) {
+            if (!(bid > 0.0) || !(ask >= bid)) {
+                return std::nullopt;
+            }
+            const double m = 0.5 * (bid + ask);
+            if ((ask - bid) / m > max_relative_spread) {
+                return std::nullopt;
+            }
+            return m;
+        }
+
+        // least squares vol = a + b k + c k^2, false if the strikes cannot pin down a parabola
+        bool fit_parabola(const std::vector<double>& k, const std::vector<double>& vol, std::array<double, 3>& coef) {
+            std::array<std::array<double, 4>, 3> system{};
+            for (std::size_t i = 0; i < k.size(); ++i) {
+                const std::array<double, 3> basis{1.0, k[i], k[i] * k[i]};
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) {
+                        system[r][c] += basis[r] * basis[c];
+                    }
+                    system[r][3] += basis[r] * vol[i];
+                }
+            }
+            // Gaussian elimination with partial pivoting on the 3x3 normal equations
+            for (int col = 0; col < 3; ++col) {
+                int pivot = col;
+                for (int r = col + 1; r < 3; ++r) {
+                    if (std::abs(system[r][col]) > std::abs(system[pivot][col])) {
+                        pivot = r;
+                    }
+                }
+                if (std::abs(system[pivot][col]) < 1e-14 * std::abs(system[0][0])) {
+                    return false;
+                }
+                std::swap(system[col], system[pivot]);
+                for (int r = col + 1; r < 3; ++r) {
+                    const double factor = system[r][col] / system[col][col];
+                    for (int c = col; c < 4; ++c) {
+                        system[r][c] -= factor * system[col][c];
+                    }
+                }
+            }
+            for (int r = 2; r >= 0; --r) {
+                double value = system[r][3];
+                for (int c = r + 1; c < 3; ++c) {
+                    value -= system[r][c] * coef[c];
+                }
+                coef[r] = value / system[r][r];
+            }
+            return true;
+        }
+
+        // rows of one expiry, sorted by strike
+        std::optional<smile> fit_smile(const quote_chain& quotes,
+            const std::vector<std::size_t>& rows,
+            const double spot,
+            const surface_config& config) {
+            const double T = quotes.time[rows.front()];
+            const auto n = rows.size();
+
+            std::vector<std::optional<double>> call(n), put(n);
+            std::vector<double> parity_strike, parity_call, parity_put;
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto row = rows[i];
+                call[i] = mid(quotes.call_bid[row], quotes.call_ask[row], config.max_relative_spread);
+                put[i] = mid(quotes.put_bid[row], quotes.put_ask[row], config.max_relative_spread);
+                if (call[i] && put[i]) {
+                    parity_strike.push_back(quotes.strike_price[row]);
+                    parity_call.push_back(*call[i]);
+                    parity_put.push_back(*put[i]);
+                }
+            }
+
+            option::carry_point carry{};
+            try {
+                carry = option::implied_carry(parity_strike, parity_call, parity_put, spot, T);
+            } catch (const std::invalid_argument&) {
+                // too few two sided strikes or an inconsistent chain: the expiry cannot be placed on the forward
+                return std::nullopt;
+            }
+
+            // every quote as a call price by parity, so one batch inverts them all on the fitted forward; the
+            // inversion itself switches to the out of the money side
+            std::vector<double> strike, price;
+            std::size_t rejected = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const double K = quotes.strike_price[rows[i]];
+                // the out of the money side when it is quoted, the other side otherwise
+                const bool use_call = K >= carry.forward ? call[i].has_value() : !put[i].has_value();
+                const auto& quote = use_call ? call[i] : put[i];
+                if (!quote) {
+                    ++rejected;
+                    continue;
+                }
+                strike.push_back(K);
+                price.push_back(use_call ? *quote : *quote + carry.discount * (carry.forward - K));
+            }
+
+            const auto m = strike.size();
+            // stock_price = F with r = q, so the pricer's forward and discount are the fitted ones
+            const std::vector<double> forward(m, carry.forward), rate(m, carry.risk_free_rate), time(m, T), guess(m, 0.0);
+            std::vector<double> vol(m);
+            option::implied_volatility_batch(
+                price, {forward, strike, guess, rate, time, rate}, option::option_type::call, vol);
+
+            smile result{T, carry.forward, carry.discount, {}, {}, rejected};
+            for (std::size_t i = 0; i < m; ++i) {
+                if (std::isnan(vol[i])) {
+                    ++result.rejected;
+                    continue;
+                }
+                result.moneyness.push_back(std::log(strike[i] / carry.forward));
+                result.volatility.push_back(vol[i]);
+            }
+
+            std::array<double, 3> coef{};
+            if (result.moneyness.size() > 3 && fit_parabola(result.moneyness, result.volatility, coef)) {
+                std::vector<double> residual(result.moneyness.size());
+                for (std::size_t i = 0; i < residual.size(); ++i) {
+                    const double k = result.moneyness[i];
+                    residual[i] = std::abs(result.volatility[i] - (coef[0] + coef[1] * k + coef[2] * k * k));
+                }
+                std::vector<double> sorted = residual;
+                const auto middle = sorted.begin() + static_cast<std::ptrdiff_t>(sorted.size() / 2);
+                std::nth_element(sorted.begin(), middle, sorted.end());
+                // MAD scale with a floor of 1 vol point in 10000, so a perfectly smooth smile keeps every quote
+                const double limit = config.outlier_threshold * std::max(1.4826 * *middle, 1e-4);
+
+                std::size_t kept = 0;
+                for (std::size_t i = 0; i < residual.size(); ++i) {
+                    if (residual[i] > limit) {
+                        ++result.rejected;
+                        continue;
+                    }
+                    result.moneyness[kept] = result.moneyness[i];
+                    result.volatility[kept] = result.volatility[i];
+                    ++kept;
+                }
+                result.moneyness.resize(kept);
+                result.volatility.resize(kept);
+            }
+
+            if (result.moneyness.size() < std::max<std::size_t>(config.min_quotes, 1)) {
+                return std::nullopt;
+            }
+            return result;
+        }
+    } // namespace
+
+    vol_surface build_surface(const quote_chain& quotes,
+        const double spot,
+        const std::span<const double> grid_time,
+        const std::span<const double> grid_moneyness,
+        const surface_config& config) {
+        const auto n = quotes.size();
+        const profile::scope scope("surface.build_surface", n);
+        const trace::span span("surface.build_surface", "curve", n);
+        if (!(spot > 0.0)) {
+            throw std::invalid_argument("spot price must be positive");
+        }
+        for (const double t : grid_time) {
+            if (!(t > 0.0)) {
+                throw std::invalid_argument("grid times must be positive");
+            }
+        }
+
+        std::vector<std::size_t> order(n);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::sort(order.begin(), order.end(), [&](const std::size_t a, const std::size_t b) {
+            return quotes.time[a] != quotes.time[b] ? quotes.time[a] < quotes.time[b]
+                                                    : quotes.strike_price[a] < quotes.strike_price[b];
+        });
+        std::vector<std::vector<std::size_t>> expiries;
+        for (std::size_t first = 0; first < n;) {
+            auto last = first;
+            while (last < n && quotes.time[order[last]] == quotes.time[order[first]]) {
+                ++last;
+            }
+            if (quotes.time[order[first]] > 0.0) {
+                expiries.emplace_back(order.begin() + static_cast<std::ptrdiff_t>(first),
+                    order.begin() + static_cast<std::ptrdiff_t>(last));
+            }
+            first = last;
+        }
+
+        std::vector<std::optional<smile>> fitted(expiries.size());
+        parallel::parallel_for(expiries.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t e = begin; e < end; ++e) {
+                fitted[e] = fit_smile(quotes, expiries[e], spot, config);
+            }
+        });
+
+        vol_surface surface;
+        for (auto& s : fitted) {
+            if (s) {
+                surface.smiles.push_back(std::move(*s));
+            }
+        }
+        if (surface.smiles.empty()) {
+            throw std::invalid_argument("no expiry has enough clean quotes to build a surface");
+        }
+
+        surface.time.assign(grid_time.begin(), grid_time.end());
+        surface.moneyness.assign(grid_moneyness.begin(), grid_moneyness.end());
+        surface.forward.resize(grid_time.size());
+        surface.volatility.resize(grid_time.size() * grid_moneyness.size());
+
+        // ln(F / S) is linear in time between smiles, and the carry rate ln(F / S) / T is flat beyond them
+        const auto& smiles = surface.smiles;
+        const auto log_forward = [&](const double t) {
+            if (t <= smiles.front().time) {
+                return std::log(smiles.front().forward / spot) * t / smiles.front().time;
+            }
+            if (t >= smiles.back().time) {
+                return std::log(smiles.back().forward / spot) * t / smiles.back().time;
+            }
+            const auto upper = std::upper_bound(smiles.begin(), smiles.end(), t, [](const double x, const smile& s) {
+                return x < s.time;
+            });
+            const auto lower = upper - 1;
+            const double weight = (t - lower->time) / (upper->time - lower->time);
+            const double a = std::log(lower->forward / spot);
+            return a + weight * (std::log(upper->forward / spot) - a);
+        };
+
+        for (std::size_t i = 0; i < grid_time.size(); ++i) {
+            surface.forward[i] = spot * std::exp(log_forward(grid_time[i]));
+            for (std::size_t j = 0; j < grid_moneyness.size(); ++j) {
+                surface.volatility[i * grid_moneyness.size() + j] = surface.volatility_at(grid_time[i], grid_moneyness[j]);
+            }
+        }
+        return surface;
+    }
+
+} // namespace pyfi::surface
@@ -0,0 +1,226 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/trace.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <unistd.h>
+
+namespace pyfi::trace {
+
+    namespace {
+        using clock = std::chrono::steady_clock;
+
+        struct event {
+            const char* name;
+            const char* category;
+            std::size_t rows;
+            clock::rep begin;
+            clock::rep end;
+        };
+
+        // written only by its own thread; size is published with a release store after each event is complete
+        struct thread_buffer {
+            thread_buffer(const std::uint64_t generation, const std::uint32_t thread, const std::size_t capacity) :
+                generation(generation), thread(thread), capacity(capacity), events(new event[capacity]) {}
+
+            const std::uint64_t generation;
+            const std::uint32_t thread;
+            const std::size_t capacity;
+            const std::unique_ptr<event[]> events;
+            std::atomic<std::size_t> size{0};
+            std::atomic<std::size_t> dropped{0};
+            std::string name; // guarded by registry_mutex
+        };
+
+        std::atomic<bool> recording{false};
+        std::atomic<std::uint64_t> current_generation{0};
+        std::atomic<std::size_t> buffer_capacity{1 << 16};
+        std::atomic<clock::rep> origin{0};
+        std::atomic<std::uint32_t> next_thread{1};
+
+        std::mutex registry_mutex;
+        std::vector<std::shared_ptr<thread_buffer>> buffers; // of the current generation
+
+        thread_local std::shared_ptr<thread_buffer> local_buffer;
+        thread_local std::string local_name;
+
+        std::uint32_t thread_id() {
+            static thread_local const std::uint32_t id = next_thread.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+        // the first span a thread records after start() registers a fresh buffer, so start() never touches a buffer
+        // another thread may be writing
+        thread_buffer& buffer_for(const std::uint64_t generation) {
+            auto buffer = std::make_shared<thread_buffer>(
+                generation, thread_id(), buffer_capacity.load(std::memory_order_relaxed));
+            std::lock_guard lock(registry_mutex);
+            buffer->name = local_name;
+            if (current_generation.load(std::memory_order_relaxed) == generation) {
+                buffers.push_back(buffer);
+            }
+            local_buffer = std::move(buffer);
+            return *local_buffer;
+        }
+
+        void write_escaped(std::ostream& out, const char* text) {
+            out << '"';
+            for (const char* c = text; *c != '\0'; ++c) {
+                switch (*c) {
+                    case '"':
+                        out << "\\\"";
+                        break;
+                    case '\\':
+                        out << "\\\\";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(*c) < 0x20) {
+                            char code[8];
+                            std::snprintf(code, sizeof(code), "\\u%04x", *c);
+                            out << code;
+                        } else {
+                            out << *c;
+                        }
+                }
+            }
+            out << '"';
+        }
+    } // namespace
+
+    void start(const std::size_t spans_per_thread) {
+        if (spans_per_thread == 0) {
+            throw std::invalid_argument("spans_per_thread must be positive");
+        }
+        std::lock_guard lock(registry_mutex);
+        buffers.clear();
+        buffer_capacity.store(spans_per_thread, std::memory_order_relaxed);
+        origin.store(clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        current_generation.fetch_add(1, std::memory_order_release);
+        recording.store(true, std::memory_order_release);
+    }
+
+    void stop() {
+        recording.store(false, std::memory_order_release);
+    }
+
+    bool enabled() {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    std::size_t dropped() {
+        std::lock_guard lock(registry_mutex);
+        std::size_t total = 0;
+        for (const auto& buffer : buffers) {
+            total += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void set_thread_name(std::string name) {
+        std::lock_guard lock(registry_mutex);
+        if (local_buffer) {
+            local_buffer->name = name;
+        }
+        local_name = std::move(name);
+    }
+
+    const char* intern(const std::string_view name) {
+        static std::mutex mutex;
+        static std::set<std::string, std::less<>> names;
+        std::lock_guard lock(mutex);
+        auto it = names.find(name);
+        if (it == names.end()) {
+            it = names.emplace(name).first;
+        }
+        return it->c_str();
+    }
+
+    void span::record(const char* name,
+        const char* category,
+        const std::size_t rows,
+        const clock::time_point begin,
+        const clock::time_point end) {
+        const auto generation = current_generation.load(std::memory_order_acquire);
+        auto* buffer = local_buffer.get();
+        if (buffer == nullptr || buffer->generation != generation) {
+            buffer = &buffer_for(generation);
+        }
+        const auto size = buffer->size.load(std::memory_order_relaxed);
+        if (size == buffer->capacity) {
+            buffer->dropped.store(buffer->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        buffer->events[size] = {name, category, rows, begin.time_since_epoch().count(), end.time_since_epoch().count()};
+        buffer->size.store(size + 1, std::memory_order_release);
+    }
+
+    void write_json(std::ostream& out) {
+        std::lock_guard lock(registry_mutex);
+        const auto zero = origin.load(std::memory_order_relaxed);
+        // steady clock ticks to microseconds
+        const double tick_us = 1e6 * clock::period::num / clock::period::den;
+        const auto pid = static_cast<long>(getpid());
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out.setf(std::ios::fixed, std::ios::floatfield);
+        out.precision(3);
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        const auto separator = [&] {
+            if (!first) {
+                out << ",\n";
+            }
+            first = false;
+        };
+        for (const auto& buffer : buffers) {
+            separator();
+            out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid << ",\"tid\":" << buffer->thread
+                << ",\"args\":{\"name\":";
+            const auto name = buffer->name.empty() ? "thread " + std::to_string(buffer->thread) : buffer->name;
+            write_escaped(out, name.c_str());
+            out << "}}";
+
+            const auto size = buffer->size.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < size; ++i) {
+                const auto& e = buffer->events[i];
+                separator();
+                out << "{\"ph\":\"X\",\"name\":";
+                write_escaped(out, e.name);
+                out << ",\"cat\":";
+                write_escaped(out, e.category);
+                out << ",\"pid\":" << pid << ",\"tid\":" << buffer->thread
+                    << ",\"ts\":" << static_cast<double>(e.begin - zero) * tick_us
+                    << ",\"dur\":" << static_cast<double>(e.end - e.begin) * tick_us;
+                if (e.rows > 0) {
+                    out << ",\"args\":{\"rows\":" << e.rows << "}";
+                }
+                out << "}";
+            }
+        }
+        out << "]}\n";
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    void write_json(const std::string& path) {
+        std::ofstream out(path);
+        if (out) {
+            write_json(out);
+        }
+        if (!out) {
+            throw std::runtime_error("cannot write trace to " + path);
+        }
+    }
+
+} // namespace pyfi::trace
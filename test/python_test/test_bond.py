@@ -121,6 +121,25 @@ def main() -> None:
     )
     print("clean_coupon_price_from_T:", clean_T)
 
+    # 12) batch pricing over a whole book
+    dirty_batch = bond.dirty_coupon_price_from_T_batch(
+        par_value=[par_value, par_value],
+        coupon_rate=[coupon_rate, 0.03],
+        annual_yield=[annual_yield, annual_yield],
+        years_to_maturity=[3.75, 7.0],
+        m=[m, m],
+    )
+    print("dirty_coupon_price_from_T_batch:", dirty_batch)
+
+    clean_batch = bond.clean_coupon_price_from_T_batch(
+        par_value=[par_value, par_value],
+        coupon_rate=[coupon_rate, 0.03],
+        annual_yield=[annual_yield, annual_yield],
+        years_to_maturity=[3.75, 7.0],
+        m=[m, m],
+    )
+    print("clean_coupon_price_from_T_batch:", clean_batch)
+
 
 if __name__ == "__main__":
     main()
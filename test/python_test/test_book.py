@@ -0,0 +1,53 @@
+"""
+Prices a shared memory book from several forked worker processes.
+"""
+
+from __future__ import annotations
+
+import multiprocessing as mp
+import os
+
+from pyfi import book
+
+
+def worker(name: str, index: int) -> None:
+    shared = book.SharedBook.attach(name)
+    shared.price_options(index)
+    shared.price_bonds(index)
+
+
+def main() -> None:
+    name = f"/pyfi_book_{os.getpid()}"
+    workers = 4
+    shared = book.SharedBook.create(name, options=10_000, bonds=1_000, workers=workers)
+
+    try:
+        shared.option_column(book.OptionColumn.stock_price)[:] = 100.0
+        shared.option_column(book.OptionColumn.strike_price)[:] = 105.0
+        shared.option_column(book.OptionColumn.volatility)[:] = 0.2
+        shared.option_column(book.OptionColumn.risk_free_rate)[:] = 0.03
+        shared.option_column(book.OptionColumn.time)[:] = 0.5
+
+        shared.bond_column(book.BondColumn.par_value)[:] = 1000.0
+        shared.bond_column(book.BondColumn.coupon_rate)[:] = 0.05
+        shared.bond_column(book.BondColumn.annual_yield)[:] = 0.04
+        shared.bond_column(book.BondColumn.years_to_maturity)[:] = 3.75
+        shared.compounding()[:] = 2
+
+        procs = [mp.Process(target=worker, args=(name, i)) for i in range(workers)]
+        for p in procs:
+            p.start()
+        for p in procs:
+            p.join()
+
+        calls = shared.option_column(book.OptionColumn.call)
+        dirty = shared.bond_column(book.BondColumn.dirty_price)
+        print(f"first/last call: {calls[0]} {calls[-1]}")
+        print(f"first/last dirty price: {dirty[0]} {dirty[-1]}")
+        print(f"worker 0 owns options {shared.option_range(0)}")
+    finally:
+        shared.unlink()
+
+
+if __name__ == "__main__":
+    main()
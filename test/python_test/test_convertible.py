@@ -0,0 +1,34 @@
+"""
+Convertible bond pricing with pyfi.convertible.
+"""
+
+from __future__ import annotations
+
+from pyfi import convertible
+
+
+def main() -> None:
+    market = dict(stock_price=100.0, volatility=0.3, risk_free_rate=0.03, credit_spread=0.02)
+
+    plain = convertible.price(100.0, 0.03, 7.0, 0.9, **market, steps=700)
+    print("7y 3% convertible into 0.9 shares:")
+    for key, value in plain.items():
+        print(f"  {key:>16}: {value:10.4f}")
+
+    # issuer call at 110 from year 2, holder put at par in year 4
+    callable_ = convertible.price(100.0, 0.03, 7.0, 0.9, **market, steps=700, calls=[(2.0, 7.0, 110.0)])
+    putable = convertible.price(100.0, 0.03, 7.0, 0.9, **market, steps=700, puts=[(4.0, 4.0, 100.0)])
+    print(f"callable {callable_['price']:.4f}, putable {putable['price']:.4f}")
+
+    for spread in (0.0, 0.02, 0.05, 0.1):
+        out = convertible.price(100.0, 0.03, 7.0, 0.9, 100.0, 0.3, 0.03, spread, steps=700)
+        print(f"spread {spread:.2f}: price {out['price']:.4f} floor {out['bond_floor']:.4f} delta {out['delta']:.4f}")
+
+    # a long dated quarterly convertible on thousands of steps, rolling columns keep memory linear
+    for steps in (1000, 2000, 4000):
+        out = convertible.price(100.0, 0.04, 30.0, 0.9, **market, steps=steps, m=4)
+        print(f"30y at {steps} steps: {out['price']:.4f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,43 @@
+"""
+Hazard curves, CDS pricing and risky bonds with pyfi.credit.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+
+from pyfi import credit, curve
+
+
+def main() -> None:
+    rates = curve.Curve(np.array([1.0, 2.0, 5.0, 10.0, 30.0]), np.array([0.030, 0.034, 0.038, 0.041, 0.044]),
+                        np.full(5, 2, dtype=np.int32))
+
+    maturity = np.array([1.0, 2.0, 3.0, 5.0, 7.0, 10.0])
+    spread = np.array([0.006, 0.008, 0.011, 0.013, 0.0135, 0.014])
+    hazard = credit.bootstrap(rates, maturity, spread, recovery=0.4)
+    for t, h in zip(hazard.times, hazard.hazards):
+        print(f"hazard to {t:4.1f}y: {h:.5f}, survival {hazard.survival(t):.5f}")
+
+    for t, s in zip(maturity, spread):
+        legs = credit.price_cds(rates, hazard, t, s, recovery=0.4)
+        print(f"{t:4.1f}y CDS at {s * 1e4:.0f}bp: par spread {legs['par_spread'] * 1e4:.2f}bp pv {legs['pv']:.2e}")
+
+    print("7y 5% risky bond:", credit.risky_bond_price(rates, hazard, 100.0, 0.05, 7.0, 2, 0.4))
+
+    # a credit book on the government bond kernel, one flat hazard per issuer
+    n = 100_000
+    rng = np.random.default_rng(7)
+    par = np.full(n, 100.0)
+    coupon = rng.uniform(0.02, 0.07, n)
+    yield_ = rng.uniform(0.03, 0.045, n)
+    years = rng.uniform(0.5, 30.0, n)
+    m = np.full(n, 2, dtype=np.int32)
+    lambda_ = rng.uniform(0.0, 0.05, n)
+    recovery = np.full(n, 0.4)
+    risky = credit.risky_dirty_price_batch(par, coupon, yield_, years, m, lambda_, recovery)
+    print("credit book mean price:", risky.mean())
+
+
+if __name__ == "__main__":
+    main()
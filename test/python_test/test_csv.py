@@ -0,0 +1,44 @@
+"""
+Reads a quote file with pyfi.csv and prices it with the batch pricers.
+"""
+
+from __future__ import annotations
+
+import os
+import tempfile
+
+from pyfi import csv, option
+
+
+def main() -> None:
+    with tempfile.NamedTemporaryFile("w", suffix=".csv", delete=False) as handle:
+        handle.write("symbol_id,stock_price,strike_price,volatility,risk_free_rate,time\n")
+        for i in range(1_000):
+            handle.write(f"{i},{90 + i % 20},100,0.2,0.03,0.5\n")
+        path = handle.name
+
+    try:
+        columns = csv.read_csv(
+            path,
+            ["stock_price", "strike_price", "volatility", "risk_free_rate", "time"],
+            integer_columns=["symbol_id"],
+            optional_columns={"yield_curve": 0.0},
+        )
+        print("rows:", len(columns["stock_price"]))
+        print("last symbol:", columns["symbol_id"][-1])
+
+        calls = option.black_scholes_call_batch(
+            columns["stock_price"],
+            columns["strike_price"],
+            columns["volatility"],
+            columns["risk_free_rate"],
+            columns["time"],
+            columns["yield_curve"],
+        )
+        print("first call:", calls[0])
+    finally:
+        os.remove(path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,40 @@
+"""
+Par curve bootstrap and par risk of a bond book with pyfi.curve.
+"""
+
+from __future__ import annotations
+
+import time
+
+import numpy as np
+
+from pyfi import curve
+
+
+def main() -> None:
+    maturity = np.array([0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 20.0, 30.0])
+    par_rate = np.array([0.030, 0.032, 0.035, 0.037, 0.040, 0.041, 0.042, 0.044, 0.045])
+    ust = curve.Curve(maturity, par_rate, np.full(len(maturity), 2, dtype=np.int32))
+    print("zero rates:", ust.zero_rates)
+    print("jacobian is lower triangular:", np.allclose(np.triu(ust.jacobian, 1), 0.0))
+
+    n = 100_000
+    rng = np.random.default_rng(42)
+    par = np.full(n, 100.0)
+    coupon = rng.uniform(0.0, 0.08, n)
+    life = rng.uniform(0.1, 30.0, n)
+    m = np.full(n, 2, dtype=np.int32)
+
+    start = time.perf_counter()
+    price, (data, indices, indptr) = ust.par_sensitivities(par, coupon, life, m)
+    print(f"par risk of {n} bonds in {time.perf_counter() - start:.3f} s, {len(data)} entries")
+
+    # DV01 per par instrument of the whole book, per basis point
+    book = np.zeros(len(maturity))
+    np.add.at(book, indices, data)
+    for t, dv01 in zip(maturity, book * 1e-4):
+        print(f"{t:5.1f}y {dv01:14.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,39 @@
+"""
+EE and PFE profile of a small option and bond netting set with pyfi.exposure.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+
+from pyfi import exposure, option, proxy
+
+
+def main() -> None:
+    dates = list(np.arange(0.25, 3.01, 0.25))
+    american_put = proxy.ChebyshevProxy(100.0, 0.03, spot=(30.0, 300.0, 24), volatility=(0.15, 0.3, 4),
+                                        time=(0.05, 3.0, 10), type=option.OptionType.put, model="binomial",
+                                        american=True, steps=200)
+    profile = exposure.simulate(
+        spot=100.0,
+        volatility=0.2,
+        short_rate=0.03,
+        dates=dates,
+        options=[(100.0, 2.0, option.OptionType.call, 10.0), (90.0, 1.0, option.OptionType.put, -5.0)],
+        bonds=[(100.0, 0.04, 3.0, 2, 1.0)],
+        proxies=[(american_put, 3.0, 2.0)],
+        rate_volatility=0.01,
+        correlation=-0.3,
+        quantiles=[0.95, 0.99],
+        paths=20_000,
+    )
+    print(f"{'date':>6} {'EE':>10} {'PFE 95%':>10} {'PFE 99%':>10}")
+    pfe = profile["potential_future_exposure"]
+    for i, date in enumerate(profile["dates"]):
+        print(f"{date:6.2f} {profile['expected_exposure'][i]:10.3f} {pfe[0.95][i]:10.3f} {pfe[0.99][i]:10.3f}")
+    print("EPE:", profile["expected_positive_exposure"])
+    print("peak PFE:", profile["peak_exposure"])
+
+
+if __name__ == "__main__":
+    main()
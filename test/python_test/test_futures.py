@@ -0,0 +1,40 @@
+"""
+Bond futures basis, implied repo and cheapest to deliver switches with pyfi.futures.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+
+from pyfi import futures
+
+
+def main() -> None:
+    print("conversion factor of a 10% bond, 20y 2m:", futures.conversion_factor(0.10, 20.0 + 2.0 / 12.0))
+
+    # one long bond basket per 100 of par, deliverable into a front and a back month contract
+    par = np.full(4, 100.0)
+    coupon = np.array([0.08, 0.05, 0.03, 0.06])
+    yield_ = np.array([0.045, 0.047, 0.048, 0.046])
+    maturity = np.array([15.3, 20.1, 29.9, 10.3])
+    m = np.full(4, 2, dtype=np.int32)
+    contracts = [(115.0, 0.4, 0.04, 0, 4), (114.5, 0.65, 0.041, 0, 4)]
+
+    out = futures.basis(par, coupon, yield_, maturity, m, contracts)
+    for k, (price, delivery, repo, first, count) in enumerate(contracts):
+        print(f"contract {k} at {price} delivering in {delivery}y, cheapest to deliver: bond {out['cheapest'][k]}")
+        for row in range(out["row_start"][k], out["row_start"][k + 1]):
+            print(
+                f"  bond {out['deliverable'][row]}: CF {out['conversion_factor'][row]:.4f} "
+                f"gross {out['gross_basis'][row]:8.4f} net {out['net_basis'][row]:8.4f} "
+                f"implied repo {out['implied_repo'][row]:8.4%}"
+            )
+
+    shifts = np.linspace(-0.03, 0.03, 13)
+    switch = futures.ctd_switch(par, coupon, yield_, maturity, m, contracts, shifts)
+    for shift, ctd, price in zip(shifts, switch["cheapest"][0], switch["futures_price"][0]):
+        print(f"{shift:+.3f}: CTD bond {ctd}, futures {price:.3f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -47,13 +47,14 @@ def main() -> None:
     vega = opt.bs_vega(100.0, 110.0, 0.25, 0.03, 0.01, 0.5)
     print(f"bs_vega: {vega}")
 
-    rho_calc = opt.bs_rho_calculation(100.0, 0.05, 1.0, 0.5)
-    print(f"bs_rho_calculation: {rho_calc}")
+    kernel = opt.BSKernel(100.0, 110.0, 0.25, 0.03, 0.5, 0.01)
+    print(f"BSKernel call price/delta: {kernel.price(opt.OptionType.call)} {kernel.delta(opt.OptionType.call)}")
+    print(f"BSKernel put price/vanna: {kernel.price(opt.OptionType.put)} {kernel.vanna()}")
 
-    call_rho = opt.bs_call_rho(100.0, 110.0, 0.25, 0.03, 0.5)
+    call_rho = opt.bs_call_rho(100.0, 110.0, 0.25, 0.03, 0.01, 0.5)
     print(f"bs_call_rho: {call_rho}")
 
-    put_rho = opt.bs_put_rho(100.0, 110.0, 0.25, 0.03, 0.5)
+    put_rho = opt.bs_put_rho(100.0, 110.0, 0.25, 0.03, 0.01, 0.5)
     print(f"bs_put_rho: {put_rho}")
 
     print("\n=== Binomial Tree ===")
@@ -70,6 +71,12 @@ def main() -> None:
     us_put = opt.binomial_us_option(100.0, 100.0, 0.2, 0.05, 200, 1.0, "put")
     print(f"binomial_us_option (put): {us_put}")
 
+    price, error, steps = opt.binomial_eu_option_adaptive(100.0, 100.0, 0.2, 0.05, 1.0, "call", tolerance=1e-4)
+    print(f"binomial_eu_option_adaptive (call): {price} +/- {error} in {steps} steps")
+
+    price, error, steps = opt.binomial_us_option_adaptive(100.0, 100.0, 0.2, 0.05, 1.0, "put", tolerance=1e-3)
+    print(f"binomial_us_option_adaptive (put): {price} +/- {error} in {steps} steps")
+
     print("\n=== Forward and Yield ===")
 
     forward = opt.forward_from_yield(100.0, 0.04, 2.0, 0.01)
@@ -78,6 +85,38 @@ def main() -> None:
     implied_yield = opt.yield_from_forward(100.0, forward, 0.04, 2.0)
     print(f"yield_from_forward: {implied_yield}")
 
+    print("\n=== Batch ===")
+
+    spots = [90.0, 100.0, 110.0]
+    strikes = [100.0, 100.0, 100.0]
+    vols = [0.2, 0.2, 0.2]
+    rates = [0.05, 0.05, 0.05]
+    times = [1.0, 1.0, 1.0]
+
+    calls = opt.black_scholes_call_batch(spots, strikes, vols, rates, times)
+    print(f"black_scholes_call_batch: {calls}")
+
+    puts = opt.black_scholes_put_batch(spots, strikes, vols, rates, times, [0.01, 0.01, 0.01])
+    print(f"black_scholes_put_batch: {puts}")
+
+    greeks = opt.black_scholes_call_greeks_batch(spots, strikes, vols, rates, times)
+    for name, values in greeks.items():
+        print(f"black_scholes_call_greeks_batch {name}: {values}")
+
+    hedges = opt.black_scholes_put_greeks_batch(spots, strikes, vols, rates, times, greeks=["vanna", "volga"])
+    print(f"black_scholes_put_greeks_batch vanna/volga: {hedges['vanna']} {hedges['volga']}")
+
+    print("\n=== Implied carry ===")
+
+    chain_strikes = [80.0, 90.0, 100.0, 110.0, 120.0]
+    chain_calls = [opt.black_scholes_call(100.0, k, 0.2, 0.04, 1.0, 0.02) for k in chain_strikes]
+    chain_puts = [opt.black_scholes_put(100.0, k, 0.2, 0.04, 1.0, 0.02) for k in chain_strikes]
+    carry = opt.implied_carry([0] * 5, [1.0] * 5, chain_strikes, chain_calls, chain_puts, [100.0])
+    print(f"implied_carry forward/yield: {carry['forward']} {carry['yield_curve']}")
+
+    curve = opt.CarryCurve(carry)
+    print(f"CarryCurve.yield_curve: {curve.yield_curve([0, 0], [0.5, 2.0])}")
+
     print("\n=== All functions called successfully ===")
 
 
@@ -0,0 +1,35 @@
+"""
+Hardware counters of the batch pricers with pyfi.profile().
+"""
+
+from __future__ import annotations
+
+import numpy as np
+
+import pyfi
+from pyfi import bond, option, risk
+
+
+def main() -> None:
+    n = 1_000_000
+    spot = np.linspace(80.0, 120.0, n)
+    strike = np.full(n, 100.0)
+    vol = np.full(n, 0.2)
+    rate = np.full(n, 0.03)
+    time = np.full(n, 0.5)
+
+    print("hardware counters available:", pyfi.profiler.hardware_available())
+
+    with pyfi.profile() as prof:
+        option.black_scholes_call_batch(spot, strike, vol, rate, time)
+        option.black_scholes_call_greeks_batch(spot, strike, vol, rate, time)
+        bond.dirty_coupon_price_from_T_batch(strike, rate, rate, time, np.full(n, 2, dtype=np.int32))
+        risk.bump_and_reprice(spot[:1000], strike[:1000], vol[:1000], rate[:1000], time[:1000])
+
+    print(prof)
+    calls = prof.results()["option.black_scholes_call_batch"]
+    print("call batch: calls", calls["calls"], "rows", calls["rows"], "IPC", calls["ipc"])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,38 @@
+"""
+Revalues an American put across many scenarios with a pyfi.proxy Chebyshev proxy instead of the binomial tree.
+"""
+
+from __future__ import annotations
+
+import time
+
+import numpy as np
+
+from pyfi import option, proxy
+
+
+def main() -> None:
+    strike, rate = 100.0, 0.03
+    start = time.perf_counter()
+    put = proxy.ChebyshevProxy(strike, rate, spot=(60.0, 140.0, 16), volatility=(0.15, 0.45, 8),
+                               time=(0.5, 2.0, 8), type=option.OptionType.put, model="binomial", american=True,
+                               steps=300)
+    print(f"built {put.coefficients} coefficients in {time.perf_counter() - start:.2f} s, "
+          f"error estimate {put.error_estimate():.2e}")
+
+    rng = np.random.default_rng(42)
+    n = 1_000_000
+    spot = rng.uniform(60.0, 140.0, n)
+    vol = rng.uniform(0.15, 0.45, n)
+    expiry = rng.uniform(0.5, 2.0, n)
+    start = time.perf_counter()
+    prices = put.evaluate_batch(spot, vol, expiry)
+    print(f"{n} scenarios in {time.perf_counter() - start:.2f} s")
+
+    for i in range(5):
+        tree = option.binomial_us_option(spot[i], strike, vol[i], rate, 300, expiry[i], "put")
+        print(f"S={spot[i]:7.2f} vol={vol[i]:.3f} T={expiry[i]:.2f}  proxy {prices[i]:8.4f}  tree {tree:8.4f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,39 @@
+"""
+Finite difference Greeks from pyfi.risk next to the closed form ones.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+
+from pyfi import monte_carlo, option, risk
+
+
+def main() -> None:
+    spot = np.array([90.0, 100.0, 110.0])
+    strike = np.full(3, 100.0)
+    vol = np.full(3, 0.25)
+    rate = np.full(3, 0.04)
+    time = np.full(3, 1.0)
+
+    exact = option.black_scholes_call_greeks_batch(spot, strike, vol, rate, time)
+    print("analytic delta:", exact["delta"])
+
+    bumped = risk.bump_and_reprice(spot, strike, vol, rate, time)
+    print("bumped delta:  ", bumped["delta"])
+
+    mc = risk.bump_and_reprice(spot, strike, vol, rate, time, model="monte_carlo", paths=100_000)
+    print("MC delta:      ", mc["delta"])
+
+    tree = risk.binomial_greeks(spot, strike, vol, rate, time, type=option.OptionType.put, american=True)
+    print("american put delta:", tree["delta"], "gamma:", tree["gamma"])
+
+    prices, errors = monte_carlo.price_batch(spot, strike, vol, rate, time, style=monte_carlo.PayoffStyle.asian, steps=12)
+    print("asian calls:", prices, "+/-", errors)
+
+    greeks = monte_carlo.greeks_batch(spot, strike, vol, rate, time, estimator=monte_carlo.GreekEstimator.pathwise)
+    print("pathwise delta:", greeks["delta"], "+/-", greeks["delta_error"])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,36 @@
+"""
+Builds an implied vol surface from synthetic bid/ask quotes with pyfi.surface.
+"""
+
+from __future__ import annotations
+
+import math
+
+import numpy as np
+
+from pyfi import option, surface
+
+
+def main() -> None:
+    spot, rate, dividend = 100.0, 0.03, 0.01
+    rows = []
+    for time in (0.25, 0.5, 1.0, 2.0):
+        forward = spot * math.exp((rate - dividend) * time)
+        for strike in np.arange(70.0, 142.5, 2.5):
+            vol = 0.2 - 0.08 * math.log(strike / forward) + 0.25 * math.log(strike / forward) ** 2
+            call = option.black_scholes_call(spot, strike, vol, rate, time, dividend)
+            put = option.black_scholes_put(spot, strike, vol, rate, time, dividend)
+            rows.append((time, strike, call - 0.01, call + 0.01, put - 0.01, put + 0.01))
+
+    columns = np.array(rows).T
+    result = surface.build_surface(*columns, spot, grid_time=[0.5, 1.5], grid_moneyness=[-0.1, 0.0, 0.1])
+    print("forwards:", result["forward"])
+    print("vol grid:\n", result["volatility"])
+    print("rejected per expiry:", [s["rejected"] for s in result["smiles"]])
+
+    price = option.black_scholes_put(spot, 95.0, 0.3, rate, 1.0, dividend)
+    print("implied vol:", option.implied_volatility(price, spot, 95.0, rate, 1.0, dividend, option.OptionType.put))
+
+
+if __name__ == "__main__":
+    main()
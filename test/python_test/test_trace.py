@@ -0,0 +1,40 @@
+"""
+Chrome trace of a small batch job with pyfi.trace, to open in ui.perfetto.dev.
+"""
+
+from __future__ import annotations
+
+import json
+
+import numpy as np
+
+from pyfi import option, risk, trace
+
+
+def main() -> None:
+    n = 1_000_000
+    spot = np.linspace(80.0, 120.0, n)
+    strike = np.full(n, 100.0)
+    vol = np.full(n, 0.2)
+    rate = np.full(n, 0.03)
+    time = np.full(n, 0.5)
+
+    trace.start()
+    with trace.Span("nightly job"):
+        with trace.Span("pricing"):
+            option.black_scholes_call_batch(spot, strike, vol, rate, time)
+        with trace.Span("greeks"):
+            option.black_scholes_call_greeks_batch(spot, strike, vol, rate, time)
+            risk.bump_and_reprice(spot[:1000], strike[:1000], vol[:1000], rate[:1000], time[:1000])
+    trace.stop()
+
+    events = json.loads(trace.to_json())["traceEvents"]
+    for event in events:
+        if event["ph"] == "X":
+            print(f'{event["name"]:45} {event["cat"]:8} {event["dur"]:12.1f} us')
+    print("dropped:", trace.dropped())
+    trace.save("pyfi_trace.json")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,406 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+// Accuracy-vs-speed regression suite. Every fast path is run over a randomized (but seeded) parameter grid and
+// compared with a golden reference: 50 digit Boost.Multiprecision closed forms for Black-Scholes and bonds, and a
+// long-step lattice for American options. Each path has a maximum error and a time budget; the test fails if either
+// regresses. Budgets are in nanoseconds per priced unit for an optimised build and are scaled up for debug builds and
+// by the PYFI_SPEED_SCALE environment variable for slow or instrumented machines.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/option.h"
+
+using namespace pyfi;
+using real = boost::multiprecision::cpp_bin_float_50;
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+#ifdef NDEBUG
+    constexpr double build_scale = 1.0;
+#else
+    constexpr double build_scale = 8.0;
+#endif
+
+    double speed_scale() {
+        const char* scale = std::getenv("PYFI_SPEED_SCALE");
+        return build_scale * (scale != nullptr ? std::max(1.0, std::atof(scale)) : 1.0);
+    }
+
+    // best of a few runs, in nanoseconds per unit of work
+    template <typename Body>
+    double time_per_unit(const std::size_t units, Body&& body) {
+        double best = 1e300;
+        for (int run = 0; run < 5; ++run) {
+            const auto start = clock::now();
+            body();
+            const auto ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+            best = std::min(best, ns / static_cast<double>(units));
+        }
+        return best;
+    }
+
+    void report(const char* path,
+        const double max_error,
+        const double error_budget,
+        const double ns,
+        const double ns_budget) {
+        std::printf("%-28s max error %10.3e (budget %8.1e)  %10.1f ns (budget %8.1f)\n",
+            path,
+            max_error,
+            error_budget,
+            ns,
+            ns_budget);
+    }
+
+    real reference_Phi(const real& x) {
+        return boost::math::erfc(-x / boost::multiprecision::sqrt(real(2))) / 2;
+    }
+
+    // Black-Scholes with continuous yield q at 50 digits
+    real reference_black_scholes(const double S,
+        const double K,
+        const double sigma,
+        const double r,
+        const double T,
+        const double q,
+        const bool call) {
+        const real s(S), k(K), v(sigma), rate(r), t(T), yield(q);
+        const real sqrt_t = boost::multiprecision::sqrt(t);
+        const real d1 = (boost::multiprecision::log(s / k) + (rate - yield + v * v / 2) * t) / (v * sqrt_t);
+        const real d2 = d1 - v * sqrt_t;
+        const real forward_s = s * boost::multiprecision::exp(-yield * t);
+        const real pv_k = k * boost::multiprecision::exp(-rate * t);
+        return call ? forward_s * reference_Phi(d1) - pv_k * reference_Phi(d2)
+                    : pv_k * reference_Phi(-d2) - forward_s * reference_Phi(-d1);
+    }
+
+    // coupon bond as an explicit sum of discounted cash flows at 50 digits
+    real reference_dirty_price(const double par,
+        const double coupon,
+        const double yield,
+        const double years,
+        const int m) {
+        const double N = years * m;
+        const int n = static_cast<int>(std::ceil(N));
+        const double frac = N - std::floor(N);
+        const real alpha = std::abs(frac) < 1e-12 ? real(0) : real(1) - real(frac);
+        const real b = real(1) + real(yield) / m;
+        const real c = real(par) * real(coupon) / m;
+
+        real pv = 0;
+        for (int k = 1; k <= n; ++k) {
+            pv += c / boost::multiprecision::pow(b, k);
+        }
+        pv += real(par) / boost::multiprecision::pow(b, n);
+        return pv * boost::multiprecision::pow(b, alpha);
+    }
+
+    // American option on a CRR lattice in long double with node prices carried by recurrence
+    double reference_american(const double S,
+        const double K,
+        const double sigma,
+        const double r,
+        const double T,
+        const bool call,
+        const int steps) {
+        const long double dt = static_cast<long double>(T) / steps;
+        const long double u = std::exp(sigma * std::sqrt(dt));
+        const long double d = 1.0L / u;
+        const long double p = (std::exp(r * dt) - d) / (u - d);
+        const long double disc = std::exp(-r * dt);
+
+        std::vector<long double> value(steps + 1);
+        std::vector<long double> spot(steps + 1);
+        for (int j = 0; j <= steps; ++j) {
+            spot[j] = S * std::pow(u, static_cast<long double>(2 * j - steps));
+            value[j] = std::max(call ? spot[j] - K : K - spot[j], 0.0L);
+        }
+        for (int i = steps - 1; i >= 0; --i) {
+            for (int j = 0; j <= i; ++j) {
+                spot[j] = spot[j + 1] * d; // S u^j d^(i-j) from the node above
+                const long double cont = disc * (p * value[j + 1] + (1.0L - p) * value[j]);
+                value[j] = std::max(cont, call ? spot[j] - K : K - spot[j]);
+            }
+        }
+        return static_cast<double>(value[0]);
+    }
+
+    struct option_grid {
+        std::vector<double> stock_price, strike_price, volatility, risk_free_rate, time, yield_curve;
+
+        option_grid(const std::size_t n, const std::uint64_t seed, const double max_time) {
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<double> spot(20.0, 200.0);
+            std::uniform_real_distribution<double> log_moneyness(-0.5, 0.5);
+            std::uniform_real_distribution<double> vol(0.05, 0.8);
+            std::uniform_real_distribution<double> rate(-0.01, 0.08);
+            std::uniform_real_distribution<double> expiry(0.02, max_time);
+            std::uniform_real_distribution<double> yield(0.0, 0.06);
+            for (std::size_t i = 0; i < n; ++i) {
+                stock_price.push_back(spot(rng));
+                strike_price.push_back(stock_price.back() * std::exp(log_moneyness(rng)));
+                volatility.push_back(vol(rng));
+                risk_free_rate.push_back(rate(rng));
+                time.push_back(expiry(rng));
+                yield_curve.push_back(yield(rng));
+            }
+        }
+
+        [[nodiscard]] option::option_batch batch() const {
+            return {stock_price, strike_price, volatility, risk_free_rate, time, yield_curve};
+        }
+    };
+} // namespace
+
+TEST_CASE("Black-Scholes scalar and batch pricers match the 50 digit reference") {
+    constexpr std::size_t n = 10'000;
+    constexpr double error_budget = 1e-13; // absolute error per unit of strike
+    constexpr double ns_budget = 2000.0;   // per call and put pair
+
+    const option_grid grid(n, 20261018, 5.0);
+    std::vector<double> calls(n), puts(n);
+
+    const auto batch_ns = time_per_unit(n, [&] {
+        option::black_scholes_call_batch(grid.batch(), calls);
+        option::black_scholes_put_batch(grid.batch(), puts);
+    });
+    const auto scalar_ns = time_per_unit(n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            calls[i] = option::black_scholes_call(grid.stock_price[i],
+                grid.strike_price[i],
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                grid.time[i],
+                grid.yield_curve[i]);
+            puts[i] = option::black_scholes_put(grid.stock_price[i],
+                grid.strike_price[i],
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                grid.time[i],
+                grid.yield_curve[i]);
+        }
+    });
+
+    std::vector<double> batch_calls(n), batch_puts(n);
+    option::black_scholes_call_batch(grid.batch(), batch_calls);
+    option::black_scholes_put_batch(grid.batch(), batch_puts);
+
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double K = grid.strike_price[i];
+        for (const bool call : {true, false}) {
+            const auto reference = reference_black_scholes(grid.stock_price[i],
+                K,
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                grid.time[i],
+                grid.yield_curve[i],
+                call)
+                                       .convert_to<double>();
+            const double scalar = call ? calls[i] : puts[i];
+            const double batch = call ? batch_calls[i] : batch_puts[i];
+            max_error = std::max({max_error, std::abs(scalar - reference) / K, std::abs(batch - reference) / K});
+        }
+    }
+
+    const auto budget = ns_budget * speed_scale();
+    report("black_scholes batch", max_error, error_budget, batch_ns, budget);
+    report("black_scholes scalar", max_error, error_budget, scalar_ns, budget);
+    CHECK(max_error < error_budget);
+    CHECK(batch_ns < budget);
+    CHECK(scalar_ns < budget);
+    // the batch path exists to be faster; it must never fall far behind the scalar loop
+    CHECK(batch_ns < 1.5 * scalar_ns);
+}
+
+TEST_CASE("European binomial lattice converges to the 50 digit Black-Scholes reference") {
+    constexpr std::size_t n = 200;
+    constexpr int steps = 1000;
+    constexpr double error_budget = 1e-3; // CRR converges as 1/steps, per unit of strike
+    constexpr double ns_budget = 5.0;     // per lattice node
+
+    const option_grid grid(n, 1018, 5.0);
+    std::vector<double> prices(2 * n);
+    const auto nodes = static_cast<std::size_t>(steps) * (steps + 1) / 2;
+    const auto ns = time_per_unit(2 * n * nodes, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            prices[2 * i] = option::binomial_eu_option(grid.stock_price[i],
+                grid.strike_price[i],
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                steps,
+                grid.time[i],
+                option::call_payoff);
+            prices[2 * i + 1] = option::binomial_eu_option(grid.stock_price[i],
+                grid.strike_price[i],
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                steps,
+                grid.time[i],
+                option::put_payoff);
+        }
+    });
+
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (const bool call : {true, false}) {
+            const auto reference = reference_black_scholes(grid.stock_price[i],
+                grid.strike_price[i],
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                grid.time[i],
+                0.0,
+                call)
+                                       .convert_to<double>();
+            max_error = std::max(max_error, std::abs(prices[2 * i + (call ? 0 : 1)] - reference) / grid.strike_price[i]);
+        }
+    }
+
+    const auto budget = ns_budget * speed_scale();
+    report("binomial_eu_option", max_error, error_budget, ns, budget);
+    CHECK(max_error < error_budget);
+    CHECK(ns < budget);
+}
+
+TEST_CASE("American binomial lattice matches a long-step reference lattice") {
+    constexpr std::size_t n = 40;
+    constexpr int steps = 500;
+    constexpr int reference_steps = 5000;
+    constexpr double error_budget = 1e-3; // per unit of strike
+    constexpr double ns_budget = 200.0;   // per lattice node
+
+    const option_grid grid(n, 777, 3.0);
+    std::vector<double> puts(n);
+    const auto nodes = static_cast<std::size_t>(steps) * (steps + 1) / 2;
+    const auto ns = time_per_unit(n * nodes, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            puts[i] = option::binomial_us_option(grid.stock_price[i],
+                grid.strike_price[i],
+                grid.volatility[i],
+                grid.risk_free_rate[i],
+                steps,
+                grid.time[i],
+                option::put_payoff);
+        }
+    });
+
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto reference = reference_american(grid.stock_price[i],
+            grid.strike_price[i],
+            grid.volatility[i],
+            grid.risk_free_rate[i],
+            grid.time[i],
+            false,
+            reference_steps);
+        max_error = std::max(max_error, std::abs(puts[i] - reference) / grid.strike_price[i]);
+    }
+
+    const auto budget = ns_budget * speed_scale();
+    report("binomial_us_option put", max_error, error_budget, ns, budget);
+    CHECK(max_error < error_budget);
+    CHECK(ns < budget);
+}
+
+TEST_CASE("bond batch pricers match the 50 digit cash flow reference") {
+    constexpr std::size_t n = 5'000;
+    constexpr double error_budget = 1e-12; // per unit of par
+    constexpr double ns_budget = 400.0;    // per dirty and clean pair
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coupon(0.0, 0.12);
+    std::uniform_real_distribution<double> yield(-0.005, 0.15);
+    std::uniform_real_distribution<double> years(0.1, 40.0);
+    const int frequencies[] = {1, 2, 4, 12};
+
+    std::vector<double> par(n), coupon_rate(n), annual_yield(n), years_to_maturity(n);
+    std::vector<int> m(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        par[i] = 100.0 * static_cast<double>(1 + rng() % 10);
+        coupon_rate[i] = coupon(rng);
+        annual_yield[i] = yield(rng);
+        years_to_maturity[i] = years(rng);
+        m[i] = frequencies[rng() % 4];
+    }
+    const bond::bond_batch batch{par, coupon_rate, annual_yield, years_to_maturity, m};
+
+    std::vector<double> dirty(n), clean(n);
+    const auto ns = time_per_unit(n, [&] {
+        bond::dirty_coupon_price_from_T_batch(batch, dirty);
+        bond::clean_coupon_price_from_T_batch(batch, clean);
+    });
+
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto reference = reference_dirty_price(par[i], coupon_rate[i], annual_yield[i], years_to_maturity[i], m[i]);
+        const double frac = years_to_maturity[i] * m[i] - std::floor(years_to_maturity[i] * m[i]);
+        const double alpha = std::abs(frac) < 1e-12 ? 0.0 : 1.0 - frac;
+        const auto reference_clean = reference - real(par[i]) * real(coupon_rate[i]) / m[i] * real(alpha);
+        max_error = std::max({max_error,
+            std::abs(dirty[i] - reference.convert_to<double>()) / par[i],
+            std::abs(clean[i] - reference_clean.convert_to<double>()) / par[i]});
+    }
+
+    const auto budget = ns_budget * speed_scale();
+    report("bond dirty/clean batch", max_error, error_budget, ns, budget);
+    CHECK(max_error < error_budget);
+    CHECK(ns < budget);
+}
+
+TEST_CASE("fused Greeks pass matches the 50 digit reference and stays cheap") {
+    constexpr std::size_t n = 10'000;
+    constexpr double error_budget = 1e-13; // per unit of strike, price and delta
+    constexpr double ns_budget = 2000.0;   // per contract with all eleven columns
+
+    const option_grid grid(n, 4242, 5.0);
+
+    std::vector<std::vector<double>> columns(11, std::vector<double>(n));
+    const option::greeks_batch out{columns[0],
+        columns[1],
+        columns[2],
+        columns[3],
+        columns[4],
+        columns[5],
+        columns[6],
+        columns[7],
+        columns[8],
+        columns[9],
+        columns[10]};
+    const auto ns = time_per_unit(n, [&] { option::black_scholes_call_greeks_batch(grid.batch(), out); });
+
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double K = grid.strike_price[i];
+        const auto price = reference_black_scholes(
+            grid.stock_price[i], K, grid.volatility[i], grid.risk_free_rate[i], grid.time[i], grid.yield_curve[i], true);
+        // closed form delta e^(-qT) N(d1) at 50 digits
+        const auto d1 = (boost::multiprecision::log(real(grid.stock_price[i]) / real(K)) +
+                            (real(grid.risk_free_rate[i]) - real(grid.yield_curve[i]) +
+                                real(grid.volatility[i]) * real(grid.volatility[i]) / 2) *
+                                real(grid.time[i])) /
+            (real(grid.volatility[i]) * boost::multiprecision::sqrt(real(grid.time[i])));
+        const auto delta = boost::multiprecision::exp(-real(grid.yield_curve[i]) * real(grid.time[i])) *
+            reference_Phi(d1);
+        max_error = std::max({max_error,
+            std::abs(columns[0][i] - price.convert_to<double>()) / K,
+            std::abs(columns[1][i] - delta.convert_to<double>())});
+    }
+
+    const auto budget = ns_budget * speed_scale();
+    report("call_greeks_batch", max_error, error_budget, ns, budget);
+    CHECK(max_error < error_budget);
+    CHECK(ns < budget);
+}
@@ -243,4 +243,31 @@ TEST_CASE("Dirty price r -> 0 analytic limit") {
     const double C = P * (c / m);
     // Limit: C*n + P
     REQUIRE(dirty == Approx(C * n + P).margin(1e-10));
-}
\ No newline at end of file
+}
+TEST_CASE("Batch dirty/clean prices match the scalar functions") {
+    const std::vector<double> par{1000.0, 100.0, 1000.0};
+    const std::vector<double> coupon{0.05, 0.03, 0.08};
+    const std::vector<double> yield{0.04, 0.05, 0.06};
+    const std::vector<double> T{3.75, 10.0, 0.4};
+    const std::vector<int> m{2, 1, 4};
+
+    const bond_batch batch{par, coupon, yield, T, m};
+    std::vector<double> dirty(par.size());
+    std::vector<double> clean(par.size());
+    dirty_coupon_price_from_T_batch(batch, dirty);
+    clean_coupon_price_from_T_batch(batch, clean);
+
+    for (std::size_t i = 0; i < par.size(); ++i) {
+        REQUIRE(dirty[i] == Approx(dirty_coupon_price_from_T(par[i], coupon[i], yield[i], T[i], m[i])).margin(1e-12));
+        REQUIRE(clean[i] == Approx(clean_coupon_price_from_T(par[i], coupon[i], yield[i], T[i], m[i])).margin(1e-12));
+    }
+
+    std::vector<double> streamed(par.size());
+    clean_coupon_price_from_T_batch(batch, streamed, {.prefetch_distance = 16, .streaming_stores = true});
+    REQUIRE(streamed == clean);
+
+    const std::vector<int> bad_m{2, 0, 4};
+    REQUIRE_THROWS_AS(dirty_coupon_price_from_T_batch({par, coupon, yield, T, bad_m}, dirty), std::invalid_argument);
+    REQUIRE_THROWS_AS(dirty_coupon_price_from_T_batch({par, coupon, yield, T, bad_m}, dirty, {0, true}),
+        std::invalid_argument);
+}
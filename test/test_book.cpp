@@ -0,0 +1,151 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pyfi/book.h"
+
+using namespace pyfi::book;
+using namespace Catch;
+
+static std::string unique_name(const char* tag) {
+    return "/pyfi_test_" + std::string(tag) + "_" + std::to_string(getpid());
+}
+
+static void fill_book(const shared_book& book) {
+    const auto S = book.column(option_column::stock_price);
+    const auto K = book.column(option_column::strike_price);
+    const auto sigma = book.column(option_column::volatility);
+    const auto r = book.column(option_column::risk_free_rate);
+    const auto T = book.column(option_column::time);
+    const auto q = book.column(option_column::yield_curve);
+    for (std::size_t i = 0; i < book.options(); ++i) {
+        S[i] = 80.0 + static_cast<double>(i % 41);
+        K[i] = 100.0;
+        sigma[i] = 0.1 + 0.01 * static_cast<double>(i % 20);
+        r[i] = 0.03;
+        T[i] = 0.25 + 0.05 * static_cast<double>(i % 30);
+        q[i] = 0.0;
+    }
+
+    const auto par = book.column(bond_column::par_value);
+    const auto coupon = book.column(bond_column::coupon_rate);
+    const auto yield = book.column(bond_column::annual_yield);
+    const auto years = book.column(bond_column::years_to_maturity);
+    const auto m = book.compounding();
+    for (std::size_t i = 0; i < book.bonds(); ++i) {
+        par[i] = 1000.0;
+        coupon[i] = 0.05;
+        yield[i] = 0.02 + 0.001 * static_cast<double>(i % 50);
+        years[i] = 0.5 + 0.25 * static_cast<double>(i % 40);
+        m[i] = 2;
+    }
+}
+
+TEST_CASE("Worker ranges cover the book without overlap") {
+    const auto name = unique_name("ranges");
+    const auto book = shared_book::create(name, 1001, 37, 4);
+    book.unlink();
+
+    std::size_t expected = 0;
+    for (std::size_t w = 0; w < book.workers(); ++w) {
+        const auto [begin, end] = book.option_range(w);
+        REQUIRE(begin == expected);
+        REQUIRE(begin % 8 == 0);
+        expected = end;
+    }
+    REQUIRE(expected == book.options());
+    REQUIRE_THROWS_AS(book.option_range(4), std::invalid_argument);
+}
+
+TEST_CASE("Advise and first touch keep the book's contents") {
+    const auto name = unique_name("advise");
+    const auto book = shared_book::create(name, 3000, 700, 3);
+    book.unlink();
+    book.advise({});
+    fill_book(book);
+    for (std::size_t w = 0; w < book.workers(); ++w) {
+        book.first_touch(w);
+    }
+    REQUIRE(book.column(option_column::stock_price)[2999] == 80.0 + static_cast<double>(2999 % 41));
+    REQUIRE(book.compounding()[699] == 2);
+    REQUIRE_THROWS_AS(book.advise({.numa = pyfi::memory::numa_policy::bind, .node = 64}), std::invalid_argument);
+}
+
+TEST_CASE("Attach rejects missing segments and sees the creator's data") {
+    REQUIRE_THROWS_AS(shared_book::attach(unique_name("missing")), std::runtime_error);
+
+    const auto name = unique_name("attach");
+    const auto book = shared_book::create(name, 16, 4, 2);
+    REQUIRE_THROWS_AS(shared_book::create(name, 16, 4, 2), std::runtime_error);
+    book.column(option_column::strike_price)[3] = 42.0;
+    book.compounding()[1] = 12;
+
+    const auto other = shared_book::attach(name);
+    book.unlink();
+    REQUIRE(other.options() == 16);
+    REQUIRE(other.bonds() == 4);
+    REQUIRE(other.workers() == 2);
+    REQUIRE(other.column(option_column::strike_price)[3] == 42.0);
+    REQUIRE(other.compounding()[1] == 12);
+}
+
+TEST_CASE("Forked workers price their slices into the shared outputs") {
+    const auto name = unique_name("fork");
+    constexpr std::size_t workers = 3;
+    const auto book = shared_book::create(name, 500, 120, workers);
+    fill_book(book);
+
+    for (std::size_t w = 0; w < workers; ++w) {
+        const pid_t pid = fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0) {
+            // children attach by name, as spawned processes would
+            try {
+                const auto mine = shared_book::attach(name);
+                mine.price_options(w);
+                mine.price_bonds(w);
+            } catch (...) {
+                _exit(1);
+            }
+            _exit(0);
+        }
+    }
+    for (std::size_t w = 0; w < workers; ++w) {
+        int status = 0;
+        wait(&status);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+    }
+    book.unlink();
+
+    const auto in = book.option_inputs();
+    const auto calls = book.column(option_column::call);
+    const auto puts = book.column(option_column::put);
+    for (std::size_t i = 0; i < book.options(); ++i) {
+        const auto call = pyfi::option::black_scholes_call(
+            in.stock_price[i], in.strike_price[i], in.volatility[i], in.risk_free_rate[i], in.time[i]);
+        const auto put = pyfi::option::black_scholes_put(
+            in.stock_price[i], in.strike_price[i], in.volatility[i], in.risk_free_rate[i], in.time[i]);
+        REQUIRE(calls[i] == Approx(call).margin(1e-12));
+        REQUIRE(puts[i] == Approx(put).margin(1e-12));
+    }
+
+    const auto bonds = book.bond_inputs();
+    const auto dirty = book.column(bond_column::dirty_price);
+    const auto clean = book.column(bond_column::clean_price);
+    for (std::size_t i = 0; i < book.bonds(); ++i) {
+        const auto expected_dirty = pyfi::bond::dirty_coupon_price_from_T(
+            bonds.par_value[i], bonds.coupon_rate[i], bonds.annual_yield[i], bonds.years_to_maturity[i], bonds.m[i]);
+        const auto expected_clean = pyfi::bond::clean_coupon_price_from_T(
+            bonds.par_value[i], bonds.coupon_rate[i], bonds.annual_yield[i], bonds.years_to_maturity[i], bonds.m[i]);
+        REQUIRE(dirty[i] == Approx(expected_dirty).margin(1e-12));
+        REQUIRE(clean[i] == Approx(expected_clean).margin(1e-12));
+    }
+}
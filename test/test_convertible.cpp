@@ -0,0 +1,105 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+
+#include "pyfi/bond.h"
+#include "pyfi/convertible.h"
+#include "pyfi/option.h"
+
+using namespace pyfi;
+
+namespace {
+    const convertible::market_data market{100.0, 0.3, 0.03, 0.02};
+} // namespace
+
+TEST_CASE("Without conversion a convertible is its bond floor", "[convertible]") {
+    const convertible::convertible_bond straight{100.0, 0.05, 5.0, 0.0};
+    const auto out = convertible::price(straight, market, 500);
+
+    // cash flows discounted at the continuous risky rate, as an m times a year yield
+    const double y = 2.0 * std::expm1(0.05 / 2.0);
+    const double floor = bond::dirty_coupon_price_from_T(100.0, 0.05, y, 5.0, 2);
+    REQUIRE(out.bond_floor == Catch::Approx(floor).epsilon(1e-12));
+    REQUIRE(out.price == Catch::Approx(floor).epsilon(1e-12));
+    REQUIRE(out.debt_part == Catch::Approx(out.price).epsilon(1e-12));
+    REQUIRE(out.equity_part == Catch::Approx(0.0).margin(1e-12));
+    REQUIRE(out.delta == Catch::Approx(0.0).margin(1e-12));
+}
+
+TEST_CASE("A riskless zero coupon convertible is a bond plus calls on the stock", "[convertible]") {
+    // no dividends, so converting early never pays and the option is European
+    const convertible::market_data riskless{100.0, 0.3, 0.03};
+    const convertible::convertible_bond zero{100.0, 0.0, 3.0, 0.8};
+    const auto out = convertible::price(zero, riskless, 1000);
+
+    const double expected =
+        100.0 * std::exp(-0.03 * 3.0) + 0.8 * option::black_scholes_call(100.0, 125.0, 0.3, 0.03, 3.0);
+    REQUIRE(out.price == Catch::Approx(expected).epsilon(2e-4));
+    REQUIRE(out.conversion_value == 80.0);
+    REQUIRE(out.delta == Catch::Approx(0.8 * option::bs_call_delta(100.0, 125.0, 0.3, 0.03, 0.0, 3.0)).epsilon(0.01));
+    REQUIRE(out.gamma == Catch::Approx(0.8 * option::bs_gamma(100.0, 125.0, 0.3, 0.03, 0.0, 3.0)).epsilon(0.02));
+}
+
+TEST_CASE("Calls, puts, credit and conversion move the price the right way", "[convertible]") {
+    const convertible::convertible_bond plain{100.0, 0.03, 7.0, 0.9};
+    const auto base = convertible::price(plain, market, 700);
+    REQUIRE(base.price >= base.bond_floor);
+    REQUIRE(base.price >= base.conversion_value);
+    REQUIRE(base.equity_part + base.debt_part == Catch::Approx(base.price).epsilon(1e-14));
+
+    // lattice delta against bumped prices, averaged over n and n + 1 steps to take out the odd-even oscillation
+    const auto bumped = [&](const double h) {
+        auto m = market;
+        m.stock_price += h;
+        return 0.5 * (convertible::price(plain, m, 700).price + convertible::price(plain, m, 701).price);
+    };
+    REQUIRE(base.delta == Catch::Approx((bumped(10.0) - bumped(-10.0)) / 20.0).epsilon(0.02));
+    REQUIRE(base.gamma > 0.0);
+
+    auto callable = plain;
+    callable.calls.push_back({2.0, 7.0, 110.0});
+    REQUIRE(convertible::price(callable, market, 700).price < base.price);
+
+    auto putable = plain;
+    putable.puts.push_back({3.0, 3.0, 105.0});
+    const auto put = convertible::price(putable, market, 700);
+    REQUIRE(put.price > base.price);
+    REQUIRE(put.bond_floor == base.bond_floor);
+
+    auto wider = market;
+    wider.credit_spread = 0.05;
+    const auto risky = convertible::price(plain, wider, 700);
+    REQUIRE(risky.price < base.price);
+    REQUIRE(risky.bond_floor < base.bond_floor);
+
+    // deep in the money it trades as shares plus the coupons, which pay more than the stock's dividends until the
+    // holder converts at maturity, so the cash part is little more than the coupons' value
+    auto deep = plain;
+    deep.conversion_ratio = 5.0;
+    const auto shares = convertible::price(deep, market, 700);
+    const double coupons = shares.bond_floor - 100.0 * std::exp(-0.05 * 7.0);
+    REQUIRE(shares.debt_part > coupons);
+    REQUIRE(shares.debt_part < 0.05 * shares.price);
+    REQUIRE(shares.price == Catch::Approx(500.0 + coupons).epsilon(0.01));
+    REQUIRE(shares.delta == Catch::Approx(5.0).epsilon(0.01));
+}
+
+TEST_CASE("Long dated convertibles converge on rolling columns", "[convertible]") {
+    const convertible::convertible_bond long_dated{100.0, 0.04, 30.0, 0.9, 4};
+    const double coarse = convertible::price(long_dated, market, 3000).price;
+    const double fine = convertible::price(long_dated, market, 6000).price;
+    REQUIRE(fine == Catch::Approx(coarse).epsilon(2e-3));
+
+    REQUIRE_THROWS_AS(convertible::price(long_dated, market, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(convertible::price({100.0, 0.04, 0.0, 1.0}, market, 100), std::invalid_argument);
+    REQUIRE_THROWS_AS(convertible::price({100.0, 0.04, 5.0, -1.0}, market, 100), std::invalid_argument);
+    REQUIRE_THROWS_AS(convertible::price({100.0, 0.04, 5.0, 1.0, 0}, market, 100), std::invalid_argument);
+    REQUIRE_THROWS_AS(convertible::price(long_dated, {100.0, 0.0, 0.03}, 100), std::invalid_argument);
+    // a rate drift of 0.5 over a three year step outruns the up move
+    REQUIRE_THROWS_AS(convertible::price(long_dated, {100.0, 0.05, 0.5}, 10), std::invalid_argument);
+}
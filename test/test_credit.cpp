@@ -0,0 +1,180 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/credit.h"
+#include "pyfi/curve.h"
+
+using namespace pyfi;
+
+namespace {
+    const std::vector<curve::par_instrument> instruments{
+        {1.0, 0.030, 2}, {2.0, 0.034, 2}, {5.0, 0.038, 2}, {10.0, 0.041, 2}, {30.0, 0.044, 2}};
+    const auto rates = curve::bootstrap(instruments).curve;
+    const curve::zero_curve flat({1.0, 30.0}, {0.03, 0.03});
+
+    // protection and accrued premium of a CDS by the midpoint rule on a fine grid
+    struct quadrature {
+        double protection;
+        double annuity;
+    };
+
+    quadrature integrate(const curve::zero_curve& discount,
+        const credit::hazard_curve& hazard,
+        const credit::cds& contract,
+        const double recovery,
+        const int steps_per_year) {
+        const int n = static_cast<int>(std::ceil(contract.maturity * contract.m));
+        quadrature out{0.0, 0.0};
+        for (int k = 0; k < n; ++k) {
+            const double end = contract.maturity - static_cast<double>(n - 1 - k) / contract.m;
+            const double start = k == 0 ? 0.0 : end - 1.0 / contract.m;
+            const int steps = static_cast<int>(std::ceil((end - start) * steps_per_year));
+            const double h = (end - start) / steps;
+            for (int i = 0; i < steps; ++i) {
+                const double t = start + (i + 0.5) * h;
+                const double density = hazard.hazard(t) * hazard.survival(t) * discount.discount(t) * h;
+                out.protection += (1.0 - recovery) * density;
+                out.annuity += (t - start) * density;
+            }
+            out.annuity += (end - start) * discount.discount(end) * hazard.survival(end);
+        }
+        return out;
+    }
+} // namespace
+
+TEST_CASE("Hazard curves are piecewise constant with flat extrapolation", "[credit]") {
+    const credit::hazard_curve hazard({1.0, 3.0, 5.0}, {0.01, 0.02, 0.04});
+    REQUIRE(hazard.survival(0.0) == 1.0);
+    REQUIRE(hazard.survival(0.5) == Catch::Approx(std::exp(-0.005)).epsilon(1e-15));
+    REQUIRE(hazard.survival(1.0) == Catch::Approx(std::exp(-0.01)).epsilon(1e-15));
+    REQUIRE(hazard.survival(4.0) == Catch::Approx(std::exp(-0.01 - 0.04 - 0.04)).epsilon(1e-15));
+    REQUIRE(hazard.survival(7.0) == Catch::Approx(std::exp(-0.01 - 0.04 - 0.08 - 0.08)).epsilon(1e-15));
+    REQUIRE(hazard.hazard(1.0) == 0.01);
+    REQUIRE(hazard.hazard(1.5) == 0.02);
+    REQUIRE(hazard.hazard(9.0) == 0.04);
+
+    REQUIRE_THROWS_AS(credit::hazard_curve({}, {}), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::hazard_curve({1.0, 2.0}, {0.01}), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::hazard_curve({2.0, 1.0}, {0.01, 0.01}), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::hazard_curve({1.0}, {-0.01}), std::invalid_argument);
+}
+
+TEST_CASE("CDS legs match closed forms and quadrature", "[credit]") {
+    // flat rate and hazard: the protection leg is (1 - R) lambda / (r + lambda) (1 - exp(-(r + lambda) T))
+    const credit::hazard_curve flat_hazard({5.0}, {0.02});
+    const credit::cds five_year{5.0, 0.01, 4};
+    const auto flat_value = credit::price_cds(flat, flat_hazard, five_year, 0.4);
+    REQUIRE(flat_value.protection_leg == Catch::Approx(0.6 * 0.02 / 0.05 * -std::expm1(-0.25)).epsilon(1e-13));
+    REQUIRE(flat_value.premium_leg == Catch::Approx(0.01 * flat_value.risky_annuity).epsilon(1e-15));
+    REQUIRE(flat_value.pv == Catch::Approx(flat_value.protection_leg - flat_value.premium_leg).epsilon(1e-15));
+    // the credit triangle, up to the premium paid in arrears, which is worth about r / (2 m) less
+    REQUIRE(flat_value.par_spread == Catch::Approx(0.6 * 0.02 * (1.0 + 0.03 / 8.0)).epsilon(2e-4));
+
+    // term structures in both curves, with knots inside premium periods and a short first period
+    const credit::hazard_curve hazard({0.8, 2.3, 4.1, 6.0}, {0.01, 0.025, 0.015, 0.03});
+    for (const auto& contract : {credit::cds{7.1, 0.012, 4}, credit::cds{3.0, 0.02, 2}}) {
+        const auto value = credit::price_cds(rates, hazard, contract, 0.35);
+        const auto expected = integrate(rates, hazard, contract, 0.35, 20000);
+        REQUIRE(value.protection_leg == Catch::Approx(expected.protection).epsilon(1e-8));
+        REQUIRE(value.risky_annuity == Catch::Approx(expected.annuity).epsilon(1e-8));
+        REQUIRE(value.par_spread == Catch::Approx(value.protection_leg / value.risky_annuity).epsilon(1e-15));
+    }
+
+    REQUIRE_THROWS_AS(credit::price_cds(flat, flat_hazard, {0.0, 0.01, 4}, 0.4), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::price_cds(flat, flat_hazard, {5.0, 0.01, 0}, 0.4), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::price_cds(flat, flat_hazard, five_year, 1.0), std::invalid_argument);
+}
+
+TEST_CASE("Bootstrapped hazard curves reprice their CDS quotes", "[credit]") {
+    // maturities off the quarterly grid, so premium periods straddle the pillars
+    const std::vector<credit::cds> quotes{
+        {0.9, 0.006, 4}, {2.0, 0.008, 4}, {3.3, 0.011, 4}, {5.0, 0.013, 4}, {7.0, 0.0135, 4}, {10.0, 0.014, 4}};
+    const auto hazard = credit::bootstrap(rates, quotes, 0.4);
+    REQUIRE(hazard.times().size() == quotes.size());
+    for (std::size_t k = 0; k < quotes.size(); ++k) {
+        REQUIRE(hazard.times()[k] == quotes[k].maturity);
+        REQUIRE(hazard.hazards()[k] >= 0.0);
+        REQUIRE(credit::price_cds(rates, hazard, quotes[k], 0.4).pv == Catch::Approx(0.0).margin(1e-14));
+    }
+    // rising spreads need rising forward hazards
+    REQUIRE(hazard.hazards()[3] > hazard.hazards()[0]);
+
+    // a flat spread curve on a flat rate curve gives a flat hazard curve
+    const std::vector<credit::cds> level{{1.0, 0.01, 4}, {3.0, 0.01, 4}, {5.0, 0.01, 4}, {10.0, 0.01, 4}};
+    const auto flat_hazard = credit::bootstrap(flat, level, 0.4);
+    for (const double h : flat_hazard.hazards()) {
+        REQUIRE(h == Catch::Approx(flat_hazard.hazards()[0]).epsilon(1e-4));
+        REQUIRE(h == Catch::Approx(0.01 / 0.6 / (1.0 + 0.03 / 8.0)).epsilon(2e-4));
+    }
+
+    const std::vector<credit::cds> inverted{{1.0, 0.05, 4}, {2.0, 0.001, 4}};
+    REQUIRE_THROWS_AS(credit::bootstrap(rates, inverted, 0.4), std::invalid_argument);
+    const std::vector<credit::cds> unsorted{{2.0, 0.01, 4}, {1.0, 0.01, 4}};
+    REQUIRE_THROWS_AS(credit::bootstrap(rates, unsorted, 0.4), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::bootstrap(rates, std::vector<credit::cds>{}, 0.4), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::bootstrap(rates, level, -0.1), std::invalid_argument);
+}
+
+TEST_CASE("Risky bonds price on the government bond kernel", "[credit]") {
+    // the flat 3% continuous curve as an m times a year yield
+    const auto yield = [](const int m) { return m * std::expm1(0.03 / m); };
+
+    // without default risk a risky bond is the government bond
+    const credit::hazard_curve no_default({30.0}, {0.0});
+    REQUIRE(credit::risky_bond_price(flat, no_default, 100.0, 0.05, 7.3, 2, 0.4) ==
+        Catch::Approx(bond::dirty_coupon_price_from_T(100.0, 0.05, yield(2), 7.3, 2)).epsilon(1e-13));
+
+    // recovery only adds value, and more hazard takes it away
+    const credit::hazard_curve hazard({2.0, 5.0, 10.0}, {0.01, 0.03, 0.02});
+    const double nothing_back = credit::risky_bond_price(rates, hazard, 100.0, 0.05, 7.3, 2, 0.0);
+    REQUIRE(credit::risky_bond_price(rates, hazard, 100.0, 0.05, 7.3, 2, 0.4) > nothing_back);
+    REQUIRE(nothing_back < credit::risky_bond_price(rates, no_default, 100.0, 0.05, 7.3, 2, 0.0));
+
+    // a book bigger than one chunk, flat hazards, against the curve pricer on flat curves
+    const std::size_t n = 1500;
+    std::vector<double> par(n), coupon(n), yields(n), maturity(n), lambda(n), recovery(n), out(n), government(n);
+    std::vector<int> m(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        par[i] = 100.0 + static_cast<double>(i % 7);
+        coupon[i] = 0.02 + 0.001 * static_cast<double>(i % 40);
+        m[i] = i % 3 == 0 ? 1 : (i % 3 == 1 ? 2 : 4);
+        yields[i] = yield(m[i]);
+        maturity[i] = 0.3 + 0.02 * static_cast<double>(i % 1000);
+        lambda[i] = 0.002 * static_cast<double>(i % 25);
+        recovery[i] = 0.1 * static_cast<double>(i % 8);
+    }
+    const bond::bond_batch batch{par, coupon, yields, maturity, m};
+    for (const std::size_t lanes : {std::size_t{1}, std::size_t{4}, std::size_t{8}}) {
+        credit::risky_dirty_price_batch(batch, lambda, recovery, out, {0, false, lanes});
+        for (std::size_t i = 0; i < n; i += 37) {
+            const credit::hazard_curve issuer({30.0}, {lambda[i]});
+            const double expected =
+                credit::risky_bond_price(flat, issuer, par[i], coupon[i], maturity[i], m[i], recovery[i]);
+            REQUIRE(out[i] == Catch::Approx(expected).epsilon(1e-12));
+        }
+    }
+
+    // zero hazards leave the yields untouched, so the batch is the government batch exactly
+    const std::vector<double> zero(n, 0.0);
+    credit::risky_dirty_price_batch(batch, zero, recovery, out, {64, true, 1});
+    bond::dirty_coupon_price_from_T_batch(batch, government);
+    REQUIRE(out == government);
+
+    auto negative = lambda;
+    negative[10] = -0.01;
+    REQUIRE_THROWS_AS(credit::risky_dirty_price_batch(batch, negative, recovery, out), std::invalid_argument);
+    auto total_recovery = recovery;
+    total_recovery[900] = 1.0;
+    REQUIRE_THROWS_AS(credit::risky_dirty_price_batch(batch, lambda, total_recovery, out), std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::risky_dirty_price_batch(batch, lambda, recovery, std::span<double>(out).first(10)),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(credit::risky_bond_price(flat, hazard, 100.0, 0.05, 7.3, 0, 0.4), std::invalid_argument);
+}
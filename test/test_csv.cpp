@@ -0,0 +1,149 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "pyfi/csv.h"
+
+using namespace pyfi::csv;
+
+namespace {
+    // an anonymous temporary file holding text, positioned at the start
+    std::FILE* file_with(const std::string& text) {
+        std::FILE* file = std::tmpfile();
+        std::fwrite(text.data(), 1, text.size(), file);
+        std::rewind(file);
+        return file;
+    }
+} // namespace
+
+TEST_CASE("reader projects named columns and skips the rest") {
+    std::FILE* file = file_with("id,strike,spot , note,m\n"
+                                "1,100.5,101,abc,2\r\n"
+                                "\n"
+                                "2, 99 ,1e2,x,4\n"
+                                "3,98,102.25,,12");
+    reader csv(file, {{"spot"}, {"m", column_type::integer}, {"strike"}});
+
+    REQUIRE(csv.read(100) == 3);
+    REQUIRE(csv.real(0)[0] == 101.0);
+    REQUIRE(csv.real(0)[1] == 100.0);
+    REQUIRE(csv.real(0)[2] == 102.25);
+    REQUIRE(csv.integer(1)[0] == 2);
+    REQUIRE(csv.integer(1)[2] == 12);
+    REQUIRE(csv.real(2)[1] == 99.0);
+    REQUIRE_THROWS_AS(csv.real(1), std::invalid_argument);
+    REQUIRE_THROWS_AS(csv.integer(0), std::invalid_argument);
+
+    REQUIRE(csv.read(100) == 0);
+    std::fclose(file);
+}
+
+TEST_CASE("reader skips blank lines whichever column comes first") {
+    const std::vector<std::string> inputs{"S,K\n1,2\n\n3,4\n\n",
+        "S,K\r\n1,2\r\n\r\n3,4\r\n\r\n",
+        "\nS,K\n1,2\n  \n3,4\n\n\n"};
+    for (const auto& text : inputs) {
+        for (const char* first : {"S", "K"}) {
+            std::FILE* file = file_with(text);
+            reader csv(file, {{first}});
+            REQUIRE(csv.read(100) == 2);
+            REQUIRE(csv.real(0)[0] == (first[0] == 'S' ? 1.0 : 2.0));
+            REQUIRE(csv.real(0)[1] == (first[0] == 'S' ? 3.0 : 4.0));
+            REQUIRE(csv.read(100) == 0);
+            std::fclose(file);
+        }
+    }
+}
+
+TEST_CASE("reader fills optional columns missing from the header") {
+    std::FILE* file = file_with("a;b\n1;2\n3;4\n");
+    reader csv(file, {{"b"}, {"c", column_type::real, false, 0.25}}, ';');
+
+    REQUIRE(csv.read(10) == 2);
+    REQUIRE(csv.real(0)[1] == 4.0);
+    REQUIRE(csv.real(1)[0] == 0.25);
+    REQUIRE(csv.real(1)[1] == 0.25);
+    std::fclose(file);
+}
+
+TEST_CASE("reader streams chunks across read blocks") {
+    // long rows push the data past the 1 MiB read block so rows straddle refills
+    const std::string padding(200, '7');
+    std::string text = "x,pad,y\n";
+    const std::size_t n = 20000;
+    for (std::size_t i = 0; i < n; ++i) {
+        text += std::to_string(i) + "," + padding + "," + std::to_string(i * 0.5) + "\n";
+    }
+    std::FILE* file = file_with(text);
+    reader csv(file, {{"y"}, {"x", column_type::integer}});
+
+    std::size_t total = 0;
+    while (const auto rows = csv.read(777)) {
+        REQUIRE(rows <= 777);
+        for (std::size_t r = 0; r < rows; ++r) {
+            REQUIRE(csv.integer(1)[r] == static_cast<int>(total + r));
+            REQUIRE(csv.real(0)[r] == static_cast<double>(total + r) * 0.5);
+        }
+        total += rows;
+    }
+    REQUIRE(total == n);
+    REQUIRE(csv.bytes() == text.size());
+    std::fclose(file);
+}
+
+TEST_CASE("reader reports malformed input") {
+    SECTION("missing required column") {
+        std::FILE* file = file_with("a,b\n1,2\n");
+        reader csv(file, {{"c"}});
+        REQUIRE_THROWS_AS(csv.read(10), std::runtime_error);
+        std::fclose(file);
+    }
+    SECTION("bad number") {
+        std::FILE* file = file_with("a,b\n1,2\n1,2x\n");
+        reader csv(file, {{"b"}});
+        REQUIRE_THROWS_AS(csv.read(10), std::runtime_error);
+        std::fclose(file);
+    }
+    SECTION("short row") {
+        std::FILE* file = file_with("a,b,c\n1,2,3\n4,5\n");
+        reader csv(file, {{"a"}, {"c"}});
+        REQUIRE_THROWS_AS(csv.read(10), std::runtime_error);
+        std::fclose(file);
+    }
+    SECTION("quoted field") {
+        std::FILE* file = file_with("a,b\n1,\"2\"\n");
+        reader csv(file, {{"a"}});
+        REQUIRE_THROWS_AS(csv.read(10), std::runtime_error);
+        std::fclose(file);
+    }
+    SECTION("bad projection") {
+        std::FILE* file = file_with("a\n1\n");
+        REQUIRE_THROWS_AS(reader(file, {}), std::invalid_argument);
+        REQUIRE_THROWS_AS(reader(file, {{"a"}, {"a"}}), std::invalid_argument);
+        std::fclose(file);
+    }
+}
+
+TEST_CASE("read_file reads a whole file") {
+    const std::string path = "pyfi_test_csv.csv";
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    const std::string text = "m,p\n2,100\n4,99.5\n";
+    std::fwrite(text.data(), 1, text.size(), file);
+    std::fclose(file);
+
+    std::vector<std::vector<double>> reals;
+    std::vector<std::vector<int>> integers;
+    REQUIRE(read_file(path, {{"p"}, {"m", column_type::integer}}, reals, integers) == 2);
+    REQUIRE(reals.size() == 1);
+    REQUIRE(reals[0] == std::vector<double>{100.0, 99.5});
+    REQUIRE(integers[0] == std::vector<int>{2, 4});
+    std::remove(path.c_str());
+
+    REQUIRE_THROWS_AS(read_file("no/such/file.csv", {{"p"}}, reals, integers), std::runtime_error);
+}
@@ -0,0 +1,158 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/curve.h"
+
+using namespace pyfi;
+
+namespace {
+    const std::vector<curve::par_instrument> instruments{{0.5, 0.030, 2},
+        {1.0, 0.032, 2},
+        {2.0, 0.035, 2},
+        {3.0, 0.037, 1},
+        {5.0, 0.040, 2},
+        {7.0, 0.041, 2},
+        {10.0, 0.042, 2},
+        {30.0, 0.045, 2}};
+
+    std::vector<curve::par_instrument> bumped(const std::size_t k, const double h) {
+        auto out = instruments;
+        out[k].par_rate += h;
+        return out;
+    }
+} // namespace
+
+TEST_CASE("Bootstrapped curve reprices its instruments at par", "[curve]") {
+    const auto result = curve::bootstrap(instruments);
+    const auto& zero = result.curve;
+    REQUIRE(zero.times().size() == instruments.size());
+
+    std::vector<double> par(instruments.size(), 1.0), coupon, maturity, price(instruments.size());
+    std::vector<int> m;
+    for (const auto& i : instruments) {
+        coupon.push_back(i.par_rate);
+        maturity.push_back(i.maturity);
+        m.push_back(i.m);
+    }
+    curve::zero_sensitivities(zero, par, coupon, maturity, m, price);
+    for (const double p : price) {
+        REQUIRE(p == Catch::Approx(1.0).epsilon(1e-12));
+    }
+
+    // rates of the pillars and flat beyond them
+    REQUIRE(zero.discount(2.0) == Catch::Approx(std::exp(-2.0 * zero.zero_rates()[2])));
+    REQUIRE(zero.zero_rate(0.1) == zero.zero_rates().front());
+    REQUIRE(zero.zero_rate(40.0) == Catch::Approx(zero.zero_rates().back()));
+    REQUIRE(zero.zero_rates()[0] == Catch::Approx(2.0 * std::log1p(0.015)));
+}
+
+TEST_CASE("Bootstrap Jacobian is lower triangular and matches re-bootstrapping", "[curve]") {
+    const auto result = curve::bootstrap(instruments);
+    const auto n = instruments.size();
+    const double h = 1e-6;
+    for (std::size_t l = 0; l < n; ++l) {
+        const auto up = curve::bootstrap(bumped(l, h)).curve.zero_rates();
+        const auto down = curve::bootstrap(bumped(l, -h)).curve.zero_rates();
+        for (std::size_t k = 0; k < n; ++k) {
+            const double exact = result.jacobian[k * n + l];
+            if (l > k) {
+                REQUIRE(exact == 0.0);
+            }
+            REQUIRE(exact == Catch::Approx((up[k] - down[k]) / (2.0 * h)).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("Par risk of bonds is the zero risk times the Jacobian", "[curve]") {
+    const auto result = curve::bootstrap(instruments);
+    const std::size_t bonds = 2000;
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> life(0.1, 29.0), rate(0.0, 0.08);
+    std::vector<double> par(bonds), coupon(bonds), maturity(bonds);
+    std::vector<int> m(bonds);
+    for (std::size_t i = 0; i < bonds; ++i) {
+        par[i] = 100.0;
+        coupon[i] = rate(rng);
+        maturity[i] = life(rng);
+        m[i] = i % 3 == 0 ? 1 : 2;
+    }
+
+    std::vector<double> price(bonds);
+    const auto zero_risk = curve::zero_sensitivities(result.curve, par, coupon, maturity, m, price);
+    const auto par_risk = curve::par_sensitivities(zero_risk, result);
+    REQUIRE(par_risk.rows == bonds);
+    REQUIRE(par_risk.columns == instruments.size());
+
+    // a bond only sees pillars up to the one after its maturity
+    for (std::size_t i = 0; i < bonds; ++i) {
+        const auto last = zero_risk.column[zero_risk.row_start[i + 1] - 1];
+        REQUIRE((last == instruments.size() - 1 || instruments[last].maturity >= maturity[i]));
+        REQUIRE(par_risk.row_start[i + 1] - par_risk.row_start[i] == last + 1u);
+    }
+
+    const double h = 1e-6;
+    for (const std::size_t l : {0u, 3u, 7u}) {
+        std::vector<double> up(bonds), down(bonds);
+        curve::zero_sensitivities(curve::bootstrap(bumped(l, h)).curve, par, coupon, maturity, m, up);
+        curve::zero_sensitivities(curve::bootstrap(bumped(l, -h)).curve, par, coupon, maturity, m, down);
+        for (std::size_t i = 0; i < bonds; ++i) {
+            double analytic = 0.0;
+            for (auto at = par_risk.row_start[i]; at < par_risk.row_start[i + 1]; ++at) {
+                if (par_risk.column[at] == l) {
+                    analytic = par_risk.value[at];
+                }
+            }
+            REQUIRE(analytic == Catch::Approx((up[i] - down[i]) / (2.0 * h)).margin(1e-4));
+        }
+    }
+}
+
+TEST_CASE("Par instruments only carry risk to their own quote", "[curve]") {
+    const auto result = curve::bootstrap(instruments);
+    std::vector<double> par(instruments.size(), 1.0), coupon, maturity;
+    std::vector<int> m;
+    for (const auto& i : instruments) {
+        coupon.push_back(i.par_rate);
+        maturity.push_back(i.maturity);
+        m.push_back(i.m);
+    }
+    const auto zero_risk = curve::zero_sensitivities(result.curve, par, coupon, maturity, m);
+    const auto risk = curve::par_sensitivities(zero_risk, result);
+    for (std::size_t i = 0; i < instruments.size(); ++i) {
+        for (auto at = risk.row_start[i]; at < risk.row_start[i + 1]; ++at) {
+            if (risk.column[at] == i) {
+                REQUIRE(risk.value[at] < 0.0);
+            } else {
+                REQUIRE(risk.value[at] == Catch::Approx(0.0).margin(1e-10));
+            }
+        }
+    }
+}
+
+TEST_CASE("Curve functions reject bad inputs", "[curve]") {
+    REQUIRE_THROWS_AS(curve::bootstrap({}), std::invalid_argument);
+    const std::vector<curve::par_instrument> unsorted{{2.0, 0.03, 2}, {1.0, 0.03, 2}};
+    REQUIRE_THROWS_AS(curve::bootstrap(unsorted), std::invalid_argument);
+    const std::vector<curve::par_instrument> no_coupons{{1.0, 0.03, 0}};
+    REQUIRE_THROWS_AS(curve::bootstrap(no_coupons), std::invalid_argument);
+    REQUIRE_THROWS_AS(curve::zero_curve({1.0, 1.0}, {0.03, 0.03}), std::invalid_argument);
+    REQUIRE_THROWS_AS(curve::zero_curve({1.0}, {0.03, 0.03}), std::invalid_argument);
+
+    const auto result = curve::bootstrap(instruments);
+    const std::vector<double> one{100.0}, coupon{0.05}, maturity{0.0};
+    const std::vector<int> m{2};
+    REQUIRE_THROWS_AS(curve::zero_sensitivities(result.curve, one, coupon, maturity, m), std::invalid_argument);
+    REQUIRE_THROWS_AS(curve::zero_sensitivities(result.curve, one, coupon, {}, m), std::invalid_argument);
+
+    curve::sparse_matrix wrong;
+    wrong.columns = 3;
+    REQUIRE_THROWS_AS(curve::par_sensitivities(wrong, result), std::invalid_argument);
+}
@@ -0,0 +1,163 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/exposure.h"
+#include "pyfi/option.h"
+#include "pyfi/proxy.h"
+
+using namespace pyfi;
+
+namespace {
+    // flat 3% rates that do not move, so option values are Black-Scholes on the simulated spot
+    const exposure::market_model flat{100.0, 0.2, 0.0, 0.03, 0.1, 0.03, 0.0, 0.0};
+    const std::vector<double> quarterly{0.25, 0.5, 0.75, 1.0, 1.25, 1.5, 1.75};
+} // namespace
+
+TEST_CASE("Quantile sketch is within its relative accuracy and merges exactly", "[exposure]") {
+    exposure::quantile_sketch all(0.01), low(0.01), high(0.01);
+    for (int i = 1; i <= 100'000; ++i) {
+        const double value = 0.001 * i;
+        all.add(value);
+        (i % 2 == 0 ? low : high).add(value);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        all.add(0.0);
+        low.add(-1.0);
+    }
+    REQUIRE(all.count() == 101'000);
+    for (const double q : {0.01, 0.5, 0.9, 0.95, 0.99}) {
+        const double exact = 0.001 * std::max(0.0, std::floor(q * 100'999.0) - 999.0);
+        REQUIRE(std::abs(all.quantile(q) - exact) <= 0.01 * exact + 0.001);
+    }
+
+    low.merge(high);
+    REQUIRE(low.count() == all.count());
+    for (const double q : {0.0, 0.005, 0.25, 0.5, 0.95, 1.0}) {
+        REQUIRE(low.quantile(q) == all.quantile(q));
+    }
+    REQUIRE(all.quantile(0.0) == 0.0);
+
+    // a range wider than the buckets merges the lowest ones and keeps the top exact
+    exposure::quantile_sketch wide(0.01);
+    for (int e = -150; e <= 150; ++e) {
+        wide.add(std::pow(10.0, e));
+    }
+    REQUIRE(wide.quantile(1.0) == Catch::Approx(1e150).epsilon(0.01));
+    REQUIRE(wide.quantile(0.99) == Catch::Approx(1e147).epsilon(0.01));
+
+    REQUIRE_THROWS_AS(exposure::quantile_sketch(0.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(all.quantile(1.5), std::invalid_argument);
+    REQUIRE_THROWS_AS(all.merge(exposure::quantile_sketch(0.02)), std::invalid_argument);
+}
+
+TEST_CASE("Exposure of a long call matches its Black-Scholes profile", "[exposure]") {
+    exposure::portfolio netting_set;
+    netting_set.options.push_back({100.0, 2.0, option::option_type::call, 10.0});
+    const exposure::exposure_config config{quarterly, {0.95, 0.99}, 20'000};
+
+    const auto profile = exposure::simulate(flat, netting_set, config);
+    REQUIRE(profile.expected_exposure.size() == quarterly.size());
+    REQUIRE(profile.potential_future_exposure.size() == 2);
+
+    const double today = 10.0 * option::black_scholes_call(100.0, 100.0, 0.2, 0.03, 2.0);
+    for (std::size_t d = 0; d < quarterly.size(); ++d) {
+        const double t = quarterly[d];
+        // the discounted value is a martingale
+        REQUIRE(profile.expected_exposure[d] == Catch::Approx(today * std::exp(0.03 * t)).epsilon(0.02));
+        // the value rises with the spot, so its quantile is the value at the spot's quantile
+        const double spot = 100.0 * std::exp((0.03 - 0.02) * t + 0.2 * std::sqrt(t) * 1.6448536);
+        const double pfe = 10.0 * option::black_scholes_call(spot, 100.0, 0.2, 0.03, 2.0 - t);
+        REQUIRE(profile.potential_future_exposure[0][d] == Catch::Approx(pfe).epsilon(0.03));
+        REQUIRE(profile.potential_future_exposure[1][d] > profile.potential_future_exposure[0][d]);
+    }
+    REQUIRE(profile.peak_exposure[0] == profile.potential_future_exposure[0].back());
+    REQUIRE(profile.expected_positive_exposure > profile.expected_exposure.front());
+    REQUIRE(profile.expected_positive_exposure < profile.expected_exposure.back());
+
+    // blocks have their own generators, so the result is reproducible
+    const auto again = exposure::simulate(flat, netting_set, config);
+    REQUIRE(again.expected_exposure == profile.expected_exposure);
+    REQUIRE(again.potential_future_exposure == profile.potential_future_exposure);
+}
+
+TEST_CASE("Exposure nets positions and drops them after maturity", "[exposure]") {
+    exposure::portfolio netting_set;
+    netting_set.bonds.push_back({100.0, 0.04, 1.0, 2, 1.0});
+    const exposure::exposure_config config{quarterly, {0.5}, 2'000};
+
+    // with a still short rate the bond value is known at every date
+    const auto bond = exposure::simulate(flat, netting_set, config);
+    for (std::size_t d = 0; d < quarterly.size(); ++d) {
+        const double tau = 1.0 - quarterly[d];
+        const double value =
+            tau > 0.0 ? bond::dirty_coupon_price_from_T(100.0, 0.04, 2.0 * std::expm1(0.015), tau, 2) : 0.0;
+        REQUIRE(bond.expected_exposure[d] == Catch::Approx(value).margin(1e-9));
+        REQUIRE(bond.potential_future_exposure[0][d] == Catch::Approx(value).epsilon(0.01).margin(1e-9));
+    }
+
+    // a sold call only has negative value, so no exposure
+    exposure::portfolio sold;
+    sold.options.push_back({100.0, 2.0, option::option_type::call, -1.0});
+    const auto short_call = exposure::simulate(flat, sold, config);
+    for (const double ee : short_call.expected_exposure) {
+        REQUIRE(ee == 0.0);
+    }
+
+    // a moving short rate spreads the bond values around
+    auto model = flat;
+    model.rate_volatility = 0.01;
+    const auto moving = exposure::simulate(model, netting_set, {quarterly, {0.05, 0.95}, 2'000});
+    REQUIRE(moving.potential_future_exposure[1][1] > moving.potential_future_exposure[0][1]);
+    REQUIRE(moving.expected_exposure[1] == Catch::Approx(bond.expected_exposure[1]).epsilon(0.005));
+}
+
+TEST_CASE("Exposure of a proxy position follows its pricer", "[exposure]") {
+    const proxy::pricer call = [](const double S, const double sigma, const double T) {
+        return option::black_scholes_call(S, 100.0, sigma, 0.03, T);
+    };
+    const proxy::chebyshev_proxy approximation(call, {{20.0, 300.0, 32}, {0.15, 0.25, 4}, {0.05, 2.0, 12}});
+
+    exposure::portfolio exact, proxied;
+    exact.options.push_back({100.0, 2.0, option::option_type::call, 1.0});
+    proxied.proxies.push_back({&approximation, 2.0, 1.0});
+    const exposure::exposure_config config{quarterly, {0.95}, 5'000};
+
+    const auto a = exposure::simulate(flat, exact, config);
+    const auto b = exposure::simulate(flat, proxied, config);
+    for (std::size_t d = 0; d < quarterly.size(); ++d) {
+        REQUIRE(b.expected_exposure[d] == Catch::Approx(a.expected_exposure[d]).epsilon(0.01));
+        REQUIRE(b.potential_future_exposure[0][d] == Catch::Approx(a.potential_future_exposure[0][d]).epsilon(0.02));
+    }
+}
+
+TEST_CASE("Exposure simulation rejects bad inputs", "[exposure]") {
+    exposure::portfolio netting_set;
+    netting_set.options.push_back({100.0, 1.0, option::option_type::put});
+
+    REQUIRE_THROWS_AS(exposure::simulate(flat, netting_set, {{}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(exposure::simulate(flat, netting_set, {{0.5, 0.25}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(exposure::simulate(flat, netting_set, {{0.0, 0.25}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(exposure::simulate(flat, netting_set, {{0.5}, {1.5}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(exposure::simulate(flat, netting_set, {{0.5}, {0.95}, 0}), std::invalid_argument);
+    REQUIRE_THROWS_AS(exposure::simulate(flat, netting_set, {{0.5}, {0.95}, 100, 42, 0.0}), std::invalid_argument);
+
+    auto model = flat;
+    model.correlation = 1.5;
+    REQUIRE_THROWS_AS(exposure::simulate(model, netting_set, {{0.5}}), std::invalid_argument);
+
+    exposure::portfolio no_proxy;
+    no_proxy.proxies.push_back({nullptr, 1.0});
+    REQUIRE_THROWS_AS(exposure::simulate(flat, no_proxy, {{0.5}}), std::invalid_argument);
+
+    exposure::portfolio bad_bond;
+    bad_bond.bonds.push_back({100.0, 0.04, 1.0, 0});
+    REQUIRE_THROWS_AS(exposure::simulate(flat, bad_bond, {{0.5}}), std::invalid_argument);
+}
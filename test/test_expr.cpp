@@ -0,0 +1,92 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/expr.h"
+#include "pyfi/option.h"
+
+using namespace pyfi;
+
+namespace {
+    template <class T>
+    concept can_exp = requires(T&& t) { expr::exp(std::forward<T>(t)); };
+} // namespace
+
+// a temporary array cannot be captured by an expression that outlives it
+static_assert(can_exp<expr::array&>);
+static_assert(can_exp<expr::view>);
+static_assert(!can_exp<expr::array>);
+static_assert(!can_exp<double>);
+
+TEST_CASE("fused Black-Scholes formula matches the batch pricer", "[expr]") {
+    std::vector<double> stock, strike, vol, rate, time, yield;
+    for (int i = 0; i < 257; ++i) {
+        stock.push_back(60.0 + 0.3 * i);
+        strike.push_back(100.0);
+        vol.push_back(0.1 + 0.001 * i);
+        rate.push_back(0.03);
+        time.push_back(0.25 + 0.01 * i);
+        yield.push_back(0.015);
+    }
+    const option::option_batch batch{stock, strike, vol, rate, time, yield};
+    std::vector<double> expected(batch.size());
+    option::black_scholes_call_batch(batch, expected);
+
+    const expr::view S(batch.stock_price), K(batch.strike_price), sigma(batch.volatility), r(batch.risk_free_rate),
+        T(batch.time), q(batch.yield_curve);
+    const auto d1 = (log(S / K) + (r - q + 0.5 * sigma * sigma) * T) / (sigma * sqrt(T));
+    const auto d2 = d1 - sigma * sqrt(T);
+    std::vector<double> call(batch.size());
+    expr::evaluate(S * exp(-q * T) * Phi(d1) - K * exp(-r * T) * Phi(d2), call);
+
+    for (std::size_t i = 0; i < call.size(); ++i) {
+        REQUIRE(call[i] == Catch::Approx(expected[i]).epsilon(1e-12).margin(1e-12));
+    }
+
+    // the same formula assigned to an owning array
+    const expr::array forward = S * exp((r - q) * T);
+    REQUIRE(forward.size() == batch.size());
+    REQUIRE(forward[10] == Catch::Approx(stock[10] * std::exp((0.03 - 0.015) * time[10])).epsilon(1e-15));
+}
+
+TEST_CASE("arrays, scalars and elementwise functions", "[expr]") {
+    expr::array spot(std::vector<double>{90.0, 100.0, 110.0});
+    const expr::array payoff = max(spot - 100.0, 0.0);
+    REQUIRE(std::vector<double>(payoff.begin(), payoff.end()) == std::vector<double>{0.0, 0.0, 10.0});
+
+    const expr::array put = max(100.0 - spot, 0) + min(spot, 0.0) + abs(-spot) - spot;
+    REQUIRE(std::vector<double>(put.begin(), put.end()) == std::vector<double>{10.0, 0.0, 0.0});
+
+    const expr::array density = norm_pdf(spot - spot);
+    REQUIRE(density[1] == Catch::Approx(1.0 / std::sqrt(2.0 * M_PI)).epsilon(1e-15));
+
+    // an expression may read the array it is assigned to
+    spot = spot * 2.0 + 1.0;
+    REQUIRE(std::vector<double>(spot.begin(), spot.end()) == std::vector<double>{181.0, 201.0, 221.0});
+
+    // assigning a longer expression resizes
+    const std::vector<double> longer{1.0, 2.0, 3.0, 4.0};
+    spot = expr::view(longer) / 2.0;
+    REQUIRE(spot.size() == 4);
+    REQUIRE(spot[3] == 2.0);
+
+    // a scalar only expression has no length of its own, so it fills whatever it is evaluated into
+    std::vector<double> out(3);
+    expr::evaluate(expr::scalar(2.0) * 3.0, out);
+    REQUIRE(out == std::vector<double>{6.0, 6.0, 6.0});
+    REQUIRE_THROWS_AS(expr::array(expr::scalar(2.0) * 3.0), std::invalid_argument);
+}
+
+TEST_CASE("length mismatches are rejected", "[expr]") {
+    const std::vector<double> a(3, 1.0), b(4, 1.0);
+    REQUIRE_THROWS_AS(expr::view(a) + expr::view(b), std::invalid_argument);
+
+    std::vector<double> out(2);
+    REQUIRE_THROWS_AS(expr::evaluate(expr::view(a) * 2.0, out), std::invalid_argument);
+}
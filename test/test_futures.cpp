@@ -0,0 +1,126 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/futures.h"
+
+using namespace pyfi;
+
+namespace {
+    // a long bond basket, per 100 of par: short, medium and long duration deliverables
+    const std::vector<double> par{100.0, 100.0, 100.0, 100.0};
+    const std::vector<double> coupon{0.08, 0.05, 0.03, 0.06};
+    const std::vector<double> yield{0.045, 0.047, 0.048, 0.046};
+    const std::vector<double> maturity{15.3, 20.1, 29.9, 10.3};
+    const std::vector<int> m{2, 2, 2, 2};
+    const bond::bond_batch basket{par, coupon, yield, maturity, m};
+
+    // bought today, financed to delivery and the coupons on the way reinvested, less accrued at delivery
+    double forward_clean(const std::size_t i,
+        const double delivery,
+        const double repo,
+        const double coupons,
+        const double accrued_delivery) {
+        const double dirty = bond::dirty_coupon_price_from_T(par[i], coupon[i], yield[i], maturity[i], m[i]);
+        return dirty * (1.0 + repo * delivery) - coupons - accrued_delivery;
+    }
+} // namespace
+
+TEST_CASE("Conversion factors match the exchange's published examples", "[futures]") {
+    // 10% coupon with 20 years 2 months left rounds to 20 years, 8% with 18 years 4 months to 18 years 3 months
+    REQUIRE(futures::conversion_factor(0.10, 20.0 + 2.0 / 12.0) == Catch::Approx(1.4623).margin(1e-12));
+    REQUIRE(futures::conversion_factor(0.08, 18.0 + 4.0 / 12.0) == Catch::Approx(1.2199).margin(1e-12));
+    // a bond paying the notional coupon is worth par at the notional yield
+    REQUIRE(futures::conversion_factor(0.06, 12.7) == Catch::Approx(1.0).margin(1e-12));
+    REQUIRE(futures::conversion_factor(0.04, 7.0, 2, 0.06) < 1.0);
+    // month rounding for the short notes
+    REQUIRE(futures::conversion_factor(0.05, 4.95, 2, 0.06, 1.0 / 12.0) !=
+        futures::conversion_factor(0.05, 4.95, 2, 0.06, 0.25));
+
+    REQUIRE_THROWS_AS(futures::conversion_factor(0.05, 10.0, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(futures::conversion_factor(0.05, 0.2), std::invalid_argument);
+    REQUIRE_THROWS_AS(futures::conversion_factor(0.05, 10.0, 2, 0.06, 0.0), std::invalid_argument);
+}
+
+TEST_CASE("Basis and implied repo are consistent across the basket", "[futures]") {
+    const double delivery = 0.4;
+    const double repo = 0.04;
+    const std::vector<futures::contract> contracts{{115.0, delivery, repo, 0, 3}, {116.0, 0.65, repo, 1, 3}};
+    const auto out = futures::basis(basket, contracts);
+
+    REQUIRE(out.row_start == std::vector<std::size_t>{0, 3, 6});
+    REQUIRE(out.deliverable == std::vector<std::size_t>{0, 1, 2, 1, 2, 3});
+    for (std::size_t row = 0; row < 6; ++row) {
+        const auto& c = contracts[row < 3 ? 0 : 1];
+        const auto i = out.deliverable[row];
+        const double dirty = bond::dirty_coupon_price_from_T(par[i], coupon[i], yield[i], maturity[i], m[i]);
+        const double clean = bond::clean_coupon_price_from_T(par[i], coupon[i], yield[i], maturity[i], m[i]);
+        REQUIRE(out.dirty_price[row] == Catch::Approx(dirty).epsilon(1e-14));
+        REQUIRE(out.clean_price[row] == Catch::Approx(clean).epsilon(1e-14));
+        REQUIRE(out.conversion_factor[row] == futures::conversion_factor(coupon[i], maturity[i] - c.delivery));
+        REQUIRE(out.gross_basis[row] == Catch::Approx(clean - c.price * out.conversion_factor[row]).margin(1e-12));
+        REQUIRE(out.net_basis[row] == Catch::Approx(out.gross_basis[row] - out.carry[row]).margin(1e-12));
+    }
+
+    // deliverable 0 pays one coupon, at 0.3 years, before the first contract's delivery
+    const double coupons = 4.0 * (1.0 + repo * (delivery - 0.3));
+    const double accrued_delivery = 4.0 * (1.0 - 0.8); // 14.9 years left is 29.8 periods
+    REQUIRE(out.invoice_price[0] == Catch::Approx(115.0 * out.conversion_factor[0] + accrued_delivery));
+    const double forward = forward_clean(0, delivery, repo, coupons, accrued_delivery);
+    REQUIRE(out.net_basis[0] == Catch::Approx(forward - 115.0 * out.conversion_factor[0]).margin(1e-10));
+
+    // financed at its own implied repo a deliverable breaks even, so its net basis vanishes
+    for (std::size_t row = 0; row < 6; ++row) {
+        auto at_implied = contracts;
+        at_implied[row < 3 ? 0 : 1].repo_rate = out.implied_repo[row];
+        REQUIRE(futures::basis(basket, at_implied).net_basis[row] == Catch::Approx(0.0).margin(1e-10));
+    }
+
+    // the cheapest to deliver has the highest implied repo of its basket
+    for (std::size_t k = 0; k < 2; ++k) {
+        const auto begin = out.implied_repo.begin() + static_cast<std::ptrdiff_t>(out.row_start[k]);
+        const auto end = out.implied_repo.begin() + static_cast<std::ptrdiff_t>(out.row_start[k + 1]);
+        REQUIRE(out.cheapest[k] == out.deliverable[out.row_start[k] + (std::max_element(begin, end) - begin)]);
+    }
+}
+
+TEST_CASE("Cheapest to deliver moves along the duration axis with the yield shift", "[futures]") {
+    const std::vector<futures::contract> contracts{{115.0, 0.4, 0.04, 0, 4}};
+    const std::vector<double> shifts{-0.03, -0.01, 0.0, 0.01, 0.04};
+    const auto out = futures::ctd_switch_analysis(basket, contracts, shifts);
+    REQUIRE(out.shifts == shifts);
+    REQUIRE(out.cheapest.size() == shifts.size());
+
+    // unshifted, the theoretical price is the lowest forward clean price over conversion factor, where the forward
+    // clean price is F CF plus the net basis
+    const auto analytics = futures::basis(basket, contracts);
+    double lowest = 1e300;
+    for (std::size_t row = 0; row < 4; ++row) {
+        const double factor = analytics.conversion_factor[row];
+        lowest = std::min(lowest, (115.0 * factor + analytics.net_basis[row]) / factor);
+    }
+    REQUIRE(out.futures_price[2] == Catch::Approx(lowest).epsilon(1e-14));
+
+    // well above the notional coupon the longest duration bond is cheapest, well below it the shortest
+    REQUIRE(out.cheapest.back() == 2);
+    REQUIRE(out.cheapest.front() == 3);
+    for (std::size_t s = 1; s < shifts.size(); ++s) {
+        REQUIRE(out.futures_price[s] < out.futures_price[s - 1]);
+    }
+
+    const std::vector<futures::contract> past_the_end{{115.0, 0.4, 0.04, 2, 3}};
+    REQUIRE_THROWS_AS(futures::ctd_switch_analysis(basket, past_the_end, shifts), std::invalid_argument);
+    REQUIRE_THROWS_AS(futures::basis(basket, std::vector<futures::contract>{{115.0, 0.4, 0.04, 0, 0}}),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(futures::basis(basket, std::vector<futures::contract>{{115.0, 0.0, 0.04, 0, 1}}),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(futures::basis(basket, std::vector<futures::contract>{{115.0, 10.2, 0.04, 3, 1}}),
+        std::invalid_argument);
+}
@@ -6,8 +6,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "pyfi/bump.h"
 #include "pyfi/option.h"
 
 using namespace pyfi::option;
@@ -103,9 +106,8 @@ TEST_CASE("Call user's bs_* functions and compare to reference math", "[bs][gree
             double u_ct = bs_call_theta(p.S, p.K, p.sigma, p.r, p.q, p.T);
             double u_pt = bs_put_theta(p.S, p.K, p.sigma, p.r, p.q, p.T);
 
-            // Note: your header declared bs_call_rho(...) and bs_put_rho(...) without dividend_yield.
-            double u_cr = bs_call_rho(p.S, p.K, p.sigma, p.r, p.T);
-            double u_pr = bs_put_rho(p.S, p.K, p.sigma, p.r, p.T);
+            double u_cr = bs_call_rho(p.S, p.K, p.sigma, p.r, p.q, p.T);
+            double u_pr = bs_put_rho(p.S, p.K, p.sigma, p.r, p.q, p.T);
 
             // comparisons (relative)
             REQUIRE(u_cd == Catch::Approx(r_cd).epsilon(tol_rel));
@@ -119,3 +121,260 @@ TEST_CASE("Call user's bs_* functions and compare to reference math", "[bs][gree
         }
     }
 }
+
+namespace {
+    // runs the fused pass on a single contract and returns every column
+    struct all_greeks {
+        double price, delta, gamma, theta, vega, rho, vanna, volga, charm, speed, color;
+    };
+
+    all_greeks fused_greeks(const bool call, double S, double K, double sigma, double r, double q, double T) {
+        all_greeks g{};
+        const option_batch batch{{&S, 1}, {&K, 1}, {&sigma, 1}, {&r, 1}, {&T, 1}, {&q, 1}};
+        const greeks_batch out{{&g.price, 1},
+            {&g.delta, 1},
+            {&g.gamma, 1},
+            {&g.theta, 1},
+            {&g.vega, 1},
+            {&g.rho, 1},
+            {&g.vanna, 1},
+            {&g.volga, 1},
+            {&g.charm, 1},
+            {&g.speed, 1},
+            {&g.color, 1}};
+        if (call) {
+            black_scholes_call_greeks_batch(batch, out);
+        } else {
+            black_scholes_put_greeks_batch(batch, out);
+        }
+        return g;
+    }
+} // namespace
+
+TEST_CASE("fused batch Greeks match the reference first order Greeks", "[bs][greeks][batch]") {
+    const double tol_rel = 1e-9;
+    for (auto p : cases) {
+        const auto c = fused_greeks(true, p.S, p.K, p.sigma, p.r, p.q, p.T);
+        const auto u = fused_greeks(false, p.S, p.K, p.sigma, p.r, p.q, p.T);
+
+        const double d1 = ref_d1(p.S, p.K, p.sigma, p.r, p.q, p.T);
+        const double d2 = ref_d2(d1, p.sigma, p.T);
+        const double call = p.S * std::exp(-p.q * p.T) * normal_cdf(d1) - p.K * std::exp(-p.r * p.T) * normal_cdf(d2);
+        REQUIRE(c.price == Catch::Approx(call).epsilon(tol_rel));
+        // put-call parity with a continuous yield
+        REQUIRE(c.price - u.price == Catch::Approx(p.S * std::exp(-p.q * p.T) - p.K * std::exp(-p.r * p.T)));
+
+        REQUIRE(c.delta == Catch::Approx(ref_call_delta(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(u.delta == Catch::Approx(ref_put_delta(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(c.gamma == Catch::Approx(ref_gamma(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(u.gamma == Catch::Approx(c.gamma).epsilon(tol_rel));
+        REQUIRE(c.vega == Catch::Approx(ref_vega(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(c.theta == Catch::Approx(ref_call_theta(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(u.theta == Catch::Approx(ref_put_theta(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(c.rho == Catch::Approx(ref_call_rho(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+        REQUIRE(u.rho == Catch::Approx(ref_put_rho(p.S, p.K, p.sigma, p.r, p.q, p.T)).epsilon(tol_rel));
+    }
+}
+
+TEST_CASE("fused batch higher order Greeks match finite differences", "[bs][greeks][batch]") {
+    const double tol_rel = 1e-5;
+    for (auto p : cases) {
+        for (const bool call : {true, false}) {
+            const auto g = fused_greeks(call, p.S, p.K, p.sigma, p.r, p.q, p.T);
+            const double hs = 1e-4 * p.S;
+            const double hv = 1e-4;
+            const double ht = 1e-5;
+
+            const auto up_s = fused_greeks(call, p.S + hs, p.K, p.sigma, p.r, p.q, p.T);
+            const auto dn_s = fused_greeks(call, p.S - hs, p.K, p.sigma, p.r, p.q, p.T);
+            const auto up_v = fused_greeks(call, p.S, p.K, p.sigma + hv, p.r, p.q, p.T);
+            const auto dn_v = fused_greeks(call, p.S, p.K, p.sigma - hv, p.r, p.q, p.T);
+            const auto up_t = fused_greeks(call, p.S, p.K, p.sigma, p.r, p.q, p.T + ht);
+            const auto dn_t = fused_greeks(call, p.S, p.K, p.sigma, p.r, p.q, p.T - ht);
+
+            REQUIRE(g.vanna == Catch::Approx((up_v.delta - dn_v.delta) / (2 * hv)).epsilon(tol_rel));
+            REQUIRE(g.vanna == Catch::Approx((up_s.vega - dn_s.vega) / (2 * hs)).epsilon(tol_rel));
+            REQUIRE(g.volga == Catch::Approx((up_v.vega - dn_v.vega) / (2 * hv)).epsilon(tol_rel).margin(1e-6));
+            // charm and color are calendar time derivatives, i.e. minus the derivative in time to expiry
+            REQUIRE(g.charm == Catch::Approx(-(up_t.delta - dn_t.delta) / (2 * ht)).epsilon(tol_rel));
+            REQUIRE(g.speed == Catch::Approx((up_s.gamma - dn_s.gamma) / (2 * hs)).epsilon(tol_rel));
+            REQUIRE(g.color == Catch::Approx(-(up_t.gamma - dn_t.gamma) / (2 * ht)).epsilon(tol_rel));
+            REQUIRE(g.theta == Catch::Approx(-(up_t.price - dn_t.price) / (2 * ht)).epsilon(tol_rel));
+        }
+    }
+}
+
+TEST_CASE("fused batch Greeks skip empty columns and check sizes", "[bs][greeks][batch]") {
+    const std::vector<double> S{90.0, 100.0, 110.0}, K(3, 100.0), sigma(3, 0.2), r(3, 0.03), q(3, 0.01), T(3, 0.75);
+    const option_batch batch{S, K, sigma, r, T, q};
+
+    std::vector<double> vanna(3), volga(3);
+    greeks_batch out;
+    out.vanna = vanna;
+    out.volga = volga;
+    black_scholes_call_greeks_batch(batch, out);
+    for (std::size_t i = 0; i < 3; ++i) {
+        const auto g = fused_greeks(true, S[i], K[i], sigma[i], r[i], q[i], T[i]);
+        REQUIRE(vanna[i] == g.vanna);
+        REQUIRE(volga[i] == g.volga);
+    }
+
+    std::vector<double> short_column(2);
+    out.delta = short_column;
+    REQUIRE_THROWS_AS(black_scholes_put_greeks_batch(batch, out), std::invalid_argument);
+
+    const std::vector<double> zero_time{0.75, 0.0, 0.75};
+    REQUIRE_THROWS_AS(black_scholes_call_greeks_batch({S, K, sigma, r, zero_time, q}, {.vanna = vanna}),
+        std::invalid_argument);
+}
+
+TEST_CASE("bs_kernel prices match the dividend yield closed form and parity", "[bs][kernel]") {
+    for (auto p : cases) {
+        const bs_kernel k(p.S, p.K, p.sigma, p.r, p.T, p.q);
+        const double d1 = ref_d1(p.S, p.K, p.sigma, p.r, p.q, p.T);
+        const double d2 = ref_d2(d1, p.sigma, p.T);
+        const double call = p.S * std::exp(-p.q * p.T) * normal_cdf(d1) - p.K * std::exp(-p.r * p.T) * normal_cdf(d2);
+        const double put = p.K * std::exp(-p.r * p.T) * normal_cdf(-d2) - p.S * std::exp(-p.q * p.T) * normal_cdf(-d1);
+
+        REQUIRE(k.price(option_type::call) == Catch::Approx(call).epsilon(1e-12));
+        REQUIRE(k.price(option_type::put) == Catch::Approx(put).epsilon(1e-12));
+        REQUIRE(black_scholes_call(p.S, p.K, p.sigma, p.r, p.T, p.q) == k.price(option_type::call));
+        REQUIRE(black_scholes_put(p.S, p.K, p.sigma, p.r, p.T, p.q) == k.price(option_type::put));
+        REQUIRE(k.cdf_d1 + k.cdf_minus_d1 == Catch::Approx(1.0));
+    }
+
+    REQUIRE_THROWS_AS(bs_kernel(100.0, 100.0, 0.0, 0.05, 1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(bs_kernel::with_carry(100.0, 100.0, 0.2, 0.05, 0.0, 0.0), std::invalid_argument);
+}
+
+TEST_CASE("bs_kernel with zero carry is Black-76 and carry rho matches finite differences", "[bs][kernel]") {
+    const double F = 102.0, K = 100.0, sigma = 0.3, r = 0.04, T = 0.8;
+    const auto k = bs_kernel::with_carry(F, K, sigma, r, T, 0.0);
+
+    const double d1 = (std::log(F / K) + 0.5 * sigma * sigma * T) / (sigma * std::sqrt(T));
+    const double d2 = d1 - sigma * std::sqrt(T);
+    const double black76 = std::exp(-r * T) * (F * normal_cdf(d1) - K * normal_cdf(d2));
+    REQUIRE(k.price(option_type::call) == Catch::Approx(black76).epsilon(1e-12));
+    // with the carry pinned at zero the rate only discounts
+    REQUIRE(k.rho(option_type::call) - k.carry_rho(option_type::call) ==
+        Catch::Approx(-T * k.price(option_type::call)).epsilon(1e-12));
+
+    const double h = 1e-6;
+    for (const auto type : {option_type::call, option_type::put}) {
+        const double up = bs_kernel::with_carry(F, K, sigma, r, T, h).price(type);
+        const double dn = bs_kernel::with_carry(F, K, sigma, r, T, -h).price(type);
+        REQUIRE(k.carry_rho(type) == Catch::Approx((up - dn) / (2 * h)).epsilon(1e-6));
+
+        const double up_r = bs_kernel(F, K, sigma, r + h, T, 0.01).price(type);
+        const double dn_r = bs_kernel(F, K, sigma, r - h, T, 0.01).price(type);
+        REQUIRE(bs_kernel(F, K, sigma, r, T, 0.01).rho(type) == Catch::Approx((up_r - dn_r) / (2 * h)).epsilon(1e-6));
+    }
+}
+
+TEST_CASE("bump and reprice on the closed form recovers the analytic Greeks in one pricer call", "[bump][greeks]") {
+    const std::vector<double> S{80.0, 100.0, 120.0}, K(3, 100.0), sigma{0.3, 0.2, 0.25}, r{0.05, 0.03, 0.01},
+        T{0.5, 1.0, 2.0}, q{0.0, 0.02, 0.01};
+    const option_batch batch{S, K, sigma, r, T, q};
+
+    int calls = 0;
+    std::vector<pyfi::bump::greeks> out(3);
+    pyfi::bump::bump_and_reprice(
+        batch,
+        [&](const option_batch& scenarios, std::span<double> prices) {
+            ++calls;
+            REQUIRE(scenarios.size() == 9 * batch.size());
+            black_scholes_put_batch(scenarios, prices);
+        },
+        out);
+    REQUIRE(calls == 1);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        const bs_kernel k(S[i], K[i], sigma[i], r[i], T[i], q[i]);
+        REQUIRE(out[i].price == k.price(option_type::put));
+        REQUIRE(out[i].delta == Catch::Approx(k.delta(option_type::put)).epsilon(1e-3));
+        REQUIRE(out[i].gamma == Catch::Approx(k.gamma()).epsilon(1e-3));
+        REQUIRE(out[i].vega == Catch::Approx(k.vega()).epsilon(1e-3));
+        REQUIRE(out[i].theta == Catch::Approx(k.theta(option_type::put)).epsilon(1e-3));
+        REQUIRE(out[i].rho == Catch::Approx(k.rho(option_type::put)).epsilon(1e-3));
+    }
+
+    std::vector<pyfi::bump::greeks> short_out(2);
+    REQUIRE_THROWS_AS(
+        pyfi::bump::bump_and_reprice(batch, pyfi::bump::black_scholes_pricer(option_type::call), short_out),
+        std::invalid_argument);
+}
+
+TEST_CASE("Monte Carlo bump and reprice on common random numbers is close to analytic", "[bump][greeks][mc]") {
+    const std::vector<double> S{100.0}, K{105.0}, sigma{0.25}, r{0.04}, T{1.0}, q{0.01};
+    const option_batch batch{S, K, sigma, r, T, q};
+    const bs_kernel k(S[0], K[0], sigma[0], r[0], T[0], q[0]);
+
+    std::vector<pyfi::bump::greeks> out(1);
+    const auto pricer = pyfi::bump::monte_carlo_pricer(
+        option_type::call, pyfi::monte_carlo::payoff_style::european, {200'000, 1, 5, true});
+    pyfi::bump::bump_and_reprice(batch, pricer, out, {.spot = 0.05});
+
+    // the bumped scenarios share every path, so the differences are far tighter than the price noise
+    REQUIRE(std::abs(out[0].delta - k.delta(option_type::call)) < 5e-3);
+    REQUIRE(std::abs(out[0].gamma - k.gamma()) < 1e-3);
+    REQUIRE(std::abs(out[0].vega - k.vega()) < 0.5);
+    REQUIRE(std::abs(out[0].theta - k.theta(option_type::call)) < 0.2);
+    REQUIRE(std::abs(out[0].rho - k.rho(option_type::call)) < 0.5);
+}
+
+TEST_CASE("lattice Greeks reuse the base tree and match bump and reprice", "[bump][greeks][binomial]") {
+    const std::vector<double> S{90.0, 100.0, 110.0}, K(3, 100.0), sigma(3, 0.25), r(3, 0.05), T(3, 1.0),
+        q(3, 0.01);
+    const option_batch batch{S, K, sigma, r, T, q};
+    const int steps = 800;
+
+    std::vector<pyfi::bump::greeks> european(3);
+    pyfi::bump::binomial_greeks(batch, option_type::call, false, steps, european);
+    for (std::size_t i = 0; i < 3; ++i) {
+        const bs_kernel k(S[i], K[i], sigma[i], r[i], T[i], q[i]);
+        REQUIRE(std::abs(european[i].price - k.price(option_type::call)) < 1e-2);
+        REQUIRE(std::abs(european[i].delta - k.delta(option_type::call)) < 1e-3);
+        REQUIRE(std::abs(european[i].gamma - k.gamma()) < 1e-3);
+        REQUIRE(std::abs(european[i].vega - k.vega()) < 0.2);
+        REQUIRE(std::abs(european[i].theta - k.theta(option_type::call)) < 0.05);
+        REQUIRE(std::abs(european[i].rho - k.rho(option_type::call)) < 0.2);
+    }
+
+    // a small spot bump lands between lattice nodes and makes the bumped gamma oscillate with the step count, the
+    // nodes of the base tree do not, so compare against a wide bump
+    std::vector<pyfi::bump::greeks> american(3), bumped(3);
+    pyfi::bump::binomial_greeks(batch, option_type::put, true, steps, american);
+    pyfi::bump::bump_and_reprice(
+        batch, pyfi::bump::binomial_pricer(option_type::put, true, steps), bumped, {.spot = 0.05});
+    for (std::size_t i = 0; i < 3; ++i) {
+        REQUIRE(american[i].price == Catch::Approx(bumped[i].price).epsilon(1e-12));
+        REQUIRE(american[i].price >= bs_kernel(S[i], K[i], sigma[i], r[i], T[i], q[i]).price(option_type::put));
+        REQUIRE(american[i].delta < 0.0);
+        REQUIRE(american[i].delta > -1.0);
+        REQUIRE(std::abs(american[i].delta - bumped[i].delta) < 5e-3);
+        REQUIRE(std::abs(american[i].gamma - bumped[i].gamma) < 5e-4);
+        REQUIRE(american[i].vega == Catch::Approx(bumped[i].vega).epsilon(1e-12));
+        REQUIRE(std::abs(american[i].theta - bumped[i].theta) < 0.1);
+    }
+
+    REQUIRE_THROWS_AS(pyfi::bump::binomial_pricer(option_type::put, true, 0), std::invalid_argument);
+}
+
+TEST_CASE("volatility bumps shrink so low volatility rows stay positive", "[bump][greeks]") {
+    // sigma 0.005 is below the default 0.01 bump, which would take its down scenario to -0.005; at the money
+    // forward, so its vega is not lost under the difference's own error
+    const std::vector<double> S{100.0, 100.0}, K{100.0, 100.0}, sigma{0.005, 0.25}, r(2, 0.0), T(2, 1.0), q(2, 0.0);
+    const option_batch batch{S, K, sigma, r, T, q};
+
+    std::vector<pyfi::bump::greeks> closed(2), tree(2), lattice(2);
+    pyfi::bump::bump_and_reprice(batch, pyfi::bump::black_scholes_pricer(option_type::call), closed);
+    pyfi::bump::bump_and_reprice(batch, pyfi::bump::binomial_pricer(option_type::call, false, 400), tree);
+    pyfi::bump::binomial_greeks(batch, option_type::call, false, 400, lattice);
+    for (std::size_t i = 0; i < 2; ++i) {
+        const double vega = bs_kernel(S[i], K[i], sigma[i], r[i], T[i], q[i]).vega();
+        REQUIRE(closed[i].vega == Catch::Approx(vega).epsilon(1e-3));
+        REQUIRE(std::isfinite(tree[i].vega));
+        REQUIRE(tree[i].vega == Catch::Approx(lattice[i].vega).epsilon(1e-12));
+    }
+    REQUIRE(std::abs(tree[1].vega - closed[1].vega) < 0.2);
+}
@@ -0,0 +1,95 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "pyfi/memory.h"
+#include "pyfi/option.h"
+
+using namespace pyfi;
+
+namespace {
+    // the VmFlags line of the mapping holding address in /proc/self/smaps, empty where there is none
+    std::string vm_flags(const void* address) {
+        const auto target = reinterpret_cast<std::uintptr_t>(address);
+        std::ifstream smaps("/proc/self/smaps");
+        std::string line;
+        bool inside = false;
+        while (std::getline(smaps, line)) {
+            std::uintptr_t begin = 0;
+            std::uintptr_t end = 0;
+            char dash = 0;
+            std::istringstream header(line);
+            if (header >> std::hex >> begin >> dash >> end && dash == '-') {
+                inside = begin <= target && target < end;
+            } else if (inside && line.rfind("VmFlags:", 0) == 0) {
+                return line;
+            }
+        }
+        return {};
+    }
+} // namespace
+
+TEST_CASE("buffers are zeroed, huge page aligned and movable", "[memory]") {
+    memory::buffer<double> buffer(1'000'003);
+    REQUIRE(buffer.size() == 1'000'003);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(buffer.data()) % memory::huge_page_size() == 0);
+    REQUIRE(std::all_of(buffer.begin(), buffer.end(), [](const double x) { return x == 0.0; }));
+
+    buffer[buffer.size() - 1] = 4.0;
+    memory::buffer<double> moved(std::move(buffer));
+    REQUIRE(buffer.data() == nullptr);
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(moved[moved.size() - 1] == 4.0);
+
+    memory::buffer<int> small(3, {.huge_pages = false, .first_touch = false});
+    REQUIRE(small.size() == 3);
+    small[2] = 7;
+    moved = memory::buffer<double>();
+    REQUIRE(moved.size() == 0);
+
+    REQUIRE_THROWS_AS(memory::buffer<double>(8, {.numa = memory::numa_policy::bind, .node = -1}),
+        std::invalid_argument);
+}
+
+TEST_CASE("buffers opt in or out of transparent huge pages", "[memory]") {
+    const memory::buffer<double> huge(1 << 20, {.first_touch = false});
+    const memory::buffer<double> normal(1 << 20, {.huge_pages = false, .first_touch = false});
+    const auto huge_flags = vm_flags(huge.data());
+    const auto normal_flags = vm_flags(normal.data());
+    if (huge_flags.empty() || normal_flags.empty()) {
+        WARN("no /proc/self/smaps, huge page advice not checked");
+        return;
+    }
+    // hg is MADV_HUGEPAGE and nh MADV_NOHUGEPAGE, so the normal buffer stays on 4 KiB pages under THP always
+    REQUIRE(huge_flags.find(" hg") != std::string::npos);
+    REQUIRE(normal_flags.find(" nh") != std::string::npos);
+}
+
+TEST_CASE("buffers plug into the batch pricers", "[memory]") {
+    constexpr std::size_t n = 100'000;
+    // interleaving is valid on a single node machine as well
+    const memory::placement placement{.numa = memory::numa_policy::interleave};
+    memory::buffer<double> S(n, placement), K(n, placement), sigma(n, placement), r(n, placement), T(n, placement),
+        q(n, placement), out(n, placement);
+    for (std::size_t i = 0; i < n; ++i) {
+        S[i] = 80.0 + static_cast<double>(i % 41);
+        K[i] = 100.0;
+        sigma[i] = 0.2;
+        r[i] = 0.03;
+        T[i] = 0.5;
+    }
+    option::black_scholes_call_batch({S, K, sigma, r, T, q}, out);
+    for (const std::size_t i : {std::size_t{0}, n / 2, n - 1}) {
+        REQUIRE(out[i] == Catch::Approx(option::black_scholes_call(S[i], K[i], 0.2, 0.03, 0.5)).epsilon(1e-14));
+    }
+}
@@ -0,0 +1,127 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/monte_carlo.h"
+#include "pyfi/option.h"
+
+using namespace pyfi;
+using monte_carlo::estimate;
+using monte_carlo::greek_estimator;
+using monte_carlo::mc_config;
+using monte_carlo::payoff_style;
+using option::option_type;
+
+TEST_CASE("Monte Carlo European prices agree with Black-Scholes within the standard error", "[mc]") {
+    const mc_config config{200'000, 1, 7, true};
+    for (const auto type : {option_type::call, option_type::put}) {
+        for (const double K : {80.0, 100.0, 125.0}) {
+            const auto result = monte_carlo::price(100.0, K, 0.25, 0.03, 1.5, 0.02, type, payoff_style::european, config);
+            const double expected = option::bs_kernel(100.0, K, 0.25, 0.03, 1.5, 0.02).price(type);
+            REQUIRE(result.standard_error > 0.0);
+            REQUIRE(std::abs(result.price - expected) < 4.0 * result.standard_error);
+        }
+    }
+}
+
+TEST_CASE("Monte Carlo batch rows share the random numbers and match the scalar pricer", "[mc][batch]") {
+    const std::vector<double> S{90.0, 100.0, 110.0};
+    const std::vector<double> K{100.0, 100.0, 100.0};
+    const std::vector<double> sigma{0.2, 0.2, 0.2};
+    const std::vector<double> r{0.05, 0.05, 0.05};
+    const std::vector<double> T{1.0, 1.0, 1.0};
+    const std::vector<double> q{0.0, 0.0, 0.0};
+    const option::option_batch batch{S, K, sigma, r, T, q};
+    const mc_config config{20'000, 4, 11, true};
+
+    std::vector<double> out(3);
+    std::vector<double> se(3);
+    monte_carlo::price_batch(batch, option_type::call, payoff_style::asian, config, out, se);
+    for (std::size_t i = 0; i < 3; ++i) {
+        const auto single =
+            monte_carlo::price(S[i], K[i], sigma[i], r[i], T[i], q[i], option_type::call, payoff_style::asian, config);
+        REQUIRE(out[i] == single.price);
+        REQUIRE(se[i] == single.standard_error);
+    }
+    // on common paths the call price is monotone in the spot, sample by sample
+    REQUIRE(out[0] < out[1]);
+    REQUIRE(out[1] < out[2]);
+}
+
+TEST_CASE("Monte Carlo Asian payoff averages the monitoring dates", "[mc]") {
+    const mc_config one_date{50'000, 1, 3, true};
+    const auto european = monte_carlo::price(100.0, 100.0, 0.3, 0.02, 1.0, 0.0, option_type::call, payoff_style::european, one_date);
+    const auto single = monte_carlo::price(100.0, 100.0, 0.3, 0.02, 1.0, 0.0, option_type::call, payoff_style::asian, one_date);
+    REQUIRE(single.price == Catch::Approx(european.price).epsilon(1e-12));
+
+    const mc_config monthly{50'000, 12, 3, true};
+    const auto asian = monte_carlo::price(100.0, 100.0, 0.3, 0.02, 1.0, 0.0, option_type::call, payoff_style::asian, monthly);
+    REQUIRE(asian.price > 0.0);
+    REQUIRE(asian.price < european.price);
+}
+
+TEST_CASE("pathwise and likelihood ratio Greeks agree with Black-Scholes within their standard errors", "[mc][greeks]") {
+    const mc_config config{400'000, 1, 19, true};
+    for (const auto type : {option_type::call, option_type::put}) {
+        for (const double K : {90.0, 100.0, 115.0}) {
+            const option::bs_kernel k(100.0, K, 0.3, 0.04, 1.25, 0.015);
+            const auto base = monte_carlo::price(100.0, K, 0.3, 0.04, 1.25, 0.015, type, payoff_style::european, config);
+            for (const auto estimator : {greek_estimator::pathwise, greek_estimator::likelihood_ratio}) {
+                const auto g =
+                    monte_carlo::greeks(100.0, K, 0.3, 0.04, 1.25, 0.015, type, payoff_style::european, estimator, config);
+                // same paths as the plain pricer
+                REQUIRE(g.price.value == Catch::Approx(base.price).epsilon(1e-12));
+                REQUIRE(std::abs(g.delta.value - k.delta(type)) < 4.0 * g.delta.standard_error);
+                REQUIRE(std::abs(g.gamma.value - k.gamma()) < 4.0 * g.gamma.standard_error);
+                REQUIRE(std::abs(g.vega.value - k.vega()) < 4.0 * g.vega.standard_error);
+            }
+        }
+    }
+}
+
+TEST_CASE("pathwise Greeks have lower variance than likelihood ratio and match bumped Asian prices", "[mc][greeks]") {
+    const mc_config config{100'000, 12, 23, true};
+    const auto pathwise = monte_carlo::greeks(
+        100.0, 100.0, 0.25, 0.03, 1.0, 0.0, option_type::call, payoff_style::asian, greek_estimator::pathwise, config);
+    const auto ratio = monte_carlo::greeks(
+        100.0, 100.0, 0.25, 0.03, 1.0, 0.0, option_type::call, payoff_style::asian, greek_estimator::likelihood_ratio, config);
+    REQUIRE(pathwise.delta.standard_error < ratio.delta.standard_error);
+    REQUIRE(pathwise.vega.standard_error < ratio.vega.standard_error);
+
+    const auto within = [](const estimate& a, const estimate& b) {
+        return std::abs(a.value - b.value) < 4.0 * std::hypot(a.standard_error, b.standard_error);
+    };
+    REQUIRE(within(pathwise.delta, ratio.delta));
+    REQUIRE(within(pathwise.gamma, ratio.gamma));
+    REQUIRE(within(pathwise.vega, ratio.vega));
+
+    // central differences on common random numbers are close to the pathwise derivative
+    const double h = 0.5;
+    const auto up = monte_carlo::price(100.0 + h, 100.0, 0.25, 0.03, 1.0, 0.0, option_type::call, payoff_style::asian, config);
+    const auto down = monte_carlo::price(100.0 - h, 100.0, 0.25, 0.03, 1.0, 0.0, option_type::call, payoff_style::asian, config);
+    REQUIRE(pathwise.delta.value == Catch::Approx((up.price - down.price) / (2.0 * h)).epsilon(1e-3));
+}
+
+TEST_CASE("Monte Carlo pricer validates its inputs", "[mc]") {
+    REQUIRE_THROWS_AS(monte_carlo::price(100.0, 100.0, 0.2, 0.05, 1.0, 0.0, option_type::call, payoff_style::european,
+                          mc_config{0, 1, 42, true}),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(monte_carlo::price(100.0, 100.0, 0.0, 0.05, 1.0, 0.0, option_type::call, payoff_style::european),
+        std::invalid_argument);
+
+    const std::vector<double> one{1.0};
+    const option::option_batch batch{one, one, one, one, one, one};
+    std::vector<double> out(2);
+    REQUIRE_THROWS_AS(monte_carlo::price_batch(batch, option_type::put, payoff_style::european, {}, out),
+        std::invalid_argument);
+    std::vector<monte_carlo::mc_greeks> greeks(2);
+    REQUIRE_THROWS_AS(
+        monte_carlo::greeks_batch(batch, option_type::call, payoff_style::asian, {}, greek_estimator::pathwise, greeks),
+        std::invalid_argument);
+}
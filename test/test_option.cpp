@@ -4,7 +4,9 @@
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include "pyfi/option.h"
 
@@ -252,6 +254,51 @@ TEST_CASE("American call and put options") {
     REQUIRE(us_put == Approx(6196.960383141373));
 }
 
+TEST_CASE("Adaptive binomial pricers stop once within tolerance") {
+    for (const double S : {80.0, 100.0, 120.0}) {
+        for (const double sigma : {0.15, 0.4}) {
+            for (const double T : {0.25, 2.0}) {
+                const binomial_tolerance tolerance{.tolerance = 1e-3};
+                const auto call = binomial_eu_option_adaptive(S, 100.0, sigma, 0.03, T, call_payoff, tolerance);
+                const auto put = binomial_eu_option_adaptive(S, 100.0, sigma, 0.03, T, put_payoff, tolerance);
+                REQUIRE(call.converged);
+                REQUIRE(put.converged);
+                REQUIRE(call.error <= 1e-3);
+                REQUIRE(call.price == Approx(black_scholes_call(S, 100.0, sigma, 0.03, T)).margin(2e-3));
+                REQUIRE(put.price == Approx(black_scholes_put(S, 100.0, sigma, 0.03, T)).margin(2e-3));
+            }
+        }
+    }
+
+    // a short dated, far out of the money contract needs only the minimum three levels
+    const auto easy = binomial_eu_option_adaptive(50.0, 100.0, 0.2, 0.03, 0.1, call_payoff);
+    REQUIRE(easy.converged);
+    REQUIRE(easy.steps == 64);
+
+    const auto loose = binomial_eu_option_adaptive(100.0, 100.0, 0.3, 0.03, 1.0, call_payoff, {.tolerance = 1e-2});
+    const auto tight = binomial_eu_option_adaptive(100.0, 100.0, 0.3, 0.03, 1.0, call_payoff, {.tolerance = 1e-4});
+    REQUIRE(loose.steps < tight.steps);
+
+    const auto american = binomial_us_option_adaptive(100.0, 100.0, 0.3, 0.05, 1.0, put_payoff, {.tolerance = 1e-3});
+    const auto reference = 0.5 * (binomial_us_option(100.0, 100.0, 0.3, 0.05, 4000, 1.0, put_payoff) +
+        binomial_us_option(100.0, 100.0, 0.3, 0.05, 4001, 1.0, put_payoff));
+    REQUIRE(american.converged);
+    REQUIRE(american.price == Approx(reference).margin(3e-3));
+
+    // out of steps before the tolerance is met
+    const auto capped = binomial_eu_option_adaptive(
+        100.0, 100.0, 0.3, 0.03, 1.0, call_payoff, {.tolerance = 1e-9, .min_steps = 16, .max_steps = 256});
+    REQUIRE_FALSE(capped.converged);
+    REQUIRE(capped.steps == 256);
+    REQUIRE(capped.error > 1e-9);
+
+    REQUIRE_THROWS_AS(binomial_eu_option_adaptive(100.0, 100.0, 0.3, 0.03, 1.0, call_payoff, {.tolerance = 0.0}),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(
+        binomial_us_option_adaptive(100.0, 100.0, 0.3, 0.03, 1.0, put_payoff, {.min_steps = 64, .max_steps = 32}),
+        std::invalid_argument);
+}
+
 TEST_CASE("forward_from_yield and yield_from_forward round-trip") {
     const double S0 = 100.0;
     const double r  = 0.03;
@@ -263,3 +310,80 @@ TEST_CASE("forward_from_yield and yield_from_forward round-trip") {
 
     REQUIRE(q_back == Approx(q).epsilon(1e-12));
 }
+
+TEST_CASE("Batch Black-Scholes matches the scalar pricers") {
+    const std::vector<double> S{300.0, 100.0, 50.0, 120.0, 80.0};
+    const std::vector<double> K{250.0, 100.0, 60.0, 100.0, 100.0};
+    const std::vector<double> sigma{0.15, 0.20, 0.25, 0.30, 0.10};
+    const std::vector<double> r{0.03, 0.0, 0.05, 0.01, 0.0};
+    const std::vector<double> T{1.0, 1.0, 0.5, 2.0, 1.0};
+    const std::vector<double> q{0.0, 0.0, 0.0, 0.0, 0.0};
+
+    const option_batch batch{S, K, sigma, r, T, q};
+    REQUIRE(batch.size() == S.size());
+
+    std::vector<double> calls(S.size());
+    std::vector<double> puts(S.size());
+    black_scholes_call_batch(batch, calls);
+    black_scholes_put_batch(batch, puts);
+
+    for (std::size_t i = 0; i < S.size(); ++i) {
+        REQUIRE(calls[i] == Approx(black_scholes_call(S[i], K[i], sigma[i], r[i], T[i], q[i])).margin(1e-12));
+        REQUIRE(puts[i] == Approx(black_scholes_put(S[i], K[i], sigma[i], r[i], T[i], q[i])).margin(1e-12));
+    }
+
+    const auto tail = batch.slice(2, 3);
+    std::vector<double> tail_calls(3);
+    black_scholes_call_batch(tail, tail_calls);
+    REQUIRE(tail_calls[0] == Approx(calls[2]).margin(1e-12));
+    REQUIRE(tail_calls[2] == Approx(calls[4]).margin(1e-12));
+}
+
+TEST_CASE("Prefetch and streaming stores leave batch results unchanged") {
+    std::vector<double> S, K, sigma, r, T, q;
+    for (int i = 0; i < 1001; ++i) {
+        S.push_back(50.0 + 0.1 * i);
+        K.push_back(100.0);
+        sigma.push_back(0.1 + 0.0003 * i);
+        r.push_back(0.02);
+        T.push_back(0.1 + 0.002 * i);
+        q.push_back(0.01);
+    }
+    const option_batch batch{S, K, sigma, r, T, q};
+    const auto n = batch.size();
+    std::vector<double> plain(n), plain_delta(n), plain_vega(n);
+    black_scholes_put_batch(batch, plain);
+    black_scholes_put_greeks_batch(batch, {.delta = plain_delta, .vega = plain_vega});
+
+    for (const auto hints : {pyfi::memory::access_hints{64, false},
+             pyfi::memory::access_hints{0, true},
+             pyfi::memory::access_hints{256, true}}) {
+        // an output offset by one double, so the streaming stores are not 16 byte aligned
+        std::vector<double> storage(n + 1), delta(n), vega(n);
+        const std::span<double> out(storage.data() + 1, n);
+        black_scholes_put_batch(batch, out, hints);
+        black_scholes_put_greeks_batch(batch, {.delta = delta, .vega = vega}, hints);
+        REQUIRE(std::equal(out.begin(), out.end(), plain.begin()));
+        REQUIRE(delta == plain_delta);
+        REQUIRE(vega == plain_vega);
+    }
+}
+
+TEST_CASE("Batch Black-Scholes rejects bad inputs") {
+    const std::vector<double> S{100.0, 100.0};
+    const std::vector<double> K{100.0, 100.0};
+    const std::vector<double> sigma{0.2, 0.0};
+    const std::vector<double> r{0.01, 0.01};
+    const std::vector<double> T{1.0, 1.0};
+    const std::vector<double> q{0.0};
+
+    std::vector<double> out(2);
+    REQUIRE_THROWS_AS(black_scholes_call_batch({S, K, sigma, r, T, q}, out), std::invalid_argument);
+
+    const std::vector<double> q2{0.0, 0.0};
+    REQUIRE_THROWS_AS(black_scholes_put_batch({S, K, sigma, r, T, q2}, out), std::invalid_argument);
+
+    std::vector<double> short_out(1);
+    const std::vector<double> good_sigma{0.2, 0.3};
+    REQUIRE_THROWS_AS(black_scholes_call_batch({S, K, good_sigma, r, T, q2}, short_out), std::invalid_argument);
+}
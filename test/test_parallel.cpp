@@ -0,0 +1,83 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/parallel.h"
+
+using namespace pyfi::parallel;
+
+TEST_CASE("parallel_for visits every index exactly once") {
+    thread_pool pool(4);
+    REQUIRE(pool.size() == 4);
+
+    for (const std::size_t grain : {0, 1, 7, 1000, 5000}) {
+        std::vector<int> hits(4321, 0);
+        pool.parallel_for(hits.size(), grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                ++hits[i];
+            }
+        });
+        REQUIRE(std::accumulate(hits.begin(), hits.end(), 0) == 4321);
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }));
+    }
+}
+
+TEST_CASE("parallel_for rethrows the first exception and stays usable") {
+    thread_pool pool(3);
+    REQUIRE_THROWS_AS(pool.parallel_for(1000,
+                          10,
+                          [](std::size_t begin, std::size_t) {
+                              if (begin == 500) {
+                                  throw std::runtime_error("boom");
+                              }
+                          }),
+        std::runtime_error);
+
+    std::atomic<std::size_t> total{0};
+    pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end) { total += end - begin; });
+    REQUIRE(total == 1000);
+}
+
+TEST_CASE("single thread pool runs loops inline") {
+    thread_pool pool(1);
+    std::size_t calls = 0;
+    pool.parallel_for(100, 10, [&](std::size_t, std::size_t) { ++calls; });
+    REQUIRE(calls == 10);
+
+    std::size_t total = 0;
+    parallel_for(100, 0, [&](std::size_t begin, std::size_t end) {
+        static std::mutex guard;
+        std::lock_guard lock(guard);
+        total += end - begin;
+    });
+    REQUIRE(total == 100);
+}
+
+TEST_CASE("nested parallel_for on the same pool runs inline") {
+    thread_pool pool(4);
+    std::vector<std::atomic<int>> hits(64 * 50);
+    pool.parallel_for(64, 1, [&](std::size_t outer_begin, std::size_t outer_end) {
+        for (std::size_t i = outer_begin; i < outer_end; ++i) {
+            pool.parallel_for(50, 7, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t j = begin; j < end; ++j) {
+                    ++hits[i * 50 + j];
+                }
+            });
+        }
+    });
+    REQUIRE(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& h) { return h == 1; }));
+
+    std::atomic<std::size_t> total{0};
+    parallel_for(16, 1, [&](std::size_t, std::size_t) {
+        parallel_for(100, 0, [&](std::size_t begin, std::size_t end) { total += end - begin; });
+    });
+    REQUIRE(total == 1600);
+}
@@ -0,0 +1,138 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/option.h"
+
+using namespace pyfi::option;
+
+namespace {
+    struct chain_columns {
+        std::vector<int> underlying;
+        std::vector<double> time, strike, call, put;
+
+        void add(const int id, const double S, const double K, const double r, const double q, const double T) {
+            const bs_kernel k(S, K, 0.25, r, T, q);
+            underlying.push_back(id);
+            time.push_back(T);
+            strike.push_back(K);
+            call.push_back(k.price(option_type::call));
+            put.push_back(k.price(option_type::put));
+        }
+
+        [[nodiscard]] parity_chain view() const {
+            return {underlying, time, strike, call, put};
+        }
+    };
+
+    const std::vector<double> spots{100.0, 50.0, 250.0};
+    const std::vector<double> expiries{0.25, 0.5, 1.0, 2.0};
+
+    double true_rate(const double T) {
+        return 0.03 + 0.005 * T;
+    }
+    double true_yield(const int id, const double T) {
+        return 0.01 * id + 0.004 * T;
+    }
+
+    chain_columns make_chain() {
+        chain_columns chain;
+        for (int id = 0; id < 3; ++id) {
+            for (const double T : expiries) {
+                for (int j = -7; j <= 7; ++j) {
+                    chain.add(id, spots[id], spots[id] * (1.0 + 0.05 * j), true_rate(T), true_yield(id, T), T);
+                }
+            }
+        }
+        return chain;
+    }
+} // namespace
+
+TEST_CASE("implied carry recovers the discount, forward and yield of every expiry", "[parity]") {
+    auto chain = make_chain();
+
+    // rows in any order
+    std::vector<std::size_t> order(chain.time.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(5));
+    chain_columns shuffled;
+    for (const auto i : order) {
+        shuffled.underlying.push_back(chain.underlying[i]);
+        shuffled.time.push_back(chain.time[i]);
+        shuffled.strike.push_back(chain.strike[i]);
+        shuffled.call.push_back(chain.call[i]);
+        shuffled.put.push_back(chain.put[i]);
+    }
+
+    const auto points = implied_carry_batch(shuffled.view(), spots);
+    REQUIRE(points.size() == 3 * expiries.size());
+    for (std::size_t p = 0; p < points.size(); ++p) {
+        const auto& point = points[p];
+        const int id = static_cast<int>(p / expiries.size());
+        const double T = expiries[p % expiries.size()];
+        REQUIRE(point.underlying == id);
+        REQUIRE(point.time == T);
+        REQUIRE(point.pairs == 15);
+        REQUIRE(point.discount == Catch::Approx(std::exp(-true_rate(T) * T)).epsilon(1e-12));
+        REQUIRE(point.forward == Catch::Approx(forward_from_yield(spots[id], true_rate(T), T, true_yield(id, T))).epsilon(1e-12));
+        REQUIRE(point.risk_free_rate == Catch::Approx(true_rate(T)).margin(1e-10));
+        REQUIRE(point.yield_curve == Catch::Approx(true_yield(id, T)).margin(1e-10));
+    }
+}
+
+TEST_CASE("implied carry shrugs off stale quotes and skips single strike expiries", "[parity]") {
+    auto chain = make_chain();
+    // a stale call and a crossed put on the first expiry of underlying 1
+    const auto first = static_cast<std::size_t>(std::find(chain.underlying.begin(), chain.underlying.end(), 1) -
+        chain.underlying.begin());
+    chain.call[first + 3] += 1.5;
+    chain.put[first + 9] -= 0.8;
+    // an expiry quoted at one strike only cannot be fitted
+    chain.add(2, spots[2], 250.0, 0.03, 0.02, 3.0);
+    chain.add(2, spots[2], 250.0, 0.03, 0.02, 3.0);
+
+    const auto points = implied_carry_batch(chain.view(), spots);
+    REQUIRE(points.size() == 3 * expiries.size());
+    const auto& fitted = points[expiries.size()];
+    REQUIRE(fitted.underlying == 1);
+    REQUIRE(fitted.yield_curve == Catch::Approx(true_yield(1, expiries[0])).margin(1e-6));
+    REQUIRE(fitted.risk_free_rate == Catch::Approx(true_rate(expiries[0])).margin(1e-6));
+
+    REQUIRE_THROWS_AS(implied_carry_batch(chain.view(), std::vector<double>{100.0, 50.0}), std::invalid_argument);
+    const std::vector<int> short_ids{0};
+    REQUIRE_THROWS_AS(implied_carry_batch({short_ids, chain.time, chain.strike, chain.call, chain.put}, spots),
+        std::invalid_argument);
+}
+
+TEST_CASE("carry curve interpolates total carry and fills the yield column", "[parity]") {
+    const carry_curve curve(implied_carry_batch(make_chain().view(), spots));
+
+    REQUIRE(curve.points().size() == 3 * expiries.size());
+    REQUIRE(curve.yield(1, 0.5) == Catch::Approx(true_yield(1, 0.5)).margin(1e-10));
+    // flat outside the pillars
+    REQUIRE(curve.yield(1, 0.1) == Catch::Approx(true_yield(1, 0.25)).margin(1e-10));
+    REQUIRE(curve.yield(1, 5.0) == Catch::Approx(true_yield(1, 2.0)).margin(1e-10));
+    // between pillars q * T is linear
+    const double T = 0.75;
+    const double expected = (true_yield(2, 0.5) * 0.5 + 0.5 * (true_yield(2, 1.0) * 1.0 - true_yield(2, 0.5) * 0.5)) / T;
+    REQUIRE(curve.yield(2, T) == Catch::Approx(expected).margin(1e-10));
+
+    const std::vector<int> ids{0, 2};
+    const std::vector<double> times{1.0, 0.75};
+    std::vector<double> out(2);
+    curve.yield_batch(ids, times, out);
+    REQUIRE(out[0] == curve.yield(0, 1.0));
+    REQUIRE(out[1] == curve.yield(2, 0.75));
+
+    REQUIRE_THROWS_AS(curve.yield(7, 1.0), std::invalid_argument);
+}
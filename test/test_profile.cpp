@@ -0,0 +1,114 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/option.h"
+#include "pyfi/parallel.h"
+#include "pyfi/profile.h"
+
+using namespace pyfi;
+
+namespace {
+    const profile::entry* find(const std::vector<profile::entry>& results, const std::string& name) {
+        for (const auto& e : results) {
+            if (e.name == name) {
+                return &e;
+            }
+        }
+        return nullptr;
+    }
+
+    struct book {
+        std::vector<double> S, K, sigma, r, T, q;
+
+        explicit book(const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                S.push_back(80.0 + static_cast<double>(i % 41));
+                K.push_back(100.0);
+                sigma.push_back(0.2);
+                r.push_back(0.03);
+                T.push_back(0.5);
+                q.push_back(0.01);
+            }
+        }
+
+        [[nodiscard]] option::option_batch batch() const {
+            return {S, K, sigma, r, T, q};
+        }
+    };
+} // namespace
+
+TEST_CASE("sessions count the batch calls made while they are open", "[profile]") {
+    const book contracts(1000);
+    std::vector<double> out(1000);
+
+    // not recorded, no session is open
+    option::black_scholes_call_batch(contracts.batch(), out);
+    REQUIRE_FALSE(profile::enabled());
+
+    profile::session outer;
+    REQUIRE(profile::enabled());
+    REQUIRE(outer.results().empty());
+
+    option::black_scholes_call_batch(contracts.batch(), out);
+    {
+        const profile::session inner;
+        option::black_scholes_call_batch(contracts.batch(), out);
+        option::black_scholes_put_batch(contracts.batch(), out);
+
+        const auto results = inner.results();
+        REQUIRE(results.size() == 2);
+        REQUIRE(results[0].name == "option.black_scholes_call_batch");
+        REQUIRE(results[0].totals.calls == 1);
+        REQUIRE(results[0].totals.rows == 1000);
+        REQUIRE(results[1].name == "option.black_scholes_put_batch");
+    }
+
+    const auto results = outer.results();
+    const auto* call = find(results, "option.black_scholes_call_batch");
+    REQUIRE(call != nullptr);
+    REQUIRE(call->totals.calls == 2);
+    REQUIRE(call->totals.rows == 2000);
+    REQUIRE(call->totals.seconds > 0.0);
+    REQUIRE(find(results, "option.black_scholes_put_batch")->totals.calls == 1);
+
+    const auto table = profile::format(results);
+    REQUIRE(table.find("option.black_scholes_call_batch") != std::string::npos);
+    REQUIRE(table.find("IPC") != std::string::npos);
+}
+
+TEST_CASE("chunks priced on the pool are charged to their own threads", "[profile]") {
+    const book contracts(4096);
+    std::vector<double> price(4096);
+    const std::vector<int> m(4096, 2);
+    const bond::bond_batch bonds{contracts.K, contracts.r, contracts.r, contracts.T, m};
+
+    const profile::session session;
+    parallel::thread_pool pool(4);
+    pool.parallel_for(4096, 256, [&](const std::size_t begin, const std::size_t end) {
+        bond::dirty_coupon_price_from_T_batch(bonds.slice(begin, end - begin),
+            std::span<double>(price).subspan(begin, end - begin));
+    });
+
+    const auto results = session.results();
+    const auto* dirty = find(results, "bond.dirty_coupon_price_from_T_batch");
+    REQUIRE(dirty != nullptr);
+    REQUIRE(dirty->totals.calls == 16);
+    REQUIRE(dirty->totals.rows == 4096);
+
+    // without perf_event_open access, e.g. in a container, only calls and time are recorded
+    if (profile::hardware_available()) {
+        REQUIRE(dirty->totals.hardware_calls == dirty->totals.calls);
+        REQUIRE(dirty->totals[profile::event::cycles] > 0);
+        REQUIRE(dirty->totals[profile::event::instructions] > 0);
+        REQUIRE(dirty->totals.ipc() > 0.0);
+    } else {
+        REQUIRE(dirty->totals.hardware_calls == 0);
+        REQUIRE(profile::format(results).find("n/a") != std::string::npos);
+    }
+}
@@ -0,0 +1,80 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/option.h"
+#include "pyfi/proxy.h"
+
+using namespace pyfi;
+
+namespace {
+    double call(const double S, const double sigma, const double T) {
+        return option::black_scholes_call(S, 100.0, sigma, 0.03, T);
+    }
+
+    const proxy::proxy_config box{{60.0, 140.0, 16}, {0.15, 0.45, 8}, {0.5, 2.0, 8}};
+} // namespace
+
+TEST_CASE("Chebyshev proxy reproduces Black-Scholes within its error estimate", "[proxy]") {
+    const proxy::chebyshev_proxy proxy(call, box);
+
+    REQUIRE(proxy.coefficients() == 16 * 8 * 8);
+    REQUIRE(proxy.error_estimate() < 1e-2);
+    const double error = proxy.max_error(call, 2000);
+    REQUIRE(error < 1e-3);
+    REQUIRE(error <= proxy.error_estimate());
+
+    // exact at the corners of the box, which are grid nodes
+    REQUIRE(proxy(60.0, 0.15, 0.5) == Catch::Approx(call(60.0, 0.15, 0.5)).margin(1e-9));
+    REQUIRE(proxy(140.0, 0.45, 2.0) == Catch::Approx(call(140.0, 0.45, 2.0)).margin(1e-9));
+
+    const std::vector<double> S{70.0, 100.0, 130.0}, sigma{0.2, 0.3, 0.4}, T{0.75, 1.0, 1.5};
+    std::vector<double> out(3);
+    proxy.evaluate_batch(S, sigma, T, out);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        REQUIRE(out[i] == proxy(S[i], sigma[i], T[i]));
+    }
+}
+
+TEST_CASE("Dropping small coefficients trades accuracy for size", "[proxy]") {
+    const proxy::chebyshev_proxy full(call, box);
+    auto config = box;
+    config.drop_tolerance = 1e-4;
+    const proxy::chebyshev_proxy sparse(call, config);
+
+    REQUIRE(sparse.coefficients() < full.coefficients() / 2);
+    REQUIRE(sparse.error_estimate() > full.error_estimate());
+    REQUIRE(sparse.max_error(call, 2000) <= sparse.error_estimate());
+}
+
+TEST_CASE("Chebyshev proxy of an American put lattice", "[proxy]") {
+    const proxy::pricer put = [](const double S, const double sigma, const double T) {
+        return option::binomial_us_option(S, 100.0, sigma, 0.03, 100, T, option::put_payoff);
+    };
+    const proxy::chebyshev_proxy proxy(put, {{70.0, 130.0, 12}, {0.2, 0.4, 6}, {0.5, 1.5, 6}});
+
+    REQUIRE(proxy.max_error(put, 200) < 0.1);
+    REQUIRE(proxy(100.0, 0.3, 1.0) == Catch::Approx(put(100.0, 0.3, 1.0)).margin(0.1));
+}
+
+TEST_CASE("Chebyshev proxy rejects bad boxes and points outside them", "[proxy]") {
+    REQUIRE_THROWS_AS(proxy::chebyshev_proxy(call, {{100.0, 100.0}, {0.1, 0.5}, {0.5, 2.0}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(proxy::chebyshev_proxy(call, {{60.0, 140.0, 1}, {0.1, 0.5}, {0.5, 2.0}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(proxy::chebyshev_proxy(call, {{60.0, 140.0, 65}, {0.1, 0.5}, {0.5, 2.0}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(proxy::chebyshev_proxy(call, {{60.0, 140.0}, {0.1, 0.5}, {0.5, 2.0}, -1.0}),
+        std::invalid_argument);
+
+    const proxy::chebyshev_proxy proxy(call, box);
+    REQUIRE_THROWS_AS(proxy(150.0, 0.2, 1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(proxy(100.0, 0.1, 1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(proxy(100.0, 0.2, 3.0), std::invalid_argument);
+    std::vector<double> out(2);
+    REQUIRE_THROWS_AS(proxy.evaluate_batch(std::vector<double>{100.0}, std::vector<double>{0.2},
+                          std::vector<double>{1.0}, out),
+        std::invalid_argument);
+}
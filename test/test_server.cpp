@@ -0,0 +1,199 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "pyfi/bond.h"
+#include "pyfi/option.h"
+#include "pyfi/server.h"
+
+using namespace pyfi::server;
+using namespace Catch;
+
+static std::string socket_path() {
+    return "/tmp/pyfi_test_server_" + std::to_string(getpid()) + ".sock";
+}
+
+static price_request option_request(std::uint64_t id, request_kind kind, double S, double sigma) {
+    price_request request{};
+    request.id = id;
+    request.kind = kind;
+    request.fields[0] = S;
+    request.fields[1] = 100.0;
+    request.fields[2] = sigma;
+    request.fields[3] = 0.03;
+    request.fields[4] = 1.0;
+    request.fields[5] = 0.0;
+    return request;
+}
+
+TEST_CASE("Server prices pipelined requests from several clients in order") {
+    server_config config;
+    config.socket_path = socket_path();
+    config.target_batch = 8;
+    config.max_batch = 64;
+    pricing_server server(config);
+    std::thread loop([&server] { server.run(); });
+
+    const auto client_run = [&config](const std::uint64_t base, std::vector<price_response>& responses) {
+        const pricing_client client(config.socket_path);
+        std::vector<price_request> requests;
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            const auto S = 80.0 + static_cast<double>(i);
+            requests.push_back(option_request(base + i, i % 2 == 0 ? request_kind::call : request_kind::put, S, 0.2));
+        }
+
+        price_request bond{};
+        bond.id = base + 100;
+        bond.kind = request_kind::bond_dirty;
+        bond.m = 2;
+        bond.fields[0] = 1000.0;
+        bond.fields[1] = 0.05;
+        bond.fields[2] = 0.04;
+        bond.fields[3] = 3.75;
+        requests.push_back(bond);
+
+        requests.push_back(option_request(base + 101, request_kind::call, 100.0, 0.0));
+        price_request unknown{};
+        unknown.id = base + 102;
+        unknown.kind = static_cast<request_kind>(42);
+        requests.push_back(unknown);
+
+        responses.resize(requests.size());
+        client.send(requests);
+        client.receive(responses);
+    };
+
+    std::vector<price_response> first;
+    std::vector<price_response> second;
+    std::thread a(client_run, 0, std::ref(first));
+    std::thread b(client_run, 1000, std::ref(second));
+    a.join();
+    b.join();
+
+    server.stop();
+    loop.join();
+
+    for (const auto* responses : {&first, &second}) {
+        const auto base = responses == &first ? 0 : 1000;
+        REQUIRE(responses->size() == 103);
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            const auto& r = (*responses)[i];
+            REQUIRE(r.id == base + i);
+            REQUIRE(r.status == response_status::ok);
+            const auto S = 80.0 + static_cast<double>(i);
+            const auto expected = i % 2 == 0 ? pyfi::option::black_scholes_call(S, 100.0, 0.2, 0.03, 1.0)
+                                             : pyfi::option::black_scholes_put(S, 100.0, 0.2, 0.03, 1.0);
+            REQUIRE(r.value == Approx(expected).margin(1e-12));
+        }
+        REQUIRE((*responses)[100].value ==
+            Approx(pyfi::bond::dirty_coupon_price_from_T(1000.0, 0.05, 0.04, 3.75, 2)).margin(1e-12));
+        REQUIRE((*responses)[101].status == response_status::bad_input);
+        REQUIRE(std::isnan((*responses)[101].value));
+        REQUIRE((*responses)[102].status == response_status::bad_kind);
+    }
+
+    const auto stats = server.stats();
+    REQUIRE(stats.requests == 206);
+    REQUIRE(stats.connections == 2);
+    REQUIRE(stats.batches >= 1);
+}
+
+TEST_CASE("Server caps batches at max_batch when a client writes faster than it prices") {
+    server_config config;
+    config.socket_path = socket_path();
+    config.target_batch = 8;
+    config.max_batch = 64;
+    config.min_window = std::chrono::microseconds(100000);
+    config.max_window = std::chrono::microseconds(100000);
+    pricing_server server(config);
+    std::thread loop([&server] { server.run(); });
+
+    std::vector<price_request> requests;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        requests.push_back(option_request(i, request_kind::call, 80.0 + static_cast<double>(i % 40), 0.2));
+    }
+    std::vector<price_response> responses(requests.size());
+    {
+        const pricing_client client(config.socket_path);
+        client.send(requests);
+        client.receive(responses);
+    }
+    server.stop();
+    loop.join();
+
+    for (std::uint64_t i = 0; i < requests.size(); ++i) {
+        REQUIRE(responses[i].id == i);
+        REQUIRE(responses[i].status == response_status::ok);
+    }
+    // with a window far longer than the test, only full batches of max_batch are flushed before the last one
+    const auto stats = server.stats();
+    REQUIRE(stats.requests == 1000);
+    REQUIRE(stats.batches >= 1000 / 64);
+}
+
+TEST_CASE("Server sleeps until the batch deadline instead of spinning") {
+    server_config config;
+    config.socket_path = socket_path();
+    config.target_batch = 8;
+    config.max_batch = 64;
+    config.min_window = std::chrono::microseconds(900);
+    config.max_window = std::chrono::microseconds(900);
+    pricing_server server(config);
+
+    // CPU time of the event loop thread against the wall time it ran for
+    double cpu_seconds = 0.0;
+    double wall_seconds = 0.0;
+    std::thread loop([&] {
+        timespec cpu_start{};
+        timespec cpu_end{};
+        const auto wall_start = std::chrono::steady_clock::now();
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+        server.run();
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+        wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+        cpu_seconds = static_cast<double>(cpu_end.tv_sec - cpu_start.tv_sec) +
+            static_cast<double>(cpu_end.tv_nsec - cpu_start.tv_nsec) * 1e-9;
+    });
+
+    // one request at a time, so a batch is pending for a sub-millisecond window on almost every turn of the loop
+    {
+        const pricing_client client(config.socket_path);
+        for (std::uint64_t i = 0; i < 200; ++i) {
+            const std::vector<price_request> request{option_request(i, request_kind::call, 100.0, 0.2)};
+            std::vector<price_response> response(1);
+            client.send(request);
+            client.receive(response);
+            REQUIRE(response[0].id == i);
+        }
+    }
+    server.stop();
+    loop.join();
+
+    REQUIRE(server.stats().requests == 200);
+    REQUIRE(wall_seconds >= 0.18);
+    REQUIRE(cpu_seconds < 0.25 * wall_seconds);
+}
+
+TEST_CASE("Server rejects inconsistent batching parameters") {
+    server_config config;
+    config.socket_path = socket_path();
+    config.target_batch = 100;
+    config.max_batch = 10;
+    REQUIRE_THROWS_AS(pricing_server(config), std::invalid_argument);
+
+    config.max_batch = 1000;
+    config.min_window = std::chrono::microseconds(500);
+    config.max_window = std::chrono::microseconds(100);
+    REQUIRE_THROWS_AS(pricing_server(config), std::invalid_argument);
+}
@@ -0,0 +1,171 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/option.h"
+#include "pyfi/simd.h"
+
+using namespace pyfi;
+
+namespace {
+    constexpr std::size_t W = 8;
+
+    // applies f to xs a pack at a time and returns the largest relative difference from reference
+    template <typename F, typename G>
+    double max_relative_error(const std::vector<double>& xs, const F& f, const G& reference) {
+        double worst = 0.0;
+        std::vector<double> out(W);
+        for (std::size_t i = 0; i + W <= xs.size(); i += W) {
+            simd::store_to<W>(f(simd::load<W>(&xs[i])), out.data());
+            for (std::size_t j = 0; j < W; ++j) {
+                const double expected = reference(xs[i + j]);
+                worst = std::max(worst, std::abs(out[j] - expected) / std::abs(expected));
+            }
+        }
+        return worst;
+    }
+
+    std::vector<double> grid(const double low, const double high, const std::size_t n) {
+        std::vector<double> xs(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            xs[i] = low + (high - low) * static_cast<double>(i) / static_cast<double>(n - 1);
+        }
+        return xs;
+    }
+} // namespace
+
+TEST_CASE("pack exp, log and Phi agree with the scalar functions", "[simd]") {
+    const auto exp = [](const simd::pack<W>& x) { return simd::exp<W>(x); };
+    const auto log = [](const simd::pack<W>& x) { return simd::log<W>(x); };
+    const auto Phi = [](const simd::pack<W>& x) { return simd::Phi<W>(x); };
+    const auto erfc = [](const double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+
+    REQUIRE(max_relative_error(grid(-700.0, 700.0, 80'000), exp, [](const double x) { return std::exp(x); }) < 3e-16);
+    REQUIRE(max_relative_error(grid(1e-300, 1e300, 80'000), log, [](const double x) { return std::log(x); }) < 3e-16);
+    REQUIRE(max_relative_error(grid(0.5, 2.0, 80'000), log, [](const double x) { return std::log(x); }) < 1e-15);
+    REQUIRE(max_relative_error(grid(-30.0, 8.0, 80'000), Phi, erfc) < 2e-15);
+
+    // the edges of the ranges
+    std::vector<double> out(W);
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    const std::vector<double> edges{-800.0, 800.0, infinity, -infinity, 0.0, -1.0, 1e-310, -745.0};
+    simd::store_to<W>(simd::exp<W>(simd::load<W>(edges.data())), out.data());
+    REQUIRE(out[0] == 0.0);
+    REQUIRE(out[1] == infinity);
+    REQUIRE(out[2] == infinity);
+    REQUIRE(out[3] == 0.0);
+    REQUIRE(out[4] == 1.0);
+    REQUIRE(out[7] == Catch::Approx(std::exp(-745.0)));
+    simd::store_to<W>(simd::log<W>(simd::load<W>(edges.data())), out.data());
+    REQUIRE(out[2] == infinity);
+    REQUIRE(out[4] == -infinity);
+    REQUIRE(std::isnan(out[5]));
+    REQUIRE(out[6] == Catch::Approx(std::log(1e-310)).epsilon(1e-15));
+    simd::store_to<W>(simd::Phi<W>(simd::load<W>(edges.data())), out.data());
+    REQUIRE(out[0] == 0.0);
+    REQUIRE(out[1] == 1.0);
+    REQUIRE(out[4] == 0.5);
+}
+
+TEST_CASE("option batch packs of every width match the scalar kernel", "[simd]") {
+    // 1003 rows, so every width leaves a scalar tail
+    constexpr std::size_t n = 1003;
+    std::vector<double> S(n), K(n), sigma(n), r(n), T(n), q(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        S[i] = 20.0 + 0.3 * static_cast<double>(i);
+        K[i] = 100.0;
+        sigma[i] = 0.05 + 0.6 * static_cast<double>(i % 17) / 17.0;
+        r[i] = -0.01 + 0.1 * static_cast<double>(i % 7) / 7.0;
+        T[i] = 0.02 + 5.0 * static_cast<double>(i % 13) / 13.0;
+        q[i] = 0.03 * static_cast<double>(i % 3);
+    }
+    const option::option_batch batch{S, K, sigma, r, T, q};
+
+    const auto columns = [](std::vector<std::vector<double>>& storage) {
+        storage.assign(11, std::vector<double>(n));
+        return option::greeks_batch{storage[0],
+            storage[1],
+            storage[2],
+            storage[3],
+            storage[4],
+            storage[5],
+            storage[6],
+            storage[7],
+            storage[8],
+            storage[9],
+            storage[10]};
+    };
+    std::vector<std::vector<double>> scalar_calls, scalar_puts;
+    option::black_scholes_call_greeks_batch(batch, columns(scalar_calls));
+    option::black_scholes_put_greeks_batch(batch, columns(scalar_puts));
+
+    for (const std::size_t lanes : {4, 8, 16}) {
+        const memory::access_hints hints{0, false, lanes};
+        std::vector<std::vector<double>> calls, puts;
+        option::black_scholes_call_greeks_batch(batch, columns(calls), hints);
+        option::black_scholes_put_greeks_batch(batch, columns(puts), hints);
+        for (std::size_t g = 0; g < 11; ++g) {
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE(calls[g][i] == Catch::Approx(scalar_calls[g][i]).epsilon(1e-12).margin(1e-10));
+                REQUIRE(puts[g][i] == Catch::Approx(scalar_puts[g][i]).epsilon(1e-12).margin(1e-10));
+            }
+        }
+
+        std::vector<double> prices(n);
+        option::black_scholes_call_batch(batch, prices, {0, true, lanes});
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE(prices[i] == Catch::Approx(calls[0][i]).epsilon(1e-14).margin(1e-12));
+        }
+    }
+
+    std::vector<double> prices(n);
+    REQUIRE_THROWS_AS(option::black_scholes_put_batch(batch, prices, {0, false, 2}), std::invalid_argument);
+    sigma[5] = 0.0;
+    REQUIRE_THROWS_AS(option::black_scholes_put_batch(batch, prices, {0, false, 8}), std::invalid_argument);
+}
+
+TEST_CASE("bond batch packs of every width match the scalar pricers", "[simd]") {
+    constexpr std::size_t n = 203;
+    std::vector<double> par(n), coupon(n), yield(n), T(n);
+    std::vector<int> m(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        par[i] = 100.0 + static_cast<double>(i % 5);
+        coupon[i] = 0.01 * static_cast<double>(i % 9);
+        yield[i] = i % 11 == 0 ? 0.0 : -0.005 + 0.1 * static_cast<double>(i % 23) / 23.0;
+        T[i] = 0.1 + 0.25 * static_cast<double>(i % 61);
+        m[i] = std::vector<int>{1, 2, 4, 12}[i % 4];
+    }
+    const bond::bond_batch batch{par, coupon, yield, T, m};
+
+    std::vector<double> dirty(n), clean(n);
+    bond::dirty_coupon_price_from_T_batch(batch, dirty);
+    bond::clean_coupon_price_from_T_batch(batch, clean);
+    for (const std::size_t lanes : {4, 8, 16}) {
+        std::vector<double> out(n);
+        bond::dirty_coupon_price_from_T_batch(batch, out, {0, false, lanes});
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE(out[i] == Catch::Approx(dirty[i]).epsilon(1e-13));
+        }
+        bond::clean_coupon_price_from_T_batch(batch, out, {0, true, lanes});
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE(out[i] == Catch::Approx(clean[i]).epsilon(1e-13));
+        }
+    }
+
+    REQUIRE_THROWS_AS(bond::dirty_coupon_price_from_T_batch(batch, dirty, {0, false, 3}), std::invalid_argument);
+    m[2] = 0;
+    REQUIRE_THROWS_AS(bond::dirty_coupon_price_from_T_batch(batch, dirty, {0, false, 8}), std::invalid_argument);
+    m[2] = 1;
+    m[n - 1] = -1;
+    REQUIRE_THROWS_AS(bond::clean_coupon_price_from_T_batch(batch, clean, {0, false, 16}), std::invalid_argument);
+}
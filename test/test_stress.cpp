@@ -0,0 +1,162 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+// Multithreaded stress tests of the pricing hot paths. Every thread runs the same work on shared inputs and must
+// reproduce the single threaded result bit for bit; built with -DPYFI_TSAN=ON the same run is checked for data races.
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "pyfi/bond.h"
+#include "pyfi/monte_carlo.h"
+#include "pyfi/option.h"
+#include "pyfi/surface.h"
+
+using namespace pyfi;
+using option::option_type;
+
+namespace {
+    std::size_t thread_count() {
+        return std::max<std::size_t>(4, std::thread::hardware_concurrency());
+    }
+
+    // runs work on thread_count() threads at once and returns what each produced; Catch assertions are not thread
+    // safe, so the checks happen on the calling thread afterwards
+    std::vector<std::vector<double>> run_concurrently(const std::function<std::vector<double>()>& work) {
+        std::vector<std::vector<double>> results(thread_count());
+        std::vector<std::thread> threads;
+        threads.reserve(results.size());
+        for (auto& result : results) {
+            threads.emplace_back([&work, &result] { result = work(); });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        return results;
+    }
+
+    void require_identical(const std::function<std::vector<double>()>& work) {
+        const auto reference = work();
+        REQUIRE(!reference.empty());
+        for (const auto& result : run_concurrently(work)) {
+            REQUIRE(result == reference);
+        }
+    }
+
+    struct option_columns {
+        std::vector<double> stock, strike, vol, rate, time, yield;
+
+        explicit option_columns(const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                stock.push_back(80.0 + static_cast<double>(i % 41));
+                strike.push_back(100.0);
+                vol.push_back(0.1 + 0.01 * static_cast<double>(i % 30));
+                rate.push_back(0.03);
+                time.push_back(0.1 + 0.05 * static_cast<double>(i % 20));
+                yield.push_back(0.01);
+            }
+        }
+
+        [[nodiscard]] option::option_batch view() const {
+            return {stock, strike, vol, rate, time, yield};
+        }
+    };
+} // namespace
+
+TEST_CASE("scalar pricers are reentrant", "[stress]") {
+    require_identical([] {
+        std::vector<double> out;
+        for (int i = 0; i < 2000; ++i) {
+            const double x = -8.0 + 0.008 * i;
+            out.push_back(option::Phi(x));
+            out.push_back(option::norm_pdf(x));
+            const option::bs_kernel k(100.0 + x, 100.0, 0.2, 0.03, 0.5, 0.01);
+            out.push_back(k.price(option_type::call));
+            out.push_back(k.price(option_type::put));
+            out.push_back(k.vega());
+            out.push_back(option::black_scholes_call(100.0 + x, 100.0, 0.2, 0.03, 0.5, 0.01));
+            out.push_back(bond::coupon_bond_price(100.0, 0.05, 0.04 + 0.001 * x, 10.0));
+        }
+        for (int steps = 50; steps <= 200; steps += 50) {
+            out.push_back(option::binomial_eu_option(100.0, 95.0, 0.25, 0.03, steps, 1.0, option::put_payoff));
+            out.push_back(option::binomial_us_option(100.0, 95.0, 0.25, 0.03, steps, 1.0, option::put_payoff));
+        }
+        return out;
+    });
+}
+
+TEST_CASE("batch pricers are reentrant on shared inputs", "[stress]") {
+    const option_columns columns(4096);
+    const auto batch = columns.view();
+
+    std::vector<double> par(1024, 100.0), coupon(1024, 0.05), yield(1024), years(1024);
+    std::vector<int> m(1024, 2);
+    for (std::size_t i = 0; i < par.size(); ++i) {
+        yield[i] = 0.02 + 0.0001 * static_cast<double>(i);
+        years[i] = 0.5 + 0.01 * static_cast<double>(i);
+    }
+    const bond::bond_batch bonds{par, coupon, yield, years, m};
+
+    require_identical([&] {
+        const auto n = batch.size();
+        std::vector<double> call(n), put(n), delta(n), gamma(n), vega(n), implied(n), dirty(bonds.size());
+        option::black_scholes_call_batch(batch, call);
+        option::black_scholes_put_batch(batch, put);
+        option::black_scholes_call_greeks_batch(batch, {.delta = delta, .gamma = gamma, .vega = vega});
+        option::implied_volatility_batch(put, batch, option_type::put, implied);
+        bond::dirty_coupon_price_from_T_batch(bonds, dirty);
+
+        std::vector<double> out;
+        for (const auto* column : {&call, &put, &delta, &gamma, &vega, &implied, &dirty}) {
+            out.insert(out.end(), column->begin(), column->end());
+        }
+        return out;
+    });
+}
+
+TEST_CASE("pool backed pricers can be called from many threads at once", "[stress]") {
+    const option_columns columns(64);
+    const auto batch = columns.view();
+    const monte_carlo::mc_config config{.paths = 4000, .steps = 4, .seed = 7};
+
+    require_identical([&] {
+        std::vector<double> price(batch.size()), error(batch.size());
+        monte_carlo::price_batch(batch, option_type::call, monte_carlo::payoff_style::asian, config, price, error);
+        std::vector<monte_carlo::mc_greeks> greeks(batch.size());
+        monte_carlo::greeks_batch(batch,
+            option_type::put,
+            monte_carlo::payoff_style::european,
+            config,
+            monte_carlo::greek_estimator::likelihood_ratio,
+            greeks);
+
+        std::vector<double> out = price;
+        out.insert(out.end(), error.begin(), error.end());
+        for (const auto& g : greeks) {
+            out.insert(out.end(), {g.price.value, g.delta.value, g.gamma.value, g.vega.value});
+        }
+        return out;
+    });
+
+    std::vector<double> time, strike, call_bid, call_ask, put_bid, put_ask;
+    for (const double T : {0.25, 0.5, 1.0}) {
+        for (double K = 80.0; K <= 120.0; K += 2.5) {
+            const option::bs_kernel k(100.0, K, 0.2 + 0.1 * std::pow(std::log(K / 100.0), 2), 0.03, T, 0.01);
+            time.push_back(T);
+            strike.push_back(K);
+            call_bid.push_back(k.price(option_type::call) - 0.01);
+            call_ask.push_back(k.price(option_type::call) + 0.01);
+            put_bid.push_back(k.price(option_type::put) - 0.01);
+            put_ask.push_back(k.price(option_type::put) + 0.01);
+        }
+    }
+    const surface::quote_chain quotes{time, strike, call_bid, call_ask, put_bid, put_ask};
+    const std::vector<double> grid_time{0.3, 0.8}, grid_moneyness{-0.1, 0.0, 0.1};
+
+    require_identical([&] { return surface::build_surface(quotes, 100.0, grid_time, grid_moneyness).volatility; });
+}
@@ -0,0 +1,175 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "pyfi/option.h"
+#include "pyfi/surface.h"
+
+using namespace pyfi;
+using option::option_type;
+
+namespace {
+    constexpr double spot = 100.0;
+    constexpr double rate = 0.03;
+    constexpr double yield = 0.01;
+
+    double true_vol(const double k, const double T) {
+        return 0.18 + 0.02 * std::sqrt(T) - 0.08 * k + 0.25 * k * k;
+    }
+
+    struct quote_columns {
+        std::vector<double> time, strike, call_bid, call_ask, put_bid, put_ask;
+
+        void add(const double T, const double K, const double half_spread = 0.005) {
+            const double forward = spot * std::exp((rate - yield) * T);
+            const option::bs_kernel k(spot, K, true_vol(std::log(K / forward), T), rate, T, yield);
+            const double call = k.price(option_type::call);
+            const double put = k.price(option_type::put);
+            time.push_back(T);
+            strike.push_back(K);
+            call_bid.push_back(call - half_spread);
+            call_ask.push_back(call + half_spread);
+            put_bid.push_back(put - half_spread);
+            put_ask.push_back(put + half_spread);
+        }
+
+        [[nodiscard]] surface::quote_chain view() const {
+            return {time, strike, call_bid, call_ask, put_bid, put_ask};
+        }
+    };
+
+    quote_columns make_quotes() {
+        quote_columns quotes;
+        for (const double T : {0.25, 0.5, 1.0, 2.0}) {
+            for (double K = 70.0; K <= 140.0; K += 2.5) {
+                quotes.add(T, K);
+            }
+        }
+        return quotes;
+    }
+} // namespace
+
+TEST_CASE("implied volatility inverts Black-Scholes across moneyness", "[implied]") {
+    for (const auto type : {option_type::call, option_type::put}) {
+        for (const double K : {40.0, 80.0, 100.0, 125.0, 250.0}) {
+            for (const double sigma : {0.05, 0.2, 0.8, 2.5}) {
+                const option::bs_kernel kernel(spot, K, sigma, rate, 0.75, yield);
+                // the inversion runs on the out of the money side, so the vol is only pinned down where that side
+                // carries time value; the price is reproduced everywhere
+                const auto out_of_the_money = K >= kernel.stock_price * kernel.carry / kernel.discount
+                    ? option_type::call
+                    : option_type::put;
+                if (kernel.price(out_of_the_money) < 1e-10) {
+                    continue;
+                }
+                const double price = kernel.price(type);
+                const double implied = option::implied_volatility(price, spot, K, rate, 0.75, yield, type);
+                REQUIRE(option::bs_kernel(spot, K, implied, rate, 0.75, yield).price(type) ==
+                    Catch::Approx(price).margin(1e-12));
+                if (kernel.price(out_of_the_money) > 1e-4) {
+                    REQUIRE(implied == Catch::Approx(sigma).epsilon(1e-8));
+                }
+            }
+        }
+    }
+
+    // below intrinsic value
+    REQUIRE_THROWS_AS(option::implied_volatility(1.0, spot, 80.0, rate, 1.0, yield, option_type::call),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(option::implied_volatility(5.0, spot, 80.0, rate, 0.0, yield, option_type::call),
+        std::invalid_argument);
+
+    const std::vector<double> S(3, spot), K{90.0, 100.0, 110.0}, guess{0.3, 0.0, 0.3}, r(3, rate), T(3, 1.0),
+        q(3, yield);
+    std::vector<double> prices(3), out(3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        prices[i] = option::bs_kernel(S[i], K[i], 0.25, r[i], T[i], q[i]).price(option_type::put);
+    }
+    prices[2] = -1.0;
+    option::implied_volatility_batch(prices, {S, K, guess, r, T, q}, option_type::put, out);
+    REQUIRE(out[0] == Catch::Approx(0.25).epsilon(1e-10));
+    REQUIRE(out[1] == Catch::Approx(0.25).epsilon(1e-10));
+    REQUIRE(std::isnan(out[2]));
+}
+
+TEST_CASE("surface from raw quotes recovers the forward and the smile on the grid", "[surface]") {
+    const auto quotes = make_quotes();
+    const std::vector<double> grid_time{0.25, 0.75, 1.0, 3.0};
+    const std::vector<double> grid_moneyness{-0.2, -0.1, 0.0, 0.1, 0.2};
+
+    const auto result = surface::build_surface(quotes.view(), spot, grid_time, grid_moneyness);
+    REQUIRE(result.smiles.size() == 4);
+    REQUIRE(result.volatility.size() == grid_time.size() * grid_moneyness.size());
+
+    for (std::size_t i = 0; i < grid_time.size(); ++i) {
+        REQUIRE(result.forward[i] == Catch::Approx(spot * std::exp((rate - yield) * grid_time[i])).epsilon(1e-9));
+    }
+    for (const auto& s : result.smiles) {
+        REQUIRE(s.discount == Catch::Approx(std::exp(-rate * s.time)).epsilon(1e-9));
+        for (std::size_t j = 0; j < s.moneyness.size(); ++j) {
+            // a half spread of 0.005 around the true price moves the mid vol by nothing
+            REQUIRE(s.volatility[j] == Catch::Approx(true_vol(s.moneyness[j], s.time)).epsilon(1e-6));
+        }
+    }
+
+    // on an expiry of the quotes only the strike interpolation error remains
+    for (std::size_t j = 0; j < grid_moneyness.size(); ++j) {
+        REQUIRE(result.volatility[j] == Catch::Approx(true_vol(grid_moneyness[j], 0.25)).margin(2e-3));
+        REQUIRE(result.volatility[2 * grid_moneyness.size() + j] ==
+            Catch::Approx(true_vol(grid_moneyness[j], 1.0)).margin(2e-3));
+    }
+    // between expiries total variance is linear in time, beyond the last expiry the vol is flat
+    for (std::size_t j = 0; j < grid_moneyness.size(); ++j) {
+        const double k = grid_moneyness[j];
+        const double w_half = std::pow(result.smiles[1].volatility_at(k), 2) * 0.5;
+        const double w_one = std::pow(result.smiles[2].volatility_at(k), 2) * 1.0;
+        REQUIRE(result.volatility[grid_moneyness.size() + j] ==
+            Catch::Approx(std::sqrt((0.5 * (w_half + w_one)) / 0.75)).epsilon(1e-12));
+        REQUIRE(result.volatility[3 * grid_moneyness.size() + j] == result.smiles[3].volatility_at(k));
+    }
+}
+
+TEST_CASE("surface cleaning drops wide, crossed and off-smile quotes", "[surface]") {
+    auto quotes = make_quotes();
+    // on the 6 month expiry: a stale call far from the smile, a strike whose put is crossed and whose call is not
+    // bid, and a strike quoted too wide on both sides
+    std::size_t first = 0;
+    while (quotes.time[first] != 0.5) {
+        ++first;
+    }
+    quotes.call_bid[first + 20] += 3.0;
+    quotes.call_ask[first + 20] += 3.0;
+    quotes.put_ask[first + 3] = quotes.put_bid[first + 3] - 0.1;
+    quotes.call_bid[first + 3] = 0.0;
+    quotes.call_bid[first + 25] = 0.01;
+    quotes.put_bid[first + 25] = 0.01;
+    // an expiry with calls only cannot be put on a forward
+    for (double K = 80.0; K <= 120.0; K += 5.0) {
+        quotes.add(3.0, K);
+        quotes.put_bid.back() = 0.0;
+    }
+
+    const std::vector<double> grid_time{0.5};
+    const std::vector<double> grid_moneyness{-0.1, 0.0, 0.1};
+    const auto result = surface::build_surface(quotes.view(), spot, grid_time, grid_moneyness);
+    REQUIRE(result.smiles.size() == 4);
+    REQUIRE(result.smiles[1].time == 0.5);
+    REQUIRE(result.smiles[1].rejected >= 3);
+    for (std::size_t j = 0; j < result.smiles[1].moneyness.size(); ++j) {
+        REQUIRE(result.smiles[1].volatility[j] ==
+            Catch::Approx(true_vol(result.smiles[1].moneyness[j], 0.5)).epsilon(1e-5));
+    }
+    for (std::size_t j = 0; j < grid_moneyness.size(); ++j) {
+        REQUIRE(result.volatility[j] == Catch::Approx(true_vol(grid_moneyness[j], 0.5)).margin(2e-3));
+    }
+
+    const quote_columns empty;
+    REQUIRE_THROWS_AS(surface::build_surface(empty.view(), spot, grid_time, grid_moneyness), std::invalid_argument);
+    REQUIRE_THROWS_AS(surface::build_surface(quotes.view(), -1.0, grid_time, grid_moneyness), std::invalid_argument);
+}
@@ -0,0 +1,88 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "pyfi/option.h"
+#include "pyfi/parallel.h"
+#include "pyfi/trace.h"
+
+using namespace pyfi;
+
+namespace {
+    std::string exported() {
+        std::ostringstream out;
+        trace::write_json(out);
+        return out.str();
+    }
+
+    std::size_t count(const std::string& text, const std::string& what) {
+        std::size_t n = 0;
+        for (auto at = text.find(what); at != std::string::npos; at = text.find(what, at + what.size())) {
+            ++n;
+        }
+        return n;
+    }
+} // namespace
+
+TEST_CASE("stages on the pool are exported as Chrome trace events", "[trace]") {
+    const std::size_t n = 4096;
+    const std::vector<double> S(n, 100.0), K(n, 100.0), sigma(n, 0.2), r(n, 0.03), T(n, 1.0), q(n, 0.0);
+    const option::option_batch batch{S, K, sigma, r, T, q};
+    std::vector<double> out(n);
+    parallel::thread_pool pool(3);
+    const auto price = [&] {
+        pool.parallel_for(n, 512, [&](const std::size_t begin, const std::size_t end) {
+            option::black_scholes_call_batch(batch.slice(begin, end - begin),
+                std::span<double>(out).subspan(begin, end - begin));
+        });
+    };
+
+    trace::start();
+    REQUIRE(trace::enabled());
+    {
+        const trace::span job("nightly", "job");
+        price();
+    }
+    trace::stop();
+    price(); // not recorded
+
+    const auto json = exported();
+    REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    REQUIRE(count(json, "\"name\":\"option.black_scholes_call_batch\",\"cat\":\"pricing\"") == 8);
+    REQUIRE(count(json, "\"name\":\"parallel_for.chunk\"") == 8);
+    REQUIRE(count(json, "\"name\":\"parallel_for\",") == 1);
+    REQUIRE(count(json, "\"name\":\"nightly\",\"cat\":\"job\"") == 1);
+    REQUIRE(count(json, "\"args\":{\"rows\":512}") == 16);
+    REQUIRE(count(json, "\"ph\":\"X\"") == 18);
+    REQUIRE(trace::dropped() == 0);
+
+    // a fresh start drops the previous spans
+    trace::start();
+    trace::stop();
+    REQUIRE(count(exported(), "\"ph\":\"X\"") == 0);
+}
+
+TEST_CASE("full buffers drop spans and names are escaped", "[trace]") {
+    REQUIRE_THROWS_AS(trace::start(0), std::invalid_argument);
+
+    trace::start(4);
+    trace::set_thread_name("main \"thread\"");
+    const char* name = trace::intern(std::string("stage \"a\"\\b"));
+    REQUIRE(name == trace::intern("stage \"a\"\\b"));
+    for (int i = 0; i < 10; ++i) {
+        const trace::span span(name, "test");
+    }
+    trace::stop();
+
+    const auto json = exported();
+    REQUIRE(trace::dropped() == 6);
+    REQUIRE(count(json, "\"ph\":\"X\"") == 4);
+    REQUIRE(count(json, "\"name\":\"stage \\\"a\\\"\\\\b\"") == 4);
+    REQUIRE(count(json, "\"args\":{\"name\":\"main \\\"thread\\\"\"}") == 1);
+}
@@ -0,0 +1,142 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/server.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace pyfi::server;
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+    struct options {
+        std::string socket_path;
+        int clients = 4;
+        int pipeline = 16;
+        double seconds = 5.0;
+    };
+
+    void usage() {
+        std::cerr << "usage: pyfi-loadgen --socket PATH [--clients N] [--pipeline N] [--seconds S]\n";
+    }
+
+    price_request random_request(std::mt19937_64& rng, const std::uint64_t id) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        price_request request{};
+        request.id = id;
+        if (unit(rng) < 0.8) {
+            request.kind = unit(rng) < 0.5 ? request_kind::call : request_kind::put;
+            request.fields[0] = 50.0 + 100.0 * unit(rng);
+            request.fields[1] = 100.0;
+            request.fields[2] = 0.05 + 0.5 * unit(rng);
+            request.fields[3] = 0.05 * unit(rng);
+            request.fields[4] = 0.05 + 3.0 * unit(rng);
+            request.fields[5] = 0.0;
+        } else {
+            request.kind = unit(rng) < 0.5 ? request_kind::bond_dirty : request_kind::bond_clean;
+            request.m = 2;
+            request.fields[0] = 1000.0;
+            request.fields[1] = 0.08 * unit(rng);
+            request.fields[2] = 0.08 * unit(rng);
+            request.fields[3] = 0.1 + 30.0 * unit(rng);
+        }
+        return request;
+    }
+
+    // closed loop: send `pipeline` requests, wait for all responses, and charge each request the round trip
+    void run_client(const options& opts, const int client, std::vector<double>& latencies_us) try {
+        const pricing_client connection(opts.socket_path);
+        std::mt19937_64 rng(static_cast<std::uint64_t>(client) + 1);
+
+        const auto pipeline = static_cast<std::size_t>(opts.pipeline);
+        std::vector<price_request> requests(pipeline);
+        std::vector<price_response> responses(pipeline);
+        std::uint64_t next_id = 0;
+
+        const auto end = clock::now() + std::chrono::duration<double>(opts.seconds);
+        while (clock::now() < end) {
+            for (std::size_t i = 0; i < pipeline; ++i) {
+                requests[i] = random_request(rng, next_id++);
+            }
+            const auto start = clock::now();
+            connection.send(requests);
+            connection.receive(responses);
+            const auto done = clock::now();
+            const auto elapsed = std::chrono::duration<double, std::micro>(done - start).count();
+            latencies_us.insert(latencies_us.end(), pipeline, elapsed);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "pyfi-loadgen client " << client << ": " << e.what() << "\n";
+    }
+
+    double percentile(const std::vector<double>& sorted, const double p) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        const auto rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+        return sorted[rank];
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    options opts;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            usage();
+            return 2;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--socket") {
+            opts.socket_path = value;
+        } else if (arg == "--clients") {
+            opts.clients = std::stoi(value);
+        } else if (arg == "--pipeline") {
+            opts.pipeline = std::stoi(value);
+        } else if (arg == "--seconds") {
+            opts.seconds = std::stod(value);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (opts.socket_path.empty() || opts.clients <= 0 || opts.pipeline <= 0) {
+        usage();
+        return 2;
+    }
+
+    std::vector<std::vector<double>> per_client(static_cast<std::size_t>(opts.clients));
+    std::vector<std::thread> threads;
+    const auto start = clock::now();
+    for (int c = 0; c < opts.clients; ++c) {
+        threads.emplace_back(run_client, std::cref(opts), c, std::ref(per_client[static_cast<std::size_t>(c)]));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto wall = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::vector<double> latencies;
+    for (const auto& client : per_client) {
+        latencies.insert(latencies.end(), client.begin(), client.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "requests:   " << latencies.size() << "\n";
+    std::cout << "throughput: " << static_cast<double>(latencies.size()) / wall << " req/s\n";
+    std::cout << "p50:        " << percentile(latencies, 0.50) << " us\n";
+    std::cout << "p99:        " << percentile(latencies, 0.99) << " us\n";
+    std::cout << "p99.9:      " << percentile(latencies, 0.999) << " us\n";
+    return 0;
+}
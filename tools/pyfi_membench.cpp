@@ -0,0 +1,220 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+// Prices one large option book out of 4 KiB page buffers and out of huge page buffers and reports throughput and
+// data TLB misses per contract, to show what pyfi::memory placement buys on inputs far larger than the TLB reach.
+// Each thread owns one fixed slice of the book: it first touches and fills that slice and then prices it on every
+// pass, so under numa_policy::local every page is on the node of the thread that reads it.
+
+#include <pyfi/memory.h>
+#include <pyfi/option.h>
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace pyfi;
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+    struct options {
+        std::size_t rows = 8'000'000;
+        std::size_t threads = 0;
+        int passes = 5;
+        memory::numa_policy numa = memory::numa_policy::local;
+    };
+
+    void usage() {
+        std::cerr << "usage: pyfi-membench [--rows N] [--threads N] [--passes N] [--numa local|interleave]\n";
+    }
+
+    // data TLB load misses of the thread that opens the counter
+    class tlb_counter {
+    public:
+        tlb_counter() {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+
+        tlb_counter(const tlb_counter&) = delete;
+        tlb_counter& operator=(const tlb_counter&) = delete;
+
+        ~tlb_counter() {
+            if (fd_ >= 0) {
+                close(fd_);
+            }
+        }
+
+        void start() const {
+            if (fd_ >= 0) {
+                ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+
+        [[nodiscard]] std::optional<std::uint64_t> stop() const {
+            std::uint64_t count = 0;
+            if (fd_ < 0 || ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0) != 0 ||
+                read(fd_, &count, sizeof(count)) != sizeof(count)) {
+                return std::nullopt;
+            }
+            return count;
+        }
+
+    private:
+        int fd_ = -1;
+    };
+
+    // AnonHugePages of the whole process, in bytes
+    std::size_t huge_page_bytes() {
+        std::ifstream smaps("/proc/self/smaps_rollup");
+        std::string key;
+        std::size_t kb = 0;
+        while (smaps >> key) {
+            if (key == "AnonHugePages:") {
+                smaps >> kb;
+                return kb * 1024;
+            }
+            smaps.ignore(256, '\n');
+        }
+        return 0;
+    }
+
+    void run(const options& opts, const bool huge_pages) {
+        // the pages are touched below by the threads that price them, not by the default pool
+        const memory::placement placement{.huge_pages = huge_pages, .numa = opts.numa, .first_touch = false};
+        const std::size_t n = opts.rows;
+        const std::size_t threads =
+            opts.threads == 0 ? std::max<std::size_t>(1, std::thread::hardware_concurrency()) : opts.threads;
+
+        const auto alloc_start = clock::now();
+        memory::buffer<double> S(n, placement), K(n, placement), sigma(n, placement), r(n, placement), T(n, placement),
+            q(n, placement), out(n, placement);
+        const auto alloc_ms = std::chrono::duration<double, std::milli>(clock::now() - alloc_start).count();
+        const option::option_batch batch{S, K, sigma, r, T, q};
+
+        clock::time_point start;
+        clock::time_point stop;
+        std::barrier filled(static_cast<std::ptrdiff_t>(threads), [&start]() noexcept { start = clock::now(); });
+        std::barrier priced(static_cast<std::ptrdiff_t>(threads), [&stop]() noexcept { stop = clock::now(); });
+        std::atomic<std::uint64_t> total_misses{0};
+        std::atomic<bool> counted{true};
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                const auto begin = n * t / threads;
+                const auto end = n * (t + 1) / threads;
+                // the first write to each page faults it in on this thread's node
+                for (std::size_t i = begin; i < end; ++i) {
+                    S[i] = 80.0 + static_cast<double>(i % 41);
+                    K[i] = 100.0;
+                    sigma[i] = 0.1 + 0.01 * static_cast<double>(i % 20);
+                    r[i] = 0.03;
+                    T[i] = 0.25 + 0.05 * static_cast<double>(i % 30);
+                    q[i] = 0.01;
+                    out[i] = 0.0;
+                }
+
+                const tlb_counter counter;
+                filled.arrive_and_wait();
+                counter.start();
+                for (int pass = 0; pass < opts.passes; ++pass) {
+                    option::black_scholes_call_batch(
+                        batch.slice(begin, end - begin), std::span<double>(out).subspan(begin, end - begin));
+                }
+                const auto count = counter.stop();
+                priced.arrive_and_wait();
+                if (count) {
+                    total_misses += *count;
+                } else {
+                    counted = false;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        const auto huge_bytes = huge_page_bytes();
+        const auto seconds = std::chrono::duration<double>(stop - start).count();
+        const auto misses = counted ? std::optional<std::uint64_t>(total_misses) : std::nullopt;
+
+        const auto contracts = static_cast<double>(n) * opts.passes;
+        std::cout << std::left << std::setw(8) << (huge_pages ? "2 MiB" : "4 KiB") << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(10) << alloc_ms << std::setw(16)
+                  << static_cast<double>(huge_bytes) / (1 << 20) << std::setprecision(2) << std::setw(13)
+                  << seconds * 1e9 / contracts << std::setw(10) << contracts * 7 * sizeof(double) / seconds / 1e9;
+        if (misses) {
+            std::cout << std::setprecision(4) << std::setw(22) << static_cast<double>(*misses) / contracts << "\n";
+        } else {
+            std::cout << std::setw(22) << "n/a" << "\n";
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    options opts;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                usage();
+                return 2;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--rows") {
+                opts.rows = std::stoul(value);
+            } else if (arg == "--threads") {
+                opts.threads = std::stoul(value);
+            } else if (arg == "--passes") {
+                opts.passes = std::stoi(value);
+            } else if (arg == "--numa" && (value == "local" || value == "interleave")) {
+                opts.numa = value == "local" ? memory::numa_policy::local : memory::numa_policy::interleave;
+            } else {
+                usage();
+                return 2;
+            }
+        }
+        if (opts.rows == 0 || opts.passes <= 0) {
+            usage();
+            return 2;
+        }
+
+        std::cout << "rows " << opts.rows << ", 7 columns of " << opts.rows * sizeof(double) / (1 << 20)
+                  << " MiB, huge page size " << memory::huge_page_size() / 1024 << " KiB\n";
+        std::cout << std::left << std::setw(8) << "pages" << std::right << std::setw(10) << "alloc ms" << std::setw(16)
+                  << "huge page MiB" << std::setw(13) << "ns/contract" << std::setw(10) << "GB/s" << std::setw(22)
+                  << "dTLB misses/contract" << "\n";
+        run(opts, false);
+        run(opts, true);
+    } catch (const std::exception& e) {
+        std::cerr << "pyfi-membench: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
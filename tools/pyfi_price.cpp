@@ -0,0 +1,385 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/bond.h>
+#include <pyfi/csv.h>
+#include <pyfi/option.h>
+#include <pyfi/parallel.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+    enum class instrument { option, bond };
+    enum class format { csv, binary };
+
+    struct cli_options {
+        instrument what = instrument::option;
+        std::string kind = "call";
+        format input = format::csv;
+        format output = format::csv;
+        std::size_t threads = 0;
+        std::size_t chunk_rows = 1 << 16;
+        std::string path = "-";
+        bool stats = false;
+    };
+
+    const std::vector<std::string> option_columns{
+        "stock_price", "strike_price", "volatility", "risk_free_rate", "time", "yield_curve"};
+    const std::vector<std::string> bond_columns{"par_value", "coupon_rate", "annual_yield", "years_to_maturity", "m"};
+
+    void usage() {
+        std::cerr
+            << "usage: pyfi-price [--instrument option|bond] [--kind call|put|dirty|clean] [--input-format csv|binary]\n"
+               "                  [--output-format csv|binary] [--threads N] [--chunk-rows N] [--stats] [FILE|-]\n"
+               "\n"
+               "CSV input needs a header naming the columns; options read stock_price, strike_price, volatility,\n"
+               "risk_free_rate, time and optionally yield_curve, bonds read par_value, coupon_rate, annual_yield,\n"
+               "years_to_maturity and m. Binary input is packed native doubles, 6 per option and 5 per bond (m last).\n"
+               "Results are written to stdout in input order, one per row.\n";
+    }
+
+    // one chunk of rows in column order, reused between chunks
+    struct chunk {
+        std::vector<double> columns[6];
+        std::vector<int> m;
+        std::vector<double> out;
+
+        [[nodiscard]] std::size_t rows() const {
+            return columns[0].size();
+        }
+
+        void clear() {
+            for (auto& column : columns) {
+                column.clear();
+            }
+            m.clear();
+        }
+    };
+
+    class pricer {
+    public:
+        explicit pricer(const cli_options& opts) : opts_(opts), pool_(opts.threads) {
+            if (opts.what == instrument::option) {
+                if (opts.kind != "call" && opts.kind != "put") {
+                    throw std::invalid_argument("options are priced as --kind call or put");
+                }
+            } else if (opts.kind != "dirty" && opts.kind != "clean") {
+                throw std::invalid_argument("bonds are priced as --kind dirty or clean");
+            }
+        }
+
+        // prices the chunk on the pool, each thread taking a contiguous slice so results land in order
+        void price(chunk& rows) {
+            const auto n = rows.rows();
+            rows.out.resize(n);
+            if (opts_.what == instrument::option) {
+                rows.columns[5].resize(n, 0.0);
+            }
+            const auto grain = std::max<std::size_t>(1024, (n + pool_.size() - 1) / pool_.size());
+
+            pool_.parallel_for(n, grain, [&](const std::size_t begin, const std::size_t end) {
+                const auto count = end - begin;
+                const std::span<double> out(rows.out.data() + begin, count);
+                if (opts_.what == instrument::option) {
+                    const pyfi::option::option_batch batch{rows.columns[0],
+                        rows.columns[1],
+                        rows.columns[2],
+                        rows.columns[3],
+                        rows.columns[4],
+                        rows.columns[5]};
+                    if (opts_.kind == "call") {
+                        pyfi::option::black_scholes_call_batch(batch.slice(begin, count), out);
+                    } else {
+                        pyfi::option::black_scholes_put_batch(batch.slice(begin, count), out);
+                    }
+                } else {
+                    const pyfi::bond::bond_batch batch{
+                        rows.columns[0], rows.columns[1], rows.columns[2], rows.columns[3], rows.m};
+                    if (opts_.kind == "dirty") {
+                        pyfi::bond::dirty_coupon_price_from_T_batch(batch.slice(begin, count), out);
+                    } else {
+                        pyfi::bond::clean_coupon_price_from_T_batch(batch.slice(begin, count), out);
+                    }
+                }
+            });
+        }
+
+        // formats the results on the pool and writes them in order
+        void write(const chunk& rows, std::FILE* to) {
+            const auto n = rows.out.size();
+            if (opts_.output == format::binary) {
+                if (std::fwrite(rows.out.data(), sizeof(double), n, to) != n) {
+                    throw std::runtime_error("write failed");
+                }
+                return;
+            }
+
+            const auto parts = pool_.size();
+            text_.resize(parts);
+            const auto per = (n + parts - 1) / parts;
+            pool_.parallel_for(parts, 1, [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t p = begin; p < end; ++p) {
+                    auto& text = text_[p];
+                    text.clear();
+                    char buffer[32];
+                    for (std::size_t i = p * per; i < std::min(n, (p + 1) * per); ++i) {
+                        const auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), rows.out[i]);
+                        text.append(buffer, ptr);
+                        text.push_back('\n');
+                    }
+                }
+            });
+            for (const auto& text : text_) {
+                if (std::fwrite(text.data(), 1, text.size(), to) != text.size()) {
+                    throw std::runtime_error("write failed");
+                }
+            }
+        }
+
+    private:
+        const cli_options& opts_;
+        pyfi::parallel::thread_pool pool_;
+        std::vector<std::string> text_;
+    };
+
+    // streams CSV rows through the projecting reader, copying each chunk of typed columns into the shared layout
+    class csv_source {
+    public:
+        csv_source(std::FILE* from, const instrument what) : what_(what), reader_(from, specs(what)) {}
+
+        bool next(chunk& rows, const std::size_t max_rows) {
+            rows.clear();
+            const auto n = reader_.read(max_rows);
+            if (what_ == instrument::option) {
+                for (std::size_t c = 0; c < option_columns.size(); ++c) {
+                    const auto values = reader_.real(c);
+                    rows.columns[c].assign(values.begin(), values.end());
+                }
+            } else {
+                for (std::size_t c = 0; c < 4; ++c) {
+                    const auto values = reader_.real(c);
+                    rows.columns[c].assign(values.begin(), values.end());
+                }
+                const auto m = reader_.integer(4);
+                rows.m.assign(m.begin(), m.end());
+            }
+            return n > 0;
+        }
+
+        [[nodiscard]] std::size_t bytes() const {
+            return reader_.bytes();
+        }
+
+    private:
+        static std::vector<pyfi::csv::column_spec> specs(const instrument what) {
+            std::vector<pyfi::csv::column_spec> columns;
+            if (what == instrument::option) {
+                for (const auto& name : option_columns) {
+                    columns.push_back({name, pyfi::csv::column_type::real, name != "yield_curve"});
+                }
+            } else {
+                for (const auto& name : bond_columns) {
+                    columns.push_back(
+                        {name, name == "m" ? pyfi::csv::column_type::integer : pyfi::csv::column_type::real});
+                }
+            }
+            return columns;
+        }
+
+        instrument what_;
+        pyfi::csv::reader reader_;
+    };
+
+    // streams packed binary records
+    class binary_source {
+    public:
+        binary_source(std::FILE* from, const instrument what) :
+            from_(from), fields_(what == instrument::option ? 6 : 5), what_(what) {}
+
+        bool next(chunk& rows, const std::size_t max_rows) {
+            rows.clear();
+            records_.resize(max_rows * fields_);
+            const auto first = bytes_ / (sizeof(double) * fields_);
+            const auto got = std::fread(records_.data(), sizeof(double), records_.size(), from_);
+            bytes_ += got * sizeof(double);
+            // a short read is the end of the input only if it was not an error
+            if (got < records_.size() && std::ferror(from_)) {
+                throw std::runtime_error(std::string("read failed: ") + std::strerror(errno));
+            }
+            if (got % fields_ != 0) {
+                throw std::runtime_error("binary input ends in a partial record");
+            }
+            const auto n = got / fields_;
+            for (std::size_t i = 0; i < n; ++i) {
+                const double* record = records_.data() + i * fields_;
+                if (what_ == instrument::option) {
+                    for (std::size_t c = 0; c < 6; ++c) {
+                        rows.columns[c].push_back(record[c]);
+                    }
+                } else {
+                    for (std::size_t c = 0; c < 4; ++c) {
+                        rows.columns[c].push_back(record[c]);
+                    }
+                    // the cast is only defined for integral values that fit in an int
+                    const double m = record[4];
+                    if (!(m >= std::numeric_limits<int>::min() && m <= std::numeric_limits<int>::max()) ||
+                        m != std::trunc(m)) {
+                        throw std::runtime_error("record " + std::to_string(first + i) + ": m is not an integer");
+                    }
+                    rows.m.push_back(static_cast<int>(m));
+                }
+            }
+            return n > 0;
+        }
+
+        [[nodiscard]] std::size_t bytes() const {
+            return bytes_;
+        }
+
+    private:
+        std::FILE* from_;
+        std::size_t fields_;
+        instrument what_;
+        std::vector<double> records_;
+        std::size_t bytes_ = 0;
+    };
+
+    template <typename Source>
+    std::size_t run(Source& source, pricer& engine, const cli_options& opts) {
+        if (opts.output == format::csv) {
+            std::fprintf(stdout, "%s\n", opts.kind.c_str());
+        }
+        chunk rows;
+        std::size_t total = 0;
+        while (source.next(rows, opts.chunk_rows)) {
+            try {
+                engine.price(rows);
+            } catch (const std::invalid_argument& e) {
+                throw std::runtime_error("rows " + std::to_string(total) + ".." +
+                    std::to_string(total + rows.rows()) + ": " + e.what());
+            }
+            engine.write(rows, stdout);
+            total += rows.rows();
+        }
+        return total;
+    }
+
+    format parse_format(const std::string& value) {
+        if (value == "csv") {
+            return format::csv;
+        }
+        if (value == "binary") {
+            return format::binary;
+        }
+        throw std::invalid_argument("format must be csv or binary");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    cli_options opts;
+    try {
+        bool kind_given = false;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument(arg + " needs a value");
+                }
+                return argv[++i];
+            };
+            if (arg == "--instrument") {
+                const auto what = value();
+                if (what != "option" && what != "bond") {
+                    throw std::invalid_argument("instrument must be option or bond");
+                }
+                opts.what = what == "option" ? instrument::option : instrument::bond;
+            } else if (arg == "--kind") {
+                opts.kind = value();
+                kind_given = true;
+            } else if (arg == "--input-format") {
+                opts.input = parse_format(value());
+            } else if (arg == "--output-format") {
+                opts.output = parse_format(value());
+            } else if (arg == "--threads") {
+                opts.threads = std::stoul(value());
+            } else if (arg == "--chunk-rows") {
+                opts.chunk_rows = std::max<std::size_t>(1, std::stoul(value()));
+            } else if (arg == "--stats") {
+                opts.stats = true;
+            } else if (arg == "--help" || arg == "-h") {
+                usage();
+                return 0;
+            } else if (!arg.empty() && arg[0] == '-' && arg != "-") {
+                throw std::invalid_argument("unknown option " + arg);
+            } else {
+                opts.path = arg;
+            }
+        }
+        if (!kind_given && opts.what == instrument::bond) {
+            opts.kind = "dirty";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "pyfi-price: " << e.what() << "\n";
+        usage();
+        return 2;
+    }
+
+    std::FILE* from = opts.path == "-" ? stdin : std::fopen(opts.path.c_str(), "rb");
+    if (from == nullptr) {
+        std::cerr << "pyfi-price: cannot open " << opts.path << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+
+    try {
+        pricer engine(opts);
+        const auto start = clock::now();
+        std::size_t rows = 0;
+        std::size_t bytes = 0;
+        if (opts.input == format::csv) {
+            csv_source source(from, opts.what);
+            rows = run(source, engine, opts);
+            bytes = source.bytes();
+        } else {
+            binary_source source(from, opts.what);
+            rows = run(source, engine, opts);
+            bytes = source.bytes();
+        }
+        std::fflush(stdout);
+
+        if (opts.stats) {
+            const auto seconds = std::chrono::duration<double>(clock::now() - start).count();
+            std::fprintf(stderr,
+                "pyfi-price: %zu rows in %.3f s, %.0f rows/s, %.1f MB/s\n",
+                rows,
+                seconds,
+                static_cast<double>(rows) / seconds,
+                static_cast<double>(bytes) / seconds / 1e6);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "pyfi-price: " << e.what() << "\n";
+        if (from != stdin) {
+            std::fclose(from);
+        }
+        return 1;
+    }
+
+    if (from != stdin) {
+        std::fclose(from);
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+#include <pyfi/server.h>
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+    pyfi::server::pricing_server* running = nullptr;
+
+    void handle_signal(int) {
+        if (running != nullptr) {
+            running->stop();
+        }
+    }
+
+    void usage() {
+        std::cerr << "usage: pyfi-server --socket PATH [--target-batch N] [--max-batch N] [--min-window-us N] "
+                     "[--max-window-us N]\n";
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    pyfi::server::server_config config;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            usage();
+            return 2;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--socket") {
+            config.socket_path = value;
+        } else if (arg == "--target-batch") {
+            config.target_batch = std::stoul(value);
+        } else if (arg == "--max-batch") {
+            config.max_batch = std::stoul(value);
+        } else if (arg == "--min-window-us") {
+            config.min_window = std::chrono::microseconds(std::stol(value));
+        } else if (arg == "--max-window-us") {
+            config.max_window = std::chrono::microseconds(std::stol(value));
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (config.socket_path.empty()) {
+        usage();
+        return 2;
+    }
+
+    try {
+        pyfi::server::pricing_server server(config);
+        running = &server;
+        std::signal(SIGINT, handle_signal);
+        std::signal(SIGTERM, handle_signal);
+
+        std::cerr << "pyfi-server listening on " << config.socket_path << "\n";
+        server.run();
+        running = nullptr;
+
+        const auto stats = server.stats();
+        std::cerr << "served " << stats.requests << " requests in " << stats.batches << " batches over "
+                  << stats.connections << " connections\n";
+    } catch (const std::exception& e) {
+        std::cerr << "pyfi-server: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,217 @@
+//
+// Created by Nikolay Tsonev on 18/10/2026.
+//
+
+// STREAM style roofline for the batch kernels: measures the machine's sustainable memory bandwidth with the copy,
+// scale, add and triad kernels, then runs the Black-Scholes, Greeks and bond batch kernels with and without prefetching
+// and streaming stores and reports each one's bandwidth against that roof.
+
+#include <pyfi/bond.h>
+#include <pyfi/memory.h>
+#include <pyfi/option.h>
+#include <pyfi/parallel.h>
+#include <pyfi/profile.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace pyfi;
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+    struct options {
+        std::size_t rows = 20'000'000;
+        std::size_t threads = 0;
+        int passes = 5;
+        std::size_t prefetch_distance = 256;
+        bool profile = false;
+    };
+
+    void usage() {
+        std::cerr << "usage: pyfi-streambench [--rows N] [--threads N] [--passes N] [--prefetch ROWS] [--profile]\n";
+    }
+
+    // best of passes, in seconds; every pass runs body over [0, rows) in chunks on the pool
+    double best_time(parallel::thread_pool& pool,
+        const std::size_t rows,
+        const int passes,
+        const std::function<void(std::size_t, std::size_t)>& body) {
+        double best = std::numeric_limits<double>::infinity();
+        for (int pass = 0; pass < passes; ++pass) {
+            const auto start = clock::now();
+            pool.parallel_for(rows, 1 << 16, body);
+            best = std::min(best, std::chrono::duration<double>(clock::now() - start).count());
+        }
+        return best;
+    }
+
+    void report(const std::string& name,
+        const double seconds,
+        const std::size_t rows,
+        const double bytes_per_row,
+        const double roof) {
+        const double bandwidth = bytes_per_row * static_cast<double>(rows) / seconds / 1e9;
+        std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << seconds * 1e9 / static_cast<double>(rows) << std::setw(10) << bandwidth;
+        if (roof > 0.0) {
+            std::cout << std::setw(9) << std::setprecision(0) << 100.0 * bandwidth / roof << "%";
+        }
+        std::cout << "\n";
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    options opts;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--profile") {
+                opts.profile = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                usage();
+                return 2;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--rows") {
+                opts.rows = std::stoul(value);
+            } else if (arg == "--threads") {
+                opts.threads = std::stoul(value);
+            } else if (arg == "--passes") {
+                opts.passes = std::stoi(value);
+            } else if (arg == "--prefetch") {
+                opts.prefetch_distance = std::stoul(value);
+            } else {
+                usage();
+                return 2;
+            }
+        }
+        if (opts.rows == 0 || opts.passes <= 0) {
+            usage();
+            return 2;
+        }
+
+        const std::size_t n = opts.rows;
+        parallel::thread_pool pool(opts.threads);
+        memory::buffer<double> a(n), b(n), c(n);
+        std::vector<memory::buffer<double>> columns;
+        for (int i = 0; i < 6; ++i) {
+            columns.emplace_back(n);
+        }
+        memory::buffer<int> m(n);
+        pool.parallel_for(n, 1 << 16, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                a[i] = 1.0;
+                b[i] = 2.0;
+                columns[0][i] = 80.0 + static_cast<double>(i % 41);
+                columns[1][i] = 100.0;
+                columns[2][i] = 0.1 + 0.01 * static_cast<double>(i % 20);
+                columns[3][i] = 0.03;
+                columns[4][i] = 0.25 + 0.05 * static_cast<double>(i % 30);
+                columns[5][i] = 0.01;
+                m[i] = 2;
+            }
+        });
+
+        std::cout << "rows " << n << ", threads " << pool.size() << ", best of " << opts.passes << " passes\n";
+        std::cout << std::left << std::setw(34) << "kernel" << std::right << std::setw(12) << "ns/row" << std::setw(10)
+                  << "GB/s" << std::setw(10) << "of roof" << "\n";
+
+        // STREAM counts the bytes the kernel names, not the read for ownership of the destination lines
+        const double scalar = 3.0;
+        const double copy = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                c[i] = a[i];
+            }
+        });
+        const double scale = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                b[i] = scalar * c[i];
+            }
+        });
+        const double add = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                c[i] = a[i] + b[i];
+            }
+        });
+        const double triad = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                a[i] = b[i] + scalar * c[i];
+            }
+        });
+        const double triad_streaming =
+            best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+                const memory::fence_guard fence;
+                for (std::size_t i = begin; i < end; ++i) {
+                    memory::store<true>(&a[i], b[i] + scalar * c[i]);
+                }
+            });
+        report("stream copy", copy, n, 16, 0.0);
+        report("stream scale", scale, n, 16, 0.0);
+        report("stream add", add, n, 24, 0.0);
+        report("stream triad", triad, n, 24, 0.0);
+        report("stream triad, streaming stores", triad_streaming, n, 24, 0.0);
+        const double roof = 24.0 * static_cast<double>(n) / std::min(triad, triad_streaming) / 1e9;
+        std::cout << "roof " << std::setprecision(2) << roof << " GB/s\n\n";
+
+        const option::option_batch batch{columns[0], columns[1], columns[2], columns[3], columns[4], columns[5]};
+        const bond::bond_batch bonds{columns[0], columns[5], columns[5], columns[4], m};
+        memory::buffer<double> price(n), delta(n), gamma(n), vega(n);
+
+        // hardware counters of every kernel call below, per function
+        std::optional<profile::session> session;
+        if (opts.profile) {
+            session.emplace();
+        }
+
+        const std::vector<std::pair<std::string, memory::access_hints>> variants{
+            {"", {0, false}},
+            {", prefetch", {opts.prefetch_distance, false}},
+            {", streaming", {0, true}},
+            {", prefetch + streaming", {opts.prefetch_distance, true}}};
+        for (const auto& [suffix, hints] : variants) {
+            const double call = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+                option::black_scholes_call_batch(batch.slice(begin, end - begin),
+                    std::span<double>(price).subspan(begin, end - begin),
+                    hints);
+            });
+            report("call" + suffix, call, n, 7 * sizeof(double), roof);
+        }
+        for (const auto& [suffix, hints] : variants) {
+            const double greeks = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+                const auto rows = end - begin;
+                option::black_scholes_call_greeks_batch(batch.slice(begin, rows),
+                    {.price = std::span<double>(price).subspan(begin, rows),
+                        .delta = std::span<double>(delta).subspan(begin, rows),
+                        .gamma = std::span<double>(gamma).subspan(begin, rows),
+                        .vega = std::span<double>(vega).subspan(begin, rows)},
+                    hints);
+            });
+            report("greeks" + suffix, greeks, n, 10 * sizeof(double), roof);
+        }
+        for (const auto& [suffix, hints] : variants) {
+            const double dirty = best_time(pool, n, opts.passes, [&](const std::size_t begin, const std::size_t end) {
+                bond::dirty_coupon_price_from_T_batch(bonds.slice(begin, end - begin),
+                    std::span<double>(price).subspan(begin, end - begin),
+                    hints);
+            });
+            report("bond" + suffix, dirty, n, 5 * sizeof(double) + sizeof(int), roof);
+        }
+        if (session) {
+            std::cout << "\n" << profile::format(session->results());
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "pyfi-streambench: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}